@@ -7,6 +7,9 @@
    Date             Author          Notes
    2020-09-15       CDT             First version
    2020-11-16       CDT             Fix bug and optimize code for I2C driver and example
+   2026-10-18       CDT             Add RAM shadow cache with per-page dirty tracking and
+                                    non-blocking ACK polling
+                                    Fix BL24C02F_I2C_WaitIdle() not returning on time out
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -53,10 +56,9 @@
  * @{
  */
 #define BL24C02F_ADDR               (0x50U)
-#define BL24C02F_PAGE_SIZE          (16U)
-
-#define BL24C02F_MEM_SIZE           (256UL)
 #define BL24C02F_WAIT_TIMEOUT       (1000UL)
+/* Longest write cycle accepted by BL24C02F_CacheFlushPoll(), in us (tWR is 5ms max) */
+#define BL24C02F_WRITE_CYCLE_TIMEOUT    (10000UL)
 /**
  * @}
  */
@@ -73,6 +75,7 @@
  * @{
  */
 static en_result_t BL24C02F_I2C_GetStatus(void);
+static en_result_t BL24C02F_PageProgram(uint8_t u8WriteAddr, const uint8_t au8WriteBuf[], uint32_t u32NumByte);
 /**
  * @}
  */
@@ -80,6 +83,25 @@ static en_result_t BL24C02F_I2C_GetStatus(void);
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/**
+ * @defgroup BL24C02F_Local_Variables BL24C02F Local Variables
+ * @{
+ */
+/* RAM shadow of the whole EEPROM array */
+static uint8_t m_au8CacheData[BL24C02F_MEM_SIZE];
+/* Bit n set: page n of the shadow differs from the EEPROM */
+static uint16_t m_u16CacheDirtyPage = 0U;
+/* Shadow loaded by BL24C02F_CacheInit() */
+static en_functional_state_t m_enCacheValid = Disable;
+/* Internal write cycle started by the last page program not yet acknowledged */
+static en_functional_state_t m_enWriteCycleBusy = Disable;
+/* Bit of the page in that write cycle, made dirty again if the cycle is not acknowledged */
+static uint16_t m_u16CacheFlightPage = 0U;
+/* Write cycle timeout, started with the page program */
+static stc_ddl_deadline_t m_stcWriteCycleDeadline;
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -173,44 +195,48 @@ en_result_t BL24C02F_ReadBuf(uint8_t u8ReadAddr, uint8_t au8ReadBuf[], uint32_t
  *         @arg Ok:                 Write successfully
  *         @arg Error:              Write failed
  *         @arg ErrorTimeout:       Time out
+ *         @arg ErrorOperationInProgress: Write cycle of a cache flush not yet acknowledged,
+ *                                  call BL24C02F_CacheFlushPoll() until it is done
  * @note   This function don't check if the data write is whthin one page
+ * @note   When the cache is loaded, the data is also written into the shadow.
+ *         If the write fails, its pages are made dirty so the next flush programs them.
  */
 en_result_t BL24C02F_WritePage(uint8_t u8WriteAddr, const uint8_t au8WriteBuf[], uint32_t u32NumByte)
 {
     en_result_t enRet;
-    uint8_t u8MemAddrTemp = u8WriteAddr;
+    uint32_t u32Page;
 
     if((u8WriteAddr + u32NumByte) > BL24C02F_MEM_SIZE)
     {
         return Error;
     }
 
-    BSP_BL24C02F_I2C_Cmd(Enable);
-    BSP_BL24C02F_I2C_SWReset();
-
-    enRet = BSP_BL24C02F_I2C_Start();
-    if(Ok == enRet)
+    /* The device does not acknowledge during the write cycle */
+    if(Enable == m_enWriteCycleBusy)
     {
-        enRet = BSP_BL24C02F_I2C_TransAddr(BL24C02F_ADDR, I2C_DIR_TX);
-
-        if(Ok == enRet)
-        {
-            enRet = BSP_BL24C02F_I2C_TransData(&u8MemAddrTemp, 1U);
-            if(Ok == enRet)
-            {
-                enRet = BSP_BL24C02F_I2C_TransData(au8WriteBuf, u32NumByte);
-            }
-        }
+        return ErrorOperationInProgress;
     }
 
-    (void)BSP_BL24C02F_I2C_Stop();
-
-    BSP_BL24C02F_I2C_Cmd(Disable);
+    enRet = BL24C02F_PageProgram(u8WriteAddr, au8WriteBuf, u32NumByte);
 
     if(Ok != BL24C02F_I2C_WaitIdle())
     {
         enRet = ErrorTimeout;
     }
+
+    if((Enable == m_enCacheValid) && (0UL != u32NumByte))
+    {
+        (void)memcpy(&m_au8CacheData[u8WriteAddr], au8WriteBuf, u32NumByte);
+        if(Ok != enRet)
+        {
+            for(u32Page = (uint32_t)u8WriteAddr / BL24C02F_PAGE_SIZE;
+                u32Page <= (((uint32_t)u8WriteAddr + u32NumByte - 1UL) / BL24C02F_PAGE_SIZE);
+                u32Page++)
+            {
+                m_u16CacheDirtyPage |= (uint16_t)(1UL << u32Page);
+            }
+        }
+    }
     return enRet;
 }
 
@@ -223,6 +249,8 @@ en_result_t BL24C02F_WritePage(uint8_t u8WriteAddr, const uint8_t au8WriteBuf[],
  *         @arg Ok:                 Write successfully
  *         @arg Error:              Write failed
  *         @arg ErrorTimeout:       Time out
+ *         @arg ErrorOperationInProgress: Write cycle of a cache flush not yet acknowledged
+ * @note   The RAM shadow cache is kept up to date, see BL24C02F_WritePage().
  */
 en_result_t BL24C02F_WriteBuf(uint8_t u8WriteAddr, const uint8_t au8WriteBuf[], uint32_t u32NumByte)
 {
@@ -319,11 +347,217 @@ en_result_t BL24C02F_I2C_WaitIdle(void)
        if(BL24C02F_WAIT_TIMEOUT == u32Tmp++)
        {
            enRet = ErrorTimeout;
+           break;
        }
     }
     return enRet;
 }
 
+/**
+ * @brief  Load the whole BL24C02F array into the RAM shadow cache.
+ * @param  None
+ * @retval en_result_t              Enumeration value:
+ *         @arg Ok:                 Cache loaded
+ *         @arg Error:              Read failed
+ * @note   Any pending (not flushed) cache data is discarded.
+ */
+en_result_t BL24C02F_CacheInit(void)
+{
+    en_result_t enRet;
+
+    m_enCacheValid = Disable;
+    m_u16CacheDirtyPage = 0U;
+    m_enWriteCycleBusy = Disable;
+    m_u16CacheFlightPage = 0U;
+
+    enRet = BL24C02F_ReadBuf(0U, m_au8CacheData, BL24C02F_MEM_SIZE);
+    if(Ok == enRet)
+    {
+        m_enCacheValid = Enable;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Read block of data from the RAM shadow cache.
+ * @param  [in] u8ReadAddr:         The start address of the data to be read.
+ * @param  [in] au8ReadBuf:         The pointer to the buffer contains the data to be stored.
+ * @param  [in] u32NumByte:         Buffer size in byte.
+ * @retval en_result_t              Enumeration value:
+ *         @arg Ok:                 Read successfully
+ *         @arg Error:              Address out of range
+ *         @arg ErrorUninitialized: BL24C02F_CacheInit() not called or failed
+ */
+en_result_t BL24C02F_CacheRead(uint8_t u8ReadAddr, uint8_t au8ReadBuf[], uint32_t u32NumByte)
+{
+    if(Enable != m_enCacheValid)
+    {
+        return ErrorUninitialized;
+    }
+
+    if((u8ReadAddr + u32NumByte) > BL24C02F_MEM_SIZE)
+    {
+        return Error;
+    }
+
+    (void)memcpy(au8ReadBuf, &m_au8CacheData[u8ReadAddr], u32NumByte);
+    return Ok;
+}
+
+/**
+ * @brief  Write block of data into the RAM shadow cache.
+ * @param  [in] u8WriteAddr:        The start address of the data to be write.
+ * @param  [in] au8WriteBuf:        The pointer to the buffer contains the data to be write.
+ * @param  [in] u32NumByte:         Buffer size in byte.
+ * @retval en_result_t              Enumeration value:
+ *         @arg Ok:                 Write successfully
+ *         @arg Error:              Address out of range
+ *         @arg ErrorUninitialized: BL24C02F_CacheInit() not called or failed
+ * @note   No I2C transfer is done here. Only the pages whose content really
+ *         changes are marked dirty, BL24C02F_CacheFlushPoll() or
+ *         BL24C02F_CacheFlush() programs them.
+ */
+en_result_t BL24C02F_CacheWrite(uint8_t u8WriteAddr, const uint8_t au8WriteBuf[], uint32_t u32NumByte)
+{
+    uint32_t i;
+    uint32_t u32Addr = (uint32_t)u8WriteAddr;
+
+    if(Enable != m_enCacheValid)
+    {
+        return ErrorUninitialized;
+    }
+
+    if((u8WriteAddr + u32NumByte) > BL24C02F_MEM_SIZE)
+    {
+        return Error;
+    }
+
+    for(i = 0UL; i < u32NumByte; i++)
+    {
+        if(m_au8CacheData[u32Addr] != au8WriteBuf[i])
+        {
+            m_au8CacheData[u32Addr] = au8WriteBuf[i];
+            m_u16CacheDirtyPage |= (uint16_t)(1UL << (u32Addr / BL24C02F_PAGE_SIZE));
+        }
+        u32Addr++;
+    }
+    return Ok;
+}
+
+/**
+ * @brief  Advance the cache write-back by one step without blocking.
+ * @param  None
+ * @retval en_result_t                  Enumeration value:
+ *         @arg Ok:                     Cache is clean and the EEPROM is idle
+ *         @arg OperationInProgress:    A page program or write cycle is still pending,
+ *                                      call this function again later
+ *         @arg Error:                  Page program failed, the page stays dirty
+ *         @arg ErrorTimeout:           EEPROM did not acknowledge after the write cycle,
+ *                                      the page stays dirty
+ *         @arg ErrorUninitialized:     BL24C02F_CacheInit() not called or failed
+ * @note   Each call does at most one ACK poll or one page program, so it can be
+ *         called from the main loop or a periodic task. Several writes into the
+ *         same page between two flushes cost a single page program.
+ *         The write cycle times out BL24C02F_WRITE_CYCLE_TIMEOUT us after the page
+ *         program, however often this function is called.
+ */
+en_result_t BL24C02F_CacheFlushPoll(void)
+{
+    en_result_t enRet;
+    uint32_t u32Page;
+
+    if(Enable != m_enCacheValid)
+    {
+        return ErrorUninitialized;
+    }
+
+    /* ACK polling: the device does not acknowledge while programming */
+    if(Enable == m_enWriteCycleBusy)
+    {
+        if(Ok != BL24C02F_I2C_GetStatus())
+        {
+            if(Set == DDL_DeadlineIsExpired(&m_stcWriteCycleDeadline))
+            {
+                /* Write not confirmed: program the page again on the next flush */
+                m_u16CacheDirtyPage |= m_u16CacheFlightPage;
+                m_u16CacheFlightPage = 0U;
+                m_enWriteCycleBusy = Disable;
+                return ErrorTimeout;
+            }
+            return OperationInProgress;
+        }
+        m_u16CacheFlightPage = 0U;
+        m_enWriteCycleBusy = Disable;
+    }
+
+    if(0U == m_u16CacheDirtyPage)
+    {
+        return Ok;
+    }
+
+    for(u32Page = 0UL; u32Page < BL24C02F_PAGE_NUM; u32Page++)
+    {
+        if(0U != (m_u16CacheDirtyPage & (uint16_t)(1UL << u32Page)))
+        {
+            break;
+        }
+    }
+
+    enRet = BL24C02F_PageProgram((uint8_t)(u32Page * BL24C02F_PAGE_SIZE),
+                                 &m_au8CacheData[u32Page * BL24C02F_PAGE_SIZE],
+                                 BL24C02F_PAGE_SIZE);
+    if(Ok == enRet)
+    {
+        /* Cleared now so a cache write during the write cycle makes the page dirty again */
+        m_u16CacheFlightPage = (uint16_t)(1UL << u32Page);
+        m_u16CacheDirtyPage &= (uint16_t)(~(1UL << u32Page));
+        m_enWriteCycleBusy = Enable;
+        DDL_DeadlineStart(&m_stcWriteCycleDeadline, BL24C02F_WRITE_CYCLE_TIMEOUT);
+        enRet = OperationInProgress;
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Write all dirty pages of the cache back to the BL24C02F.
+ * @param  None
+ * @retval en_result_t              Enumeration value:
+ *         @arg Ok:                 Cache is clean and the EEPROM is idle
+ *         @arg Error:              Page program failed
+ *         @arg ErrorTimeout:       Time out
+ *         @arg ErrorUninitialized: BL24C02F_CacheInit() not called or failed
+ */
+en_result_t BL24C02F_CacheFlush(void)
+{
+    en_result_t enRet;
+
+    do
+    {
+        enRet = BL24C02F_CacheFlushPoll();
+    } while(OperationInProgress == enRet);
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the cache dirty status.
+ * @param  None
+ * @retval An en_flag_status_t enumeration value:
+ *         @arg Set:                Cache holds data not yet programmed, or the last
+ *                                  write cycle is not yet acknowledged
+ *         @arg Reset:              Cache and EEPROM are in sync
+ */
+en_flag_status_t BL24C02F_CacheGetDirtyStatus(void)
+{
+    en_flag_status_t enFlag = Reset;
+
+    if((0U != m_u16CacheDirtyPage) || (Enable == m_enWriteCycleBusy))
+    {
+        enFlag = Set;
+    }
+    return enFlag;
+}
+
 /**
  * @}
  */
@@ -368,6 +602,45 @@ static en_result_t BL24C02F_I2C_GetStatus(void)
     return enRet;
 }
 
+/**
+ * @brief  BL24C02F transfer one page of data, without waiting for the write cycle.
+ * @param  [in] u8WriteAddr:        The start address of the data to be write.
+ * @param  [in] au8WriteBuf:        The pointer to the buffer contains the data to be write.
+ * @param  [in] u32NumByte:         Buffer size in byte.
+ * @retval en_result_t              Enumeration value:
+ *         @arg Ok:                 Transfer successfully
+ *         @arg Error:              Transfer failed
+ *         @arg ErrorTimeout:       Time out
+ */
+static en_result_t BL24C02F_PageProgram(uint8_t u8WriteAddr, const uint8_t au8WriteBuf[], uint32_t u32NumByte)
+{
+    en_result_t enRet;
+    uint8_t u8MemAddrTemp = u8WriteAddr;
+
+    BSP_BL24C02F_I2C_Cmd(Enable);
+    BSP_BL24C02F_I2C_SWReset();
+
+    enRet = BSP_BL24C02F_I2C_Start();
+    if(Ok == enRet)
+    {
+        enRet = BSP_BL24C02F_I2C_TransAddr(BL24C02F_ADDR, I2C_DIR_TX);
+
+        if(Ok == enRet)
+        {
+            enRet = BSP_BL24C02F_I2C_TransData(&u8MemAddrTemp, 1U);
+            if(Ok == enRet)
+            {
+                enRet = BSP_BL24C02F_I2C_TransData(au8WriteBuf, u32NumByte);
+            }
+        }
+    }
+
+    (void)BSP_BL24C02F_I2C_Stop();
+
+    BSP_BL24C02F_I2C_Cmd(Disable);
+    return enRet;
+}
+
 /**
  * @}
  */
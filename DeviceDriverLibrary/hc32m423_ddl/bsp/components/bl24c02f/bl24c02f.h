@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Add RAM shadow cache with per-page dirty tracking
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -55,10 +56,12 @@ extern "C"
  * Global pre-processor symbols/macros ('#define')
  ******************************************************************************/
 /**
- * @defgroupBL24C02F_Global_Macros BL24C02F Global Macros
+ * @defgroup BL24C02F_Global_Macros BL24C02F Global Macros
  * @{
  */
-
+#define BL24C02F_PAGE_SIZE          (16U)
+#define BL24C02F_MEM_SIZE           (256UL)
+#define BL24C02F_PAGE_NUM           (BL24C02F_MEM_SIZE / BL24C02F_PAGE_SIZE)
 
 /**
  * @}
@@ -82,6 +85,14 @@ en_result_t BL24C02F_WritePage(uint8_t u8WriteAddr, const uint8_t au8WriteBuf[],
 en_result_t BL24C02F_WriteBuf(uint8_t u8WriteAddr, const uint8_t au8WriteBuf[], uint32_t u32NumByte);
 en_result_t BL24C02F_I2C_WaitIdle(void);
 
+/* RAM shadow cache */
+en_result_t BL24C02F_CacheInit(void);
+en_result_t BL24C02F_CacheRead(uint8_t u8ReadAddr, uint8_t au8ReadBuf[], uint32_t u32NumByte);
+en_result_t BL24C02F_CacheWrite(uint8_t u8WriteAddr, const uint8_t au8WriteBuf[], uint32_t u32NumByte);
+en_result_t BL24C02F_CacheFlushPoll(void);
+en_result_t BL24C02F_CacheFlush(void);
+en_flag_status_t BL24C02F_CacheGetDirtyStatus(void);
+
 /**
  * @}
  */
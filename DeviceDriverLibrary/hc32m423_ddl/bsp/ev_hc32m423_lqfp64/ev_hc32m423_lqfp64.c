@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Use CLK_SwitchSysclk() for the flash wait cycles
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -301,17 +302,11 @@ void BSP_CLK_Init(void)
     stcPLLInit.PLLCFGR_f.PLLSRC = CLK_PLLSRC_XTAL;
     (void)CLK_PLLInit(&stcPLLInit);
 
-    /* 3-wait @ 80MHz */
-    EFM_SetWaitCycle(EFM_WAIT_CYCLE3);
-    while(EFM_WAIT_CYCLE3 != READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT))
-    {
-        ;
-    }
-
     /* Enable High driver volatage */
     PWC_DynamicVoltageCmd(Enable);
 
-    CLK_SetSysclkSrc(CLK_SYSCLK_SRC_PLL);
+    /* 3-wait @ 80MHz, set before the switch */
+    (void)CLK_SwitchSysclk(CLK_SYSCLK_SRC_PLL, CLK_HCLK_DIV1, NULL);
 }
 
 /**
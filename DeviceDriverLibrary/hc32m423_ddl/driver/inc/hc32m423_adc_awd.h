@@ -0,0 +1,131 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_awd.h
+ * @brief This file contains all the functions prototypes of the ADC
+ *        threshold watch (analog watchdog emulation) driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_ADC_AWD_H__
+#define __HC32M423_ADC_AWD_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_ADC_AWD
+ * @{
+ */
+
+#if (DDL_ADC_AWD_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_AWD_Global_Types ADC_AWD Global Types
+ * @{
+ */
+
+/**
+ * @brief Window violation callback.
+ * @param [in] u16Value             Latest sample of the watched channel, right-aligned.
+ * @note  Called from the DCU interrupt. The watch is disarmed until
+ *        ADC_AWD_Rearm() is called.
+ */
+typedef void (*func_ptr_adc_awd_t)(uint16_t u16Value);
+
+/**
+ * @brief ADC threshold watch configuration structure
+ */
+typedef struct
+{
+    uint32_t u32Seq;                /*!< Sequence of the watched channel, @ref ADC_Sequence */
+    uint32_t u32ChNum;              /*!< Watched channel number, 0 ~ ADC_CH_NUM_MAX */
+    uint32_t u32DmaCh;              /*!< DMA channel, @ref DMA_Channel_selection */
+    uint16_t u16LowThreshold;       /*!< Lowest allowed code, right-aligned */
+    uint16_t u16HighThreshold;      /*!< Highest allowed code, right-aligned */
+    uint32_t u32IrqPriority;        /*!< Priority of the DCU interrupt, @ref INTC_Priority_Sel */
+    func_ptr_adc_awd_t pfnCallback; /*!< Window violation callback, may be NULL */
+} stc_adc_awd_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_AWD_Global_Functions
+ * @{
+ */
+en_result_t ADC_AWD_StructInit(stc_adc_awd_init_t *pstcInit);
+en_result_t ADC_AWD_Init(const stc_adc_awd_init_t *pstcInit);
+void ADC_AWD_DeInit(void);
+
+void ADC_AWD_Start(void);
+void ADC_AWD_Stop(void);
+en_result_t ADC_AWD_SetWindow(uint16_t u16LowThreshold, uint16_t u16HighThreshold);
+void ADC_AWD_Rearm(void);
+uint32_t ADC_AWD_GetViolationCount(void);
+
+void ADC_AWD_DCU_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_AWD_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_ADC_AWD_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
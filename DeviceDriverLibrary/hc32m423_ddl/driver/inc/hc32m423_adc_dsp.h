@@ -0,0 +1,205 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_dsp.h
+ * @brief This file contains all the functions prototypes of the fixed-point
+ *        DSP kernels for ADC sample buffers.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_ADC_DSP_H__
+#define __HC32M423_ADC_DSP_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_ADC_DSP
+ * @{
+ */
+
+#if (DDL_ADC_DSP_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_DSP_Global_Types ADC_DSP Global Types
+ * @{
+ */
+
+/**
+ * @brief ADC sample buffer descriptor
+ * @note  For a scan buffer such as the ADC_STREAM ping-pong buffer, point
+ *        pu16Data at the first sample of a channel and set u32Stride to the
+ *        scan length.
+ */
+typedef struct
+{
+    const uint16_t *pu16Data;       /*!< First sample */
+    uint32_t u32Len;                /*!< Number of samples, 1 ~ ADC_DSP_LEN_MAX */
+    uint32_t u32Stride;             /*!< Distance between samples in half words, 1 for contiguous */
+    uint32_t u32Shift;              /*!< Right shift that turns a sample into a right-aligned code */
+} stc_adc_dsp_buf_t;
+
+/**
+ * @brief Peak detection result
+ */
+typedef struct
+{
+    uint16_t u16Min;                /*!< Minimum code */
+    uint16_t u16Max;                /*!< Maximum code */
+    uint32_t u32MinIdx;             /*!< Index of the first minimum */
+    uint32_t u32MaxIdx;             /*!< Index of the first maximum */
+} stc_adc_dsp_peak_t;
+
+/**
+ * @brief Biquad IIR filter section, direct form I.
+ *        y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+ */
+typedef struct
+{
+    int16_t ai16Coef[5U];           /*!< b0, b1, b2, a1, a2 in Q14, a1 must not be -2.0 */
+    int16_t i16X1;                  /*!< State x[n-1] */
+    int16_t i16X2;                  /*!< State x[n-2] */
+    int16_t i16Y1;                  /*!< State y[n-1] */
+    int16_t i16Y2;                  /*!< State y[n-2] */
+} stc_adc_dsp_biquad_t;
+
+/**
+ * @brief Decimating FIR filter
+ */
+typedef struct
+{
+    const int16_t *pi16Coef;        /*!< Coefficients in Q15, applied in time order */
+    uint32_t u32TapNum;             /*!< Number of taps */
+    uint32_t u32Factor;             /*!< Decimation factor, 1 for no decimation */
+} stc_adc_dsp_fir_t;
+
+/**
+ * @brief Cycle counts of one pass of each kernel, see ADC_DSP_Benchmark()
+ */
+typedef struct
+{
+    uint32_t u32MeanVar;            /*!< ADC_DSP_MeanVar() */
+    uint32_t u32Rms;                /*!< ADC_DSP_Rms() */
+    uint32_t u32Peak;               /*!< ADC_DSP_Peak() */
+    uint32_t u32MovingAverage;      /*!< ADC_DSP_MovingAverage(), 8 sample window */
+    uint32_t u32Biquad;             /*!< ADC_DSP_Biquad() */
+    uint32_t u32FirDecimate;        /*!< ADC_DSP_FirDecimate(), 16 taps, factor 4 */
+} stc_adc_dsp_bench_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_DSP_Global_Macros ADC_DSP Global Macros
+ * @{
+ */
+
+/**
+ * @brief Kernel implementation.
+ *        ADC_DSP_USE_SIMD is 1 when the compiler targets the Cortex-M4 DSP
+ *        extension, otherwise the portable C kernels are built. Both give
+ *        bit identical results.
+ */
+#if !defined (ADC_DSP_USE_SIMD)
+#if defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define ADC_DSP_USE_SIMD                (1U)
+#else
+#define ADC_DSP_USE_SIMD                (0U)
+#endif
+#endif /* ADC_DSP_USE_SIMD */
+
+#define ADC_DSP_LEN_MAX                 (65536UL)   /*!< Keeps the 32-bit sums from overflowing */
+#define ADC_DSP_Q14_ONE                 (16384)
+#define ADC_DSP_Q15_ONE                 (32767)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_DSP_Global_Functions
+ * @{
+ */
+en_result_t ADC_DSP_BufInit(stc_adc_dsp_buf_t *pstcBuf, const uint16_t au16Data[],
+                            uint32_t u32Len, uint32_t u32Stride,
+                            uint16_t u16Resolution, uint16_t u16DataAlign);
+
+en_result_t ADC_DSP_MeanVar(const stc_adc_dsp_buf_t *pstcBuf, float32_t *pf32Mean, float32_t *pf32Var);
+float32_t ADC_DSP_Rms(const stc_adc_dsp_buf_t *pstcBuf);
+en_result_t ADC_DSP_Peak(const stc_adc_dsp_buf_t *pstcBuf, stc_adc_dsp_peak_t *pstcPeak);
+
+en_result_t ADC_DSP_MovingAverage(const stc_adc_dsp_buf_t *pstcBuf, uint32_t u32Win, uint16_t au16Out[]);
+
+en_result_t ADC_DSP_BiquadInit(stc_adc_dsp_biquad_t *pstcBiquad, const int16_t ai16Coef[]);
+en_result_t ADC_DSP_Biquad(stc_adc_dsp_biquad_t *pstcBiquad, const stc_adc_dsp_buf_t *pstcBuf, int16_t ai16Out[]);
+
+en_result_t ADC_DSP_FirDecimate(const stc_adc_dsp_fir_t *pstcFir, const stc_adc_dsp_buf_t *pstcBuf,
+                                int16_t ai16Out[], uint32_t *pu32OutLen);
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+en_result_t ADC_DSP_Benchmark(const stc_adc_dsp_buf_t *pstcBuf, int16_t ai16Work[],
+                              stc_adc_dsp_bench_t *pstcBench);
+#endif /* DDL_UTILITY_ENABLE */
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_DSP_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_ADC_DSP_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
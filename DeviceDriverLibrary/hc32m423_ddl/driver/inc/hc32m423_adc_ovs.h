@@ -0,0 +1,152 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_ovs.h
+ * @brief This file contains all the functions prototypes of the ADC
+ *        oversampling and decimation driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_ADC_OVS_H__
+#define __HC32M423_ADC_OVS_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+#include "hc32m423_adc.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_ADC_OVS
+ * @{
+ */
+
+#if (DDL_ADC_OVS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_OVS_Global_Types ADC_OVS Global Types
+ * @{
+ */
+
+/**
+ * @brief Output callback.
+ * @param [in] u32ChNum             Channel number, 0 ~ ADC_CH_NUM_MAX.
+ * @param [in] u16Value             Decimated value, ADC_OVS_GetBitDepth() bits, right-aligned.
+ * @note  Called from the ADC stream half buffer callback.
+ */
+typedef void (*func_ptr_adc_ovs_output_t)(uint32_t u32ChNum, uint16_t u16Value);
+
+/**
+ * @brief Per channel oversampling configuration
+ * @note  Each output sums u32Decimation stored samples and scales the sum by
+ *        2^u32ExtraBits / u32Decimation. u32Decimation must be at least
+ *        4^u32ExtraBits. The hardware averager returns the native resolution,
+ *        so it lowers the noise but does not count towards the extra bits.
+ */
+typedef struct
+{
+    uint32_t u32ExtraBits;          /*!< Bits added to the ADC resolution, 0 ~ ADC_OVS_EXTRA_BITS_MAX */
+    uint32_t u32Decimation;         /*!< Stored samples per output, 1 ~ ADC_OVS_DECIMATION_MAX.
+                                         Output rate = scan rate / u32Decimation */
+} stc_adc_ovs_ch_t;
+
+/**
+ * @brief ADC oversampling configuration structure
+ */
+typedef struct
+{
+    uint32_t u32Ch;                 /*!< Channels of the ADC stream, @ref ADC_Channel */
+    uint32_t u32AvgCh;              /*!< Channels that use the hardware averager, @ref ADC_Channel */
+    uint16_t u16AvgCount;           /*!< Hardware average count, @ref ADC_Average_Count */
+    stc_adc_ovs_ch_t astcCh[ADC_CH_NUM_MAX + 1U];   /*!< Indexed by channel number,
+                                                         only the channels of u32Ch are used */
+    func_ptr_adc_ovs_output_t pfnOutput;            /*!< Output callback, may be NULL */
+} stc_adc_ovs_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_OVS_Global_Macros ADC_OVS Global Macros
+ * @{
+ */
+#define ADC_OVS_EXTRA_BITS_MAX          (4UL)
+#define ADC_OVS_DECIMATION_MAX          (4096UL)
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_OVS_Global_Functions
+ * @{
+ */
+en_result_t ADC_OVS_StructInit(stc_adc_ovs_init_t *pstcInit);
+en_result_t ADC_OVS_Init(const stc_adc_ovs_init_t *pstcInit);
+void ADC_OVS_DeInit(void);
+void ADC_OVS_Reset(void);
+
+en_result_t ADC_OVS_GetValue(uint32_t u32ChNum, uint16_t *pu16Value);
+uint32_t ADC_OVS_GetBitDepth(uint32_t u32ChNum);
+
+void ADC_OVS_HalfCallback(uint32_t u32Half, const uint16_t au16Data[], uint32_t u32ScanNum);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_OVS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_ADC_OVS_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,166 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_prio.h
+ * @brief This file contains all the functions prototypes of the ADC
+ *        sequence A/B priority scheduler driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_ADC_PRIO_H__
+#define __HC32M423_ADC_PRIO_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+#include "hc32m423_adc.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_ADC_PRIO
+ * @{
+ */
+
+#if (DDL_ADC_PRIO_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_PRIO_Global_Types ADC_PRIO Global Types
+ * @{
+ */
+
+/**
+ * @brief Completed scan
+ */
+typedef struct
+{
+    const uint16_t *pu16Data;       /*!< Results in ascending channel order */
+    uint32_t u32ChCnt;              /*!< Number of results */
+    uint32_t u32Order;              /*!< Completion order over both sequences */
+    uint32_t u32PreemptCnt;         /*!< Background scans: number of times sequence B
+                                         interrupted this scan. Always 0 for sequence B */
+} stc_adc_prio_scan_t;
+
+/**
+ * @brief Scan complete callback.
+ * @param [in] pstcScan             Pointer to the completed scan.
+ * @note  Called from the end of conversion interrupt of the sequence.
+ */
+typedef void (*func_ptr_adc_prio_scan_t)(const stc_adc_prio_scan_t *pstcScan);
+
+/**
+ * @brief ADC priority scheduler configuration structure
+ */
+typedef struct
+{
+    uint32_t u32HpCh;               /*!< High priority channels on sequence B, @ref ADC_Channel */
+    const uint8_t *pu8HpSampleTime; /*!< Sampling time of each high priority channel, see ADC_ChCmd() */
+    stc_adc_trigger_config_t stcHpTrigger;  /*!< Trigger of the high priority bursts, e.g. a TMR4 event */
+    uint16_t *pu16HpBuf;            /*!< High priority ring, u32HpDepth scans of the u32HpCh channels */
+    uint32_t u32HpDepth;            /*!< Number of scans in the high priority ring, >= 1 */
+    uint32_t u32HpIrqPriority;      /*!< EOCB interrupt priority, @ref INTC_Priority_Sel */
+    func_ptr_adc_prio_scan_t pfnHpCallback; /*!< High priority scan callback, may be NULL */
+
+    uint32_t u32BgCh;               /*!< Background channels on sequence A, @ref ADC_Channel */
+    const uint8_t *pu8BgSampleTime; /*!< Sampling time of each background channel, see ADC_ChCmd() */
+    uint16_t *pu16BgBuf;            /*!< Background results, one scan of the u32BgCh channels */
+    uint32_t u32BgIrqPriority;      /*!< EOCA interrupt priority, lower than u32HpIrqPriority */
+    func_ptr_adc_prio_scan_t pfnBgCallback; /*!< Background scan callback, may be NULL */
+
+    uint16_t u16SAResumePos;        /*!< Resume position after a preemption,
+                                         @ref ADC_Sequence_A_Resume_Channel_Position */
+    uint32_t u32MaxRestart;         /*!< With ADC_SA_RESUME_POS_FIRST_CH, number of preemptions
+                                         after which a background scan resumes from the interrupted
+                                         channel instead of restarting, so that it always completes */
+} stc_adc_prio_init_t;
+
+/**
+ * @brief Scheduler statistics
+ */
+typedef struct
+{
+    uint32_t u32HpScanCnt;          /*!< Completed high priority scans */
+    uint32_t u32BgScanCnt;          /*!< Completed background scans */
+    uint32_t u32NestedCnt;          /*!< Background scans interrupted by sequence B */
+    uint32_t u32MaxPreemptCnt;      /*!< Most preemptions seen by one background scan */
+} stc_adc_prio_stat_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_PRIO_Global_Functions
+ * @{
+ */
+en_result_t ADC_PRIO_StructInit(stc_adc_prio_init_t *pstcInit);
+en_result_t ADC_PRIO_Init(const stc_adc_prio_init_t *pstcInit);
+void ADC_PRIO_DeInit(void);
+
+void ADC_PRIO_Start(void);
+void ADC_PRIO_Stop(void);
+en_result_t ADC_PRIO_TriggerBackground(void);
+en_result_t ADC_PRIO_GetStatistics(stc_adc_prio_stat_t *pstcStat);
+
+void ADC_PRIO_SeqA_IrqHandler(void);
+void ADC_PRIO_SeqB_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_PRIO_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_ADC_PRIO_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
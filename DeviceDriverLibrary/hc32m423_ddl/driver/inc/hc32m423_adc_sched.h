@@ -0,0 +1,149 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_sched.h
+ * @brief This file contains all the functions prototypes of the timer paced
+ *        ADC acquisition scheduler driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_ADC_SCHED_H__
+#define __HC32M423_ADC_SCHED_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+#include "hc32m423_adc_stream.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_ADC_SCHED
+ * @{
+ */
+
+#if (DDL_ADC_SCHED_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SCHED_Global_Types ADC_SCHED Global Types
+ * @{
+ */
+
+/**
+ * @brief ADC acquisition scheduler configuration structure
+ */
+typedef struct
+{
+    uint32_t u32Ch;                 /*!< Channels of sequence A, @ref ADC_Channel */
+    const uint8_t *pu8SampleTime;   /*!< Sampling time of each channel, see ADC_ChCmd() */
+    uint32_t u32SampleRate;         /*!< Requested scan rate in Hz */
+    CM_TMR0_TypeDef *pstcTmr0;      /*!< Pacing timer unit, CM_TMR0_1 or CM_TMR0_2 */
+    uint32_t u32Tmr0Ch;             /*!< Pacing timer channel, @ref TMR0_Channel_Index */
+    stc_adc_stream_init_t stcStream;    /*!< Data path, u32Ch is overwritten by the
+                                             scheduler, see stc_adc_stream_init_t */
+    uint32_t u32TsDmaCh;            /*!< DMA channel for scan timestamps, @ref DMA_Channel_selection
+                                         or ADC_SCHED_DMA_NONE */
+    uint16_t *pu16TsBuf;            /*!< Timestamp ring buffer, u32TsNum half words */
+    uint32_t u32TsNum;              /*!< Timestamp ring length, 1 ~ ADC_SCHED_TS_NUM_MAX */
+} stc_adc_sched_init_t;
+
+/**
+ * @brief Sampling latency statistics, from the timer trigger to the end of
+ *        the scan, over the scans held in the timestamp ring.
+ */
+typedef struct
+{
+    uint32_t u32ScanNum;            /*!< Number of scans measured */
+    uint32_t u32MinNs;              /*!< Minimum trigger to end of scan latency */
+    uint32_t u32MaxNs;              /*!< Maximum trigger to end of scan latency */
+    uint32_t u32MeanNs;             /*!< Mean trigger to end of scan latency */
+    uint32_t u32JitterNs;           /*!< Peak to peak jitter, u32MaxNs - u32MinNs */
+    uint32_t u32ResolutionNs;       /*!< Resolution of the measurement, one timer count */
+} stc_adc_sched_jitter_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SCHED_Global_Macros ADC_SCHED Global Macros
+ * @{
+ */
+#define ADC_SCHED_DMA_NONE              (0xFFFFFFFFUL)  /*!< No timestamp capture */
+#define ADC_SCHED_TS_NUM_MAX            (255UL)
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_SCHED_Global_Functions
+ * @{
+ */
+en_result_t ADC_SCHED_StructInit(stc_adc_sched_init_t *pstcInit);
+en_result_t ADC_SCHED_Init(const stc_adc_sched_init_t *pstcInit);
+void ADC_SCHED_DeInit(void);
+
+void ADC_SCHED_Start(void);
+void ADC_SCHED_Stop(void);
+
+float32_t ADC_SCHED_GetActualRate(void);
+en_result_t ADC_SCHED_GetJitter(stc_adc_sched_jitter_t *pstcJitter);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_SCHED_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_ADC_SCHED_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
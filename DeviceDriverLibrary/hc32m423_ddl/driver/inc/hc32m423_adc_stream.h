@@ -0,0 +1,153 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_stream.h
+ * @brief This file contains all the functions prototypes of the ADC DMA
+ *        streaming driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_ADC_STREAM_H__
+#define __HC32M423_ADC_STREAM_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_ADC_STREAM
+ * @{
+ */
+
+#if (DDL_ADC_STREAM_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_STREAM_Global_Types ADC_STREAM Global Types
+ * @{
+ */
+
+/**
+ * @brief Half buffer complete callback.
+ * @param [in] u32Half              Index of the completed half, 0 or 1.
+ * @param [in] au16Data             First scan of the completed half.
+ * @param [in] u32ScanNum           Number of scans in the half.
+ * @note  Called from the DMA transfer complete interrupt. The other half is
+ *        being filled meanwhile, so au16Data stays valid for one half period.
+ */
+typedef void (*func_ptr_adc_stream_half_t)(uint32_t u32Half, const uint16_t au16Data[], uint32_t u32ScanNum);
+
+/**
+ * @brief ADC stream configuration structure
+ */
+typedef struct
+{
+    uint32_t u32Ch;                 /*!< Channels of sequence A, @ref ADC_Channel. Each scan
+                                         stores the data registers from the lowest to the
+                                         highest of these channels. */
+    uint32_t u32DmaCh;              /*!< DMA channel, @ref DMA_Channel_selection */
+    uint16_t *pu16Buf;              /*!< Ping-pong buffer, ADC_STREAM_BUF_LEN() half words */
+    uint32_t u32ScanPerHalf;        /*!< Number of scans per half buffer, 1 ~ 1023 */
+    uint32_t u32IrqPriority;        /*!< Priority of the DMA transfer complete interrupt,
+                                         @ref INTC_Priority_Sel */
+    func_ptr_adc_stream_half_t pfnHalfCallback; /*!< Half buffer complete callback */
+} stc_adc_stream_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_STREAM_Global_Macros ADC_STREAM Global Macros
+ * @{
+ */
+
+#define ADC_STREAM_SCAN_PER_HALF_MAX    (1023UL)
+
+/**
+ * @brief Ping-pong buffer length in half words.
+ * @param scan_len                  Scan length, see ADC_STREAM_GetScanLen().
+ * @param scan_per_half             Number of scans per half buffer.
+ */
+#define ADC_STREAM_BUF_LEN(scan_len, scan_per_half)     (2UL * (scan_len) * (scan_per_half))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_STREAM_Global_Functions
+ * @{
+ */
+en_result_t ADC_STREAM_StructInit(stc_adc_stream_init_t *pstcInit);
+en_result_t ADC_STREAM_Init(const stc_adc_stream_init_t *pstcInit);
+void ADC_STREAM_DeInit(void);
+
+void ADC_STREAM_Start(void);
+void ADC_STREAM_Stop(void);
+
+uint32_t ADC_STREAM_GetScanLen(uint32_t u32Ch);
+uint32_t ADC_STREAM_GetChOffset(uint32_t u32ChNum);
+uint32_t ADC_STREAM_GetOverrunCount(void);
+
+void ADC_STREAM_DmaTc_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_STREAM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_ADC_STREAM_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
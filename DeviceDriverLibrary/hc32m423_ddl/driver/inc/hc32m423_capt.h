@@ -0,0 +1,184 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_capt.h
+ * @brief This file contains all the functions prototypes of the DMA
+ *        buffered input capture driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_CAPT_H__
+#define __HC32M423_CAPT_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_CAPT
+ * @{
+ */
+
+#if (DDL_CAPT_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup CAPT_Global_Types CAPT Global Types
+ * @{
+ */
+
+/**
+ * @brief DMA buffered input capture configuration structure
+ */
+typedef struct
+{
+    uint32_t u32Unit;               /*!< Capture timer, @ref CAPT_Unit */
+    uint32_t u32Ch;                 /*!< Capture channel: TMRB_CH1 ~ TMRB_CH4, or TMRA_CH1
+                                         (TMRA_CH2 also for CAPT_UNIT_TMRA_3_4) of the low unit */
+    uint16_t u16ClockDiv;           /*!< Count clock, @ref TMRB_Count_Clock_Division or
+                                         @ref TMRA_Clock_Division */
+    uint32_t u32Mode;               /*!< Measurement, @ref CAPT_Mode */
+    uint8_t u8Port;                 /*!< GPIO port of the input, read at start in CAPT_MD_PULSE */
+    uint8_t u8Pin;                  /*!< GPIO pin of the input, read at start in CAPT_MD_PULSE */
+    uint32_t u32DmaCh;              /*!< DMA channel of the capture values, @ref DMA_Channel_selection */
+    uint32_t u32DmaChHigh;          /*!< DMA channel of the high unit, TMRA pairs only */
+    uint16_t *pu16Buf;              /*!< Capture ring, u32BufLen half words */
+    uint16_t *pu16BufHigh;          /*!< Capture ring of the high unit, TMRA pairs only */
+    uint32_t u32BufLen;             /*!< Ring length, 2 ~ CAPT_BUF_LEN_MAX */
+    uint32_t *pu32Hist;             /*!< Histogram of the pulse width (CAPT_MD_PULSE) or the
+                                         period (CAPT_MD_PERIOD), NULL for none */
+    uint32_t u32HistBinNum;         /*!< Number of bins, the first and last also take
+                                         the values below and above the range */
+    uint32_t u32HistMin;            /*!< Lower bound of the first bin in counts */
+    uint32_t u32HistBinWidth;       /*!< Bin width in counts, not 0 */
+    uint32_t u32IrqPriority;        /*!< Priority of the DMA transfer complete interrupt,
+                                         @ref INTC_Priority_Sel */
+} stc_capt_init_t;
+
+/**
+ * @brief Result of one batch, see CAPT_Process()
+ */
+typedef struct
+{
+    uint32_t u32EdgeNum;            /*!< Number of edges processed */
+    uint32_t u32PeriodNum;          /*!< Number of complete periods ending in the batch */
+    float32_t f32Freq;              /*!< Mean frequency in Hz, 0 without a period */
+    float32_t f32Duty;              /*!< Mean high duty, 0.0 ~ 1.0, CAPT_MD_PULSE only */
+    uint32_t u32MinPeriod;          /*!< Shortest period in counts */
+    uint32_t u32MaxPeriod;          /*!< Longest period in counts */
+    uint32_t u32MinWidth;           /*!< Shortest high pulse in counts, CAPT_MD_PULSE only */
+    uint32_t u32MaxWidth;           /*!< Longest high pulse in counts, CAPT_MD_PULSE only */
+    uint32_t u32OverrunCnt;         /*!< Edges overwritten before processing, since CAPT_Start() */
+} stc_capt_result_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup CAPT_Global_Macros CAPT Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup CAPT_Unit CAPT Unit
+ * @{
+ */
+#define CAPT_UNIT_TMRB                  (0UL)   /*!< TMRB, 16-bit: periods must be shorter than 65536 counts */
+#define CAPT_UNIT_TMRA_1_2              (1UL)   /*!< CM_TMRA_1 counts, CM_TMRA_2 counts its overflows, 32-bit */
+#define CAPT_UNIT_TMRA_3_4              (2UL)   /*!< CM_TMRA_3 counts, CM_TMRA_4 counts its overflows, 32-bit */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup CAPT_Mode CAPT Mode
+ * @{
+ */
+#define CAPT_MD_PERIOD                  (0UL)   /*!< Rising edges: frequency and period */
+#define CAPT_MD_PULSE                   (1UL)   /*!< Both edges: frequency, duty and pulse width */
+/**
+ * @}
+ */
+
+#define CAPT_BUF_LEN_MAX                (1023UL)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup CAPT_Global_Functions
+ * @{
+ */
+en_result_t CAPT_StructInit(stc_capt_init_t *pstcInit);
+en_result_t CAPT_Init(const stc_capt_init_t *pstcInit);
+void CAPT_DeInit(void);
+
+void CAPT_Start(void);
+void CAPT_Stop(void);
+
+en_result_t CAPT_Process(stc_capt_result_t *pstcResult);
+uint32_t CAPT_GetFreq(void);
+
+void CAPT_DmaTc_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_CAPT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_CAPT_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
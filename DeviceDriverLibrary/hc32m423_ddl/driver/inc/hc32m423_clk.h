@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Add CLK_SwitchSysclk() with flash wait cycle and cache tuning
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -135,6 +136,16 @@ typedef struct
     uint32_t pllp;                 /*!< pllp clock frequency. */
 } stc_pll_clock_freq_t;
 
+/**
+ * @brief  Flash read configuration after a system clock switch.
+ */
+typedef struct
+{
+    uint32_t u32HclkFreq;          /*!< Hclk frequency. */
+    uint32_t u32WaitCycle;         /*!< Flash read wait cycles, a value of @ref EFM_Wait_Cycle. */
+    uint32_t u32Cache;             /*!< Enabled flash caches, EFM_FRMC_ICHE and EFM_FRMC_DCHE bits. */
+} stc_clock_flash_cfg_t;
+
 /**
  * @}
  */
@@ -493,6 +504,16 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup CLK_Flash_Wait Flash read wait cycles for Hclk
+ * @{
+ */
+#define CLK_FLASH_WAIT_FREQ_STEP    (20UL*1000UL*1000UL)  /*!< Hclk range covered by one wait cycle */
+#define CLK_FLASH_WAIT_MAX          (7UL)
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -533,6 +554,8 @@ en_flag_status_t CLK_GetStableStatus(uint8_t u8StableFlag);
 
 void CLK_SetSysclkSrc(uint8_t u8Src);
 void CLK_ClockDiv(uint8_t u8ClockCate, uint32_t u32Div);
+en_result_t CLK_SwitchSysclk(uint8_t u8Src, uint32_t u32HclkDiv, stc_clock_flash_cfg_t *pstcFlashCfg);
+uint32_t CLK_GetFlashWaitCycle(uint32_t u32HclkFreq);
 
 void CLK_TpiuClockCmd(en_functional_state_t enNewState);
 void CLK_TpiuClockConfig(uint8_t u8TpiuDiv);
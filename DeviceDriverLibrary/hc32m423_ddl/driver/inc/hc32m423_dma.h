@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Add DMA_GetTransCount(), DMA_GetSrcAddr() and DMA_GetDestAddr()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -373,6 +374,9 @@ void DMA_SetSrcAddr(CM_DMA_TypeDef *DMAx, uint32_t u32Ch, uint32_t u32Addr);
 void DMA_SetDestAddr(CM_DMA_TypeDef *DMAx, uint32_t u32Ch, uint32_t u32Addr);
 void DMA_SetBlockSize(CM_DMA_TypeDef *DMAx, uint32_t u32Ch, uint8_t u8Size);
 void DMA_SetTransCount(CM_DMA_TypeDef *DMAx, uint32_t u32Ch, uint16_t u16Count);
+uint16_t DMA_GetTransCount(const CM_DMA_TypeDef *DMAx, uint32_t u32Ch);
+uint32_t DMA_GetSrcAddr(const CM_DMA_TypeDef *DMAx, uint32_t u32Ch);
+uint32_t DMA_GetDestAddr(const CM_DMA_TypeDef *DMAx, uint32_t u32Ch);
 
 en_result_t DMA_StructInit(stc_dma_init_t *pstcDmaInit);
 en_result_t DMA_RepeatStructInit(stc_dma_repeat_init_t *pstcDmaRptInit);
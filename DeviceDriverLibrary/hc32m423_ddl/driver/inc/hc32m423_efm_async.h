@@ -0,0 +1,169 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_efm_async.h
+ * @brief This file contains all the functions prototypes of the interrupt
+ *        driven EFM program and erase jobs.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_EFM_ASYNC_H__
+#define __HC32M423_EFM_ASYNC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_EFM_ASYNC
+ * @{
+ */
+
+#if (DDL_EFM_ASYNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_ASYNC_Global_Types EFM_ASYNC Global Types
+ * @{
+ */
+
+/**
+ * @brief Job progress callback, called from the interrupt.
+ * @param [in] u32Done              Bytes erased or programmed.
+ * @param [in] u32Total             Bytes of the job.
+ */
+typedef void (*func_ptr_efm_async_progress_t)(uint32_t u32Done, uint32_t u32Total);
+
+/**
+ * @brief Job completion callback, called from the interrupt.
+ * @param [in] enResult             Ok, Error for a flash error, ErrorNotReady for an aborted job.
+ */
+typedef void (*func_ptr_efm_async_done_t)(en_result_t enResult);
+
+/**
+ * @brief EFM job configuration structure
+ */
+typedef struct
+{
+    uint32_t u32BusStatus;          /*!< Bus status during the steps issued from the interrupt, @ref EFM_Bus_Status.
+                                         The first step, issued by EFM_ASYNC_Start(), holds the bus.
+                                         EFM_BUS_RELEASE applies only while the EFM_OpEnd vector points to
+                                         EFM_ASYNC_OpEnd_IrqHandler(), and the interrupted context must run
+                                         from RAM or from the cache */
+    uint32_t u32IrqPriority;        /*!< Priority of the EFM interrupts, @ref INTC_Priority_Sel */
+} stc_efm_async_init_t;
+
+/**
+ * @brief EFM job
+ */
+typedef struct
+{
+    uint32_t u32Op;                 /*!< Operation, @ref EFM_ASYNC_Operation */
+    uint32_t u32Addr;               /*!< Flash address, word aligned */
+    uint32_t u32Size;               /*!< Size in bytes, a multiple of 4. An erase covers the sectors
+                                         of the range */
+    const uint32_t *pu32Data;       /*!< Data to program, in RAM or in flash outside the job range,
+                                         valid until the job is done */
+    func_ptr_efm_async_progress_t pfnProgress;  /*!< Called after each sector, may be NULL */
+    func_ptr_efm_async_done_t pfnDone;          /*!< Called at the end of the job, may be NULL */
+} stc_efm_async_job_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_ASYNC_Global_Macros EFM_ASYNC Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup EFM_ASYNC_Operation EFM job operation
+ * @{
+ */
+#define EFM_ASYNC_OP_ERASE              (0x01UL)    /*!< Erase the sectors of the range */
+#define EFM_ASYNC_OP_PROGRAM            (0x02UL)    /*!< Program the range */
+#define EFM_ASYNC_OP_UPDATE             (EFM_ASYNC_OP_ERASE | EFM_ASYNC_OP_PROGRAM) /*!< Erase, then program */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup EFM_ASYNC_Global_Functions
+ * @{
+ */
+en_result_t EFM_ASYNC_StructInit(stc_efm_async_init_t *pstcInit);
+en_result_t EFM_ASYNC_Init(const stc_efm_async_init_t *pstcInit);
+void EFM_ASYNC_DeInit(void);
+
+en_result_t EFM_ASYNC_Start(const stc_efm_async_job_t *pstcJob);
+void EFM_ASYNC_Abort(void);
+en_flag_status_t EFM_ASYNC_IsBusy(void);
+en_result_t EFM_ASYNC_GetResult(void);
+
+void EFM_ASYNC_OpEnd_IrqHandler(void);
+void EFM_ASYNC_PeErr_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_EFM_ASYNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_EFM_ASYNC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
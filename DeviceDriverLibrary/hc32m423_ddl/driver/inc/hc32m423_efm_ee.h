@@ -0,0 +1,166 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_efm_ee.h
+ * @brief This file contains all the functions prototypes of the EEPROM
+ *        emulation on the internal flash.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_EFM_EE_H__
+#define __HC32M423_EFM_EE_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_EFM_EE
+ * @{
+ */
+
+#if (DDL_EFM_EE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_EE_Global_Types EFM_EE Global Types
+ * @{
+ */
+
+/**
+ * @brief Flash access functions.
+ * @note  Replacement functions must follow the EFM rules: an erase
+ *        sets a whole EFM_EE_SECTOR_SIZE sector to 0xFF, a word is programmed
+ *        once after the erase, and program returns Error when the word read
+ *        back differs from the data, as EFM_Program32() does.
+ */
+typedef struct
+{
+    en_result_t (*pfnProgram)(uint32_t u32Addr, uint32_t u32Data);  /*!< Program one word */
+    en_result_t (*pfnErase)(uint32_t u32Addr);                      /*!< Erase the sector of an address */
+    uint32_t (*pfnRead)(uint32_t u32Addr);                          /*!< Read one word */
+} stc_efm_ee_flash_t;
+
+/**
+ * @brief EEPROM emulation configuration structure
+ */
+typedef struct
+{
+    uint32_t u32StartAddr;          /*!< First sector of the area, EFM_EE_SECTOR_SIZE aligned */
+    uint32_t u32SectorNum;          /*!< Number of sectors, 2 ~ EFM_EE_SECTOR_NUM_MAX, one is kept
+                                         free for the compaction */
+    uint16_t *pu16Index;            /*!< RAM index, u32KeyNum half words */
+    uint32_t u32KeyNum;             /*!< Number of keys, keys are 0 ~ u32KeyNum - 1 */
+    const stc_efm_ee_flash_t *pstcFlash;    /*!< Flash access, NULL for the EFM driver */
+} stc_efm_ee_init_t;
+
+/**
+ * @brief EEPROM emulation status
+ */
+typedef struct
+{
+    uint32_t u32KeyCount;           /*!< Keys with a value */
+    uint32_t u32LiveBytes;          /*!< Flash used by the current values, record overhead included */
+    uint32_t u32FreeBytes;          /*!< Flash free for records without a compaction */
+    uint32_t u32SectorCycle;        /*!< Sectors taken into use since the format, the erase count of
+                                         each sector is about u32SectorCycle / u32SectorNum */
+} stc_efm_ee_status_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_EE_Global_Macros EFM_EE Global Macros
+ * @{
+ */
+#define EFM_EE_SECTOR_SIZE              (0x200UL)   /*!< EFM sector size */
+#define EFM_EE_SECTOR_NUM_MAX           (256UL)     /*!< The whole flash */
+#define EFM_EE_KEY_NUM_MAX              (0xFFFFUL)
+#define EFM_EE_DATA_MAX                 (255UL)     /*!< Maximum value length in bytes */
+
+/**
+ * @brief Flash used by a value of u32Len bytes: header, data and CRC words.
+ */
+#define EFM_EE_RECORD_SIZE(u32Len)      ((((u32Len) + 3UL) & ~3UL) + 8UL)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup EFM_EE_Global_Functions
+ * @{
+ */
+en_result_t EFM_EE_StructInit(stc_efm_ee_init_t *pstcInit);
+en_result_t EFM_EE_Init(const stc_efm_ee_init_t *pstcInit);
+void EFM_EE_DeInit(void);
+en_result_t EFM_EE_Format(void);
+
+en_result_t EFM_EE_Read(uint16_t u16Key, uint8_t au8Buf[], uint32_t u32Size, uint32_t *pu32Len);
+en_result_t EFM_EE_Write(uint16_t u16Key, const uint8_t au8Data[], uint32_t u32Len);
+en_result_t EFM_EE_Delete(uint16_t u16Key);
+uint32_t EFM_EE_GetLen(uint16_t u16Key);
+
+en_result_t EFM_EE_Compact(void);
+en_result_t EFM_EE_GetStatus(stc_efm_ee_status_t *pstcStatus);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_EFM_EE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_EFM_EE_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
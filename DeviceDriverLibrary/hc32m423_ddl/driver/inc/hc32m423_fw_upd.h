@@ -0,0 +1,173 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_fw_upd.h
+ * @brief This file contains all the functions prototypes of the A/B firmware
+ *        update manager.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_FW_UPD_H__
+#define __HC32M423_FW_UPD_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_FW_UPD
+ * @{
+ */
+
+#if (DDL_FW_UPD_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup FW_UPD_Global_Types FW_UPD Global Types
+ * @{
+ */
+
+/**
+ * @brief Flash layout
+ * @note  All addresses are sector aligned and the areas must not overlap the
+ *        bootloader or each other. An image is linked for the address of its
+ *        slot.
+ */
+typedef struct
+{
+    uint32_t u32MetaAddr;                       /*!< Two sectors for the boot records */
+    uint32_t au32SlotAddr[2U];                  /*!< Slot A and slot B */
+    uint32_t u32SlotSize;                       /*!< Size of each slot in bytes, a multiple of the sector size */
+} stc_fw_upd_init_t;
+
+/**
+ * @brief Boot and update state
+ */
+typedef struct
+{
+    uint32_t u32ConfirmedSlot;                  /*!< Slot of the confirmed image, FW_UPD_SLOT_NONE before
+                                                     the first update (factory image in slot A) */
+    uint32_t u32TrialSlot;                      /*!< Slot of the image on trial, FW_UPD_SLOT_NONE if none */
+    uint32_t u32TrialBooted;                    /*!< 1 if the trial image has been booted */
+    uint32_t u32UpdateSlot;                     /*!< Slot being written, FW_UPD_SLOT_NONE if no update */
+    uint32_t u32ImageSize;                      /*!< Size of the image being written */
+    uint32_t u32Received;                       /*!< Bytes received of the image being written */
+} stc_fw_upd_status_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup FW_UPD_Global_Macros FW_UPD Global Macros
+ * @{
+ */
+#define FW_UPD_SECTOR_SIZE              (0x200UL)
+#define FW_UPD_CHUNK_SIZE               (FW_UPD_SECTOR_SIZE)    /*!< Bytes erased and programmed per flash job */
+
+/**
+ * @defgroup FW_UPD_Slot FW_UPD Slot
+ * @{
+ */
+#define FW_UPD_SLOT_A                   (0UL)
+#define FW_UPD_SLOT_B                   (1UL)
+#define FW_UPD_SLOT_NONE                (0xFFUL)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup FW_UPD_Default_Layout FW_UPD Default Layout
+ * @brief 8KB bootloader, two record sectors and two 59.5KB slots in the 128KB flash
+ * @{
+ */
+#define FW_UPD_DEFAULT_META_ADDR        (0x00002000UL)
+#define FW_UPD_DEFAULT_SLOT_A_ADDR      (0x00002400UL)
+#define FW_UPD_DEFAULT_SLOT_B_ADDR      (0x00011200UL)
+#define FW_UPD_DEFAULT_SLOT_SIZE        (0x0000EE00UL)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup FW_UPD_Global_Functions
+ * @{
+ */
+en_result_t FW_UPD_StructInit(stc_fw_upd_init_t *pstcInit);
+en_result_t FW_UPD_Init(const stc_fw_upd_init_t *pstcInit);
+
+en_result_t FW_UPD_BootSelect(uint32_t *pu32Slot);
+en_result_t FW_UPD_Jump(uint32_t u32Slot);
+en_result_t FW_UPD_Confirm(void);
+
+en_result_t FW_UPD_Begin(uint32_t u32ImageSize);
+en_result_t FW_UPD_Write(const uint8_t au8Data[], uint32_t u32Len);
+uint32_t FW_UPD_GetWriteSpace(void);
+en_result_t FW_UPD_Finish(uint32_t u32ImageCrc);
+void FW_UPD_Abort(void);
+
+en_result_t FW_UPD_GetStatus(stc_fw_upd_status_t *pstcStatus);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_FW_UPD_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_FW_UPD_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
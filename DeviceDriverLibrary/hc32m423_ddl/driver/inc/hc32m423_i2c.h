@@ -8,6 +8,7 @@
    Date             Author          Notes
    2020-09-15       CDT             First version
    2020-11-16       CDT             Fix bug and optimize code for I2C driver and example
+   2026-10-18       CDT             Add SMBus PEC calculation and block read/write functions
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -144,6 +145,16 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup I2C_Smbus_Pec I2C Smbus packet error code
+ * @{
+ */
+#define I2C_SMBUS_PEC_INIT            (0x00U)   /*!< Initial value of the PEC (CRC-8, x^8 + x^2 + x + 1) */
+#define I2C_SMBUS_BLOCK_MAX           (255U)    /*!< Maximum byte count of a block transfer */
+/**
+ * @}
+ */
+
 /**
  * @defgroup I2C_Digital_Filter_Clock I2C digital filter Clock
  * @{
@@ -264,6 +275,15 @@ en_result_t I2C_MasterReceiveDataAndStop(CM_I2C_TypeDef* I2Cx, uint8_t au8RxData
 en_result_t I2C_Stop(CM_I2C_TypeDef* I2Cx, uint32_t u32Timeout);
 en_result_t I2C_WaitStatus(const CM_I2C_TypeDef *I2Cx, uint32_t u32Flag, en_flag_status_t enStatus, uint32_t u32Timeout);
 
+/* Smbus packet error checking ***************************************/
+uint8_t I2C_SmbusPecCalculate(uint8_t u8Pec, const uint8_t au8Data[], uint32_t u32Len);
+en_result_t I2C_SmbusBlockWrite(CM_I2C_TypeDef* I2Cx, uint16_t u16Addr, uint8_t u8Cmd,
+                                const uint8_t au8Data[], uint8_t u8Len,
+                                en_functional_state_t enPec, uint32_t u32Timeout);
+en_result_t I2C_SmbusBlockRead(CM_I2C_TypeDef* I2Cx, uint16_t u16Addr, uint8_t u8Cmd,
+                               uint8_t au8Data[], uint8_t u8MaxLen, uint8_t *pu8Len,
+                               en_functional_state_t enPec, uint32_t u32Timeout);
+
 /**
  * @}
  */
@@ -0,0 +1,174 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_i2c_regmap.h
+ * @brief This file contains all the functions prototypes of the I2C slave
+ *        register map driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_I2C_REGMAP_H__
+#define __HC32M423_I2C_REGMAP_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_I2C_REGMAP
+ * @{
+ */
+
+#if (DDL_I2C_REGMAP_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_REGMAP_Global_Types I2C_REGMAP Global Types
+ * @{
+ */
+
+/**
+ * @brief Register write notification callback.
+ * @param [in] u8StartReg           First register written by the master.
+ * @param [in] u32Len               Number of consecutive registers written.
+ */
+typedef void (*func_ptr_i2c_regmap_write_t)(uint8_t u8StartReg, uint32_t u32Len);
+
+/**
+ * @brief Register access region
+ */
+typedef struct
+{
+    uint8_t  u8StartReg;            /*!< First register of the region */
+    uint8_t  u8EndReg;              /*!< Last register of the region (inclusive) */
+    uint32_t u32Access;             /*!< Access of the region, @ref I2C_REGMAP_Access */
+} stc_i2c_regmap_region_t;
+
+/**
+ * @brief I2C slave register map configuration structure
+ */
+typedef struct
+{
+    uint32_t u32SlaveAddr;          /*!< 7-bit slave address */
+    uint32_t u32Baudrate;           /*!< Bus baudrate, used for the I2C timing settings */
+    uint32_t u32ClockDiv;           /*!< I2C clock division for Pclk1, @ref I2C_Clock_Division */
+    uint8_t *pu8RegFile;            /*!< Register file, u32RegNum bytes */
+    uint32_t u32RegNum;             /*!< Number of registers (1 ~ 256) */
+    const stc_i2c_regmap_region_t *pstcRegion;  /*!< Access regions, registers outside any region are read/write */
+    uint32_t u32RegionNum;          /*!< Number of access regions */
+    uint32_t u32DmaCh;              /*!< DMA channel for master read, @ref DMA_Channel_selection or
+                                         I2C_REGMAP_DMA_NONE */
+    uint32_t u32IrqPriority;        /*!< Priority of the I2C and DMA interrupts, @ref INTC_Priority_Sel */
+    func_ptr_i2c_regmap_write_t pfnWriteCallback;   /*!< Called at STOP after a master write, may be NULL */
+} stc_i2c_regmap_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_REGMAP_Global_Macros I2C_REGMAP Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup I2C_REGMAP_Access I2C register map region access
+ * @{
+ */
+#define I2C_REGMAP_ACCESS_RW            (0x03UL)    /*!< Master can read and write */
+#define I2C_REGMAP_ACCESS_RO            (0x01UL)    /*!< Master writes are ignored */
+#define I2C_REGMAP_ACCESS_WO            (0x02UL)    /*!< Master reads return I2C_REGMAP_READ_FILL */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2C_REGMAP_Misc I2C register map miscellaneous definitions
+ * @{
+ */
+#define I2C_REGMAP_DMA_NONE             (0xFFFFFFFFUL)  /*!< Master reads are served by the TEI interrupt */
+#define I2C_REGMAP_REG_NUM_MAX          (256UL)
+#define I2C_REGMAP_READ_FILL            (0xFFU)         /*!< Value sent for write-only or out of range registers */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup I2C_REGMAP_Global_Functions
+ * @{
+ */
+en_result_t I2C_REGMAP_StructInit(stc_i2c_regmap_init_t *pstcInit);
+en_result_t I2C_REGMAP_Init(const stc_i2c_regmap_init_t *pstcInit);
+void I2C_REGMAP_DeInit(void);
+
+en_result_t I2C_REGMAP_Update(uint8_t u8Reg, const uint8_t au8Data[], uint32_t u32Len);
+en_flag_status_t I2C_REGMAP_GetBusyStatus(void);
+
+void I2C_REGMAP_EEI_IrqHandler(void);
+void I2C_REGMAP_RXI_IrqHandler(void);
+void I2C_REGMAP_TEI_IrqHandler(void);
+void I2C_REGMAP_DmaTc_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_I2C_REGMAP_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_I2C_REGMAP_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
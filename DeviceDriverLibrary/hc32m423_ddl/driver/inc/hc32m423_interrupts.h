@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Add direct vector mode
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -62,6 +63,17 @@ typedef struct
     func_ptr_t   pfnCallback;   /*!< Callback function for corresponding peripheral IRQ */
 }stc_irq_signin_config_t;
 
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+/**
+ * @brief  Interrupt latency of the two vector modes, see INTC_DirectVectorBenchmark()
+ */
+typedef struct
+{
+    uint32_t u32Dispatch;       /*!< Cycles to the callback through IRQ00x_Handler() and the callback table */
+    uint32_t u32Direct;         /*!< Cycles to the callback installed in the vector table */
+}stc_intc_vector_bench_t;
+#endif /* DDL_RAMFUNC_ENABLE */
+
 /**
  * @brief  NMI initialize configuration structure definition
  */
@@ -326,6 +338,15 @@ void INTC_EventCmd(uint32_t u32Event, en_functional_state_t enNewState);
 void INTC_IntCmd(uint32_t u32Int, en_functional_state_t enNewState);
 void INTC_SWIntCmd(uint32_t u32SWInt, en_functional_state_t enNewState);
 
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+void INTC_DirectVectorCmd(en_functional_state_t enNewState);
+en_result_t INTC_VectorSignIn(IRQn_Type enIRQn, func_ptr_t pfnHandler);
+en_result_t INTC_VectorSignOut(IRQn_Type enIRQn);
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+en_result_t INTC_DirectVectorBenchmark(IRQn_Type enIRQn, stc_intc_vector_bench_t *pstcBench);
+#endif /* DDL_UTILITY_ENABLE */
+#endif /* DDL_RAMFUNC_ENABLE */
+
 en_result_t NMI_Init(const stc_nmi_init_t *pstcNmiInit);
 en_result_t NMI_StructInit(stc_nmi_init_t *pstcNmiInit);
 en_flag_status_t NMI_GetNmiStatus(uint32_t u32Flag);
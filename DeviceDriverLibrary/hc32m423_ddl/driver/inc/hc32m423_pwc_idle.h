@@ -0,0 +1,169 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_pwc_idle.h
+ * @brief This file contains all the functions prototypes of the tickless
+ *        idle driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_PWC_IDLE_H__
+#define __HC32M423_PWC_IDLE_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_PWC_IDLE
+ * @{
+ */
+
+#if (DDL_PWC_IDLE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Global_Types PWC_IDLE Global Types
+ * @{
+ */
+
+/**
+ * @brief Next deadline callback.
+ * @retval SysTick periods until the next scheduled work, PWC_IDLE_NO_DEADLINE
+ *         if nothing is scheduled.
+ */
+typedef uint32_t (*func_ptr_pwc_idle_deadline_t)(void);
+
+/**
+ * @brief Tickless idle configuration structure
+ */
+typedef struct
+{
+    uint32_t u32TickFreq;           /*!< SysTick frequency in Hz, as passed to SysTick_Init() */
+    CM_TMR0_TypeDef *pstcTmr0;      /*!< Sleep mode wake timer unit, CM_TMR0_1 or CM_TMR0_2 */
+    uint32_t u32Tmr0Ch;             /*!< Sleep mode wake timer channel, @ref TMR0_Channel_Index */
+    uint32_t u32SleepLatency;       /*!< Wake latency of sleep mode in us */
+    uint32_t u32StopLatency;        /*!< Wake latency of stop mode in us, including pfnStopExit */
+    uint32_t u32SwdtClkFreq;        /*!< SWDT count frequency in Hz, SWDTLRC / ICG clock division.
+                                         0 disables stop mode */
+    uint32_t u32SwdtPeriod;         /*!< SWDT count period set in ICG, 256, 4096, 16384 or 65536 */
+    uint32_t u32MinIdleTick;        /*!< Shortest idle that suspends SysTick, at least 2 periods */
+    func_ptr_pwc_idle_deadline_t pfnGetDeadline;    /*!< Next deadline, NULL if only interrupts
+                                                         schedule work */
+    func_ptr_t pfnStopEnter;        /*!< Called before stop mode, may be NULL */
+    func_ptr_t pfnStopExit;         /*!< Called after stop mode, e.g. to restore the clocks, may be NULL */
+    uint32_t u32IrqPriority;        /*!< Wake interrupt priority, @ref INTC_Priority_Sel */
+} stc_pwc_idle_init_t;
+
+/**
+ * @brief Tickless idle statistics
+ */
+typedef struct
+{
+    uint32_t u32SleepNum;           /*!< Sleep mode entries with SysTick running */
+    uint32_t u32TicklessNum;        /*!< Sleep mode entries with SysTick suspended */
+    uint32_t u32StopNum;            /*!< Stop mode entries */
+    uint32_t u32TickSkipped;        /*!< SysTick interrupts not taken */
+} stc_pwc_idle_stat_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Global_Macros PWC_IDLE Global Macros
+ * @{
+ */
+#define PWC_IDLE_NO_DEADLINE            (0xFFFFFFFFUL)
+#define PWC_IDLE_NO_LIMIT               (0xFFFFFFFFUL)  /*!< No wake latency limit */
+
+/**
+ * @defgroup PWC_IDLE_Mode PWC_IDLE Mode
+ * @{
+ */
+#define PWC_IDLE_MD_RUN                 (0UL)   /*!< Not idle */
+#define PWC_IDLE_MD_SLEEP               (1UL)   /*!< Sleep mode, SysTick running */
+#define PWC_IDLE_MD_SLEEP_TICKLESS      (2UL)   /*!< Sleep mode, SysTick suspended, woken by TMR0 */
+#define PWC_IDLE_MD_STOP                (3UL)   /*!< Stop mode, SysTick suspended, woken by SWDT */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup PWC_IDLE_Global_Functions
+ * @{
+ */
+en_result_t PWC_IDLE_StructInit(stc_pwc_idle_init_t *pstcInit);
+en_result_t PWC_IDLE_Init(const stc_pwc_idle_init_t *pstcInit);
+void PWC_IDLE_DeInit(void);
+
+void PWC_IDLE_SetLatencyLimit(uint32_t u32Latency);
+uint32_t PWC_IDLE_Enter(void);
+en_result_t PWC_IDLE_GetStatistics(stc_pwc_idle_stat_t *pstcStat);
+
+void PWC_IDLE_TMR0_IrqHandler(void);
+void PWC_IDLE_SWDT_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_PWC_IDLE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_PWC_IDLE_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,185 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_pwm_frame.h
+ * @brief This file contains all the functions prototypes of the atomic
+ *        multi-channel PWM frame driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_PWM_FRAME_H__
+#define __HC32M423_PWM_FRAME_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_PWM_FRAME
+ * @{
+ */
+
+#if (DDL_PWM_FRAME_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_FRAME_Global_Types PWM_FRAME Global Types
+ * @{
+ */
+
+/**
+ * @brief PWM frame configuration structure
+ */
+typedef struct
+{
+    uint32_t u32Unit;               /*!< PWM timer, @ref PWM_FRAME_Unit */
+    uint32_t u32ChNum;              /*!< Channels CH1 ~ CHn driven by the frame: 1 ~ 4 for TMRB,
+                                         1 for TMRA units 1/2, 1 ~ 2 for TMRA units 3/4 */
+    uint16_t u16ClockDiv;           /*!< Count clock, @ref TMRB_Clock_Division or
+                                         @ref TMRA_Clock_Division */
+    uint16_t u16Period;             /*!< Initial period value */
+    uint32_t u32DmaCh;              /*!< DMA channel applying the frames, @ref DMA_Channel_selection */
+} stc_pwm_frame_init_t;
+
+/**
+ * @brief Per period compare table of one channel, see PWM_FRAME_PlayStart()
+ */
+typedef struct
+{
+    uint32_t u32Ch;                 /*!< Channel, TMRB_CH1 ~ TMRB_CH4 or TMRA_CH1 ~ TMRA_CH2 */
+    uint32_t u32DmaCh;              /*!< DMA channel of the table, not the frame channel */
+    const uint16_t *pu16Compare;    /*!< Compare values, one per period, see PWM_FRAME_DutyToCompare() */
+    uint32_t u32Len;                /*!< Number of periods, 1 ~ PWM_FRAME_PLAY_LEN_MAX */
+} stc_pwm_frame_play_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_FRAME_Global_Macros PWM_FRAME Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup PWM_FRAME_Unit PWM_FRAME Unit
+ * @{
+ */
+#define PWM_FRAME_UNIT_TMRB             (0UL)
+#define PWM_FRAME_UNIT_TMRA_1           (1UL)
+#define PWM_FRAME_UNIT_TMRA_2           (2UL)
+#define PWM_FRAME_UNIT_TMRA_3           (3UL)
+#define PWM_FRAME_UNIT_TMRA_4           (4UL)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWM_FRAME_Polarity PWM_FRAME Polarity
+ * @{
+ */
+#define PWM_FRAME_POL_HIGH              (0UL)   /*!< Active high, the active time starts each period */
+#define PWM_FRAME_POL_LOW               (1UL)   /*!< Active low */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWM_FRAME_Play_Mode PWM_FRAME Play Mode
+ * @{
+ */
+#define PWM_FRAME_PLAY_ONCE             (0UL)   /*!< Stop on the last compare value */
+#define PWM_FRAME_PLAY_LOOP             (1UL)   /*!< Restart the tables after the last period */
+/**
+ * @}
+ */
+
+#define PWM_FRAME_CH_NUM_MAX            (4UL)
+#define PWM_FRAME_PLAY_LEN_MAX          (1023UL)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup PWM_FRAME_Global_Functions
+ * @{
+ */
+en_result_t PWM_FRAME_StructInit(stc_pwm_frame_init_t *pstcInit);
+en_result_t PWM_FRAME_Init(const stc_pwm_frame_init_t *pstcInit);
+void PWM_FRAME_DeInit(void);
+
+void PWM_FRAME_Start(void);
+void PWM_FRAME_Stop(void);
+
+void PWM_FRAME_SetPeriod(uint16_t u16Period);
+void PWM_FRAME_SetDuty(uint32_t u32Ch, uint16_t u16Duty);
+void PWM_FRAME_SetPolarity(uint32_t u32Ch, uint32_t u32Polarity);
+en_result_t PWM_FRAME_Commit(void);
+en_flag_status_t PWM_FRAME_GetPendingStatus(void);
+
+uint16_t PWM_FRAME_GetMinDuty(void);
+uint16_t PWM_FRAME_DutyToCompare(uint16_t u16Duty);
+
+en_result_t PWM_FRAME_PlayStart(const stc_pwm_frame_play_t astcPlay[], uint32_t u32Num, uint32_t u32Mode);
+void PWM_FRAME_PlayStop(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_PWM_FRAME_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_PWM_FRAME_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
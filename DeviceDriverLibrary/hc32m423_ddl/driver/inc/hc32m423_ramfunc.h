@@ -0,0 +1,129 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_ramfunc.h
+ * @brief This file contains all the functions prototypes of the RAM vector
+ *        table and the RAM function benchmark.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_RAMFUNC_H__
+#define __HC32M423_RAMFUNC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_RAMFUNC
+ * @{
+ */
+
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup RAMFUNC_Global_Types RAMFUNC Global Types
+ * @{
+ */
+
+/**
+ * @brief Interrupt latency of flash and RAM handlers for each flash wait cycle setting
+ * @note  Cycles from pending the interrupt to the end of the handler body,
+ *        0 for wait cycles below the minimum of the current Hclk.
+ */
+typedef struct
+{
+    uint32_t u32MinWaitCycle;       /*!< Minimum wait cycles for the current Hclk */
+    uint32_t au32FlashCycle[8U];    /*!< Handler in flash, index is the wait cycles */
+    uint32_t au32RamCycle[8U];      /*!< Handler in RAM, index is the wait cycles */
+} stc_ramfunc_bench_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup RAMFUNC_Global_Macros RAMFUNC Global Macros
+ * @{
+ */
+#define RAMFUNC_VECTOR_NUM              (117UL)     /*!< 16 system exceptions and IRQ000 ~ IRQ100 */
+#define RAMFUNC_VECTOR_ALIGN            (512UL)     /*!< VTOR alignment for RAMFUNC_VECTOR_NUM entries */
+#define RAMFUNC_WAIT_CYCLE_NUM          (8UL)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup RAMFUNC_Global_Functions
+ * @{
+ */
+void RAMFUNC_VectorRelocate(void);
+void RAMFUNC_VectorRestore(void);
+void RAMFUNC_VectorResetEntry(uint32_t u32Index);
+uint32_t *RAMFUNC_GetVectorTable(void);
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+en_result_t RAMFUNC_Benchmark(IRQn_Type enIRQn, en_functional_state_t enCache, stc_ramfunc_bench_t *pstcBench);
+#endif /* DDL_UTILITY_ENABLE */
+
+/**
+ * @}
+ */
+
+#endif /* DDL_RAMFUNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_RAMFUNC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,171 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmr0_wheel.h
+ * @brief This file contains all the functions prototypes of the software
+ *        timer wheel driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_TMR0_WHEEL_H__
+#define __HC32M423_TMR0_WHEEL_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_TMR0_WHEEL
+ * @{
+ */
+
+#if (DDL_TMR0_WHEEL_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Global_Types TMR0_WHEEL Global Types
+ * @{
+ */
+
+/**
+ * @brief Timer expiry callback.
+ * @param [in] pvArg                Argument given to TMR0_WHEEL_TimerInit().
+ * @note  Called from the TMR0 compare interrupt with interrupts disabled,
+ *        keep it short. The callback may start or stop any timer, including
+ *        its own; its timeouts count from the expiry tick.
+ */
+typedef void (*func_ptr_tmr0_wheel_t)(void *pvArg);
+
+/**
+ * @brief Software timer. Allocated by the application, the fields are
+ *        private to the driver.
+ */
+typedef struct stc_tmr0_wheel_timer
+{
+    struct stc_tmr0_wheel_timer *pstcNext;  /*!< Next timer in the slot */
+    struct stc_tmr0_wheel_timer *pstcPrev;  /*!< Previous timer in the slot */
+    uint32_t u32Expiry;             /*!< Expiry tick */
+    uint32_t u32Period;             /*!< Reload in ticks, 0 for one shot */
+    uint32_t u32Slot;               /*!< Wheel slot, TMR0_WHEEL_SLOT_NONE when idle */
+    func_ptr_tmr0_wheel_t pfnCallback;  /*!< Expiry callback */
+    void *pvArg;                    /*!< Callback argument */
+} stc_tmr0_wheel_timer_t;
+
+/**
+ * @brief Timer wheel configuration structure
+ */
+typedef struct
+{
+    CM_TMR0_TypeDef *pstcTmr0;      /*!< Timer unit, CM_TMR0_1 or CM_TMR0_2 */
+    uint32_t u32Ch;                 /*!< Timer channel, @ref TMR0_Channel_Index */
+    uint32_t u32TickFreq;           /*!< Tick frequency in Hz, PCLK1 / 2^n must be a multiple of it */
+    uint32_t u32IrqPriority;        /*!< Compare interrupt priority, @ref INTC_Priority_Sel */
+} stc_tmr0_wheel_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Global_Macros TMR0_WHEEL Global Macros
+ * @{
+ */
+
+/**
+ * @brief Wheel geometry. TMR0_WHEEL_LEVEL_NUM levels of 2^TMR0_WHEEL_SLOT_BITS
+ *        slots cover 2^(LEVEL_NUM * SLOT_BITS) - 1 ticks directly; longer
+ *        timeouts are re-filed on the way.
+ */
+#ifndef TMR0_WHEEL_SLOT_BITS
+#define TMR0_WHEEL_SLOT_BITS            (4UL)
+#endif
+#ifndef TMR0_WHEEL_LEVEL_NUM
+#define TMR0_WHEEL_LEVEL_NUM            (4UL)
+#endif
+
+#define TMR0_WHEEL_SLOT_NONE            (0xFFFFFFFFUL)
+#define TMR0_WHEEL_NO_DEADLINE          (0xFFFFFFFFUL)   /*!< No timer running */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMR0_WHEEL_Global_Functions
+ * @{
+ */
+en_result_t TMR0_WHEEL_StructInit(stc_tmr0_wheel_init_t *pstcInit);
+en_result_t TMR0_WHEEL_Init(const stc_tmr0_wheel_init_t *pstcInit);
+void TMR0_WHEEL_DeInit(void);
+
+en_result_t TMR0_WHEEL_TimerInit(stc_tmr0_wheel_timer_t *pstcTimer,
+                                 func_ptr_tmr0_wheel_t pfnCallback, void *pvArg);
+en_result_t TMR0_WHEEL_TimerStart(stc_tmr0_wheel_timer_t *pstcTimer,
+                                  uint32_t u32Timeout, uint32_t u32Period);
+void TMR0_WHEEL_TimerStop(stc_tmr0_wheel_timer_t *pstcTimer);
+en_functional_state_t TMR0_WHEEL_TimerIsRunning(const stc_tmr0_wheel_timer_t *pstcTimer);
+
+uint32_t TMR0_WHEEL_GetTick(void);
+uint32_t TMR0_WHEEL_GetNextDeadline(void);
+
+void TMR0_WHEEL_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMR0_WHEEL_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_TMR0_WHEEL_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
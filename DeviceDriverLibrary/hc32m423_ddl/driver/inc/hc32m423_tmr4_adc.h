@@ -0,0 +1,162 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmr4_adc.h
+ * @brief This file contains all the functions prototypes of the TMR4
+ *        synchronized ADC current sampling driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_TMR4_ADC_H__
+#define __HC32M423_TMR4_ADC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_TMR4_ADC
+ * @{
+ */
+
+#if (DDL_TMR4_ADC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_ADC_Global_Types TMR4_ADC Global Types
+ * @{
+ */
+
+/**
+ * @brief Frame complete callback.
+ * @param [in] au16Frame            The frame just written, see TMR4_ADC_GetChOffset().
+ * @param [in] u32FrameCnt          Number of frames since TMR4_ADC_Start(), including this one.
+ * @note  Called from the DMA block transfer complete interrupt, once per PWM
+ *        period. au16Frame stays valid until the ring wraps around.
+ */
+typedef void (*func_ptr_tmr4_adc_frame_t)(const uint16_t au16Frame[], uint32_t u32FrameCnt);
+
+/**
+ * @brief TMR4 synchronized ADC sampling configuration structure
+ */
+typedef struct
+{
+    uint32_t u32SevtCh;             /*!< SEVT channel used as the ADC trigger, @ref TMR4_SEVT_Channel */
+    uint32_t u32AdcCh;              /*!< Channels of sequence B, @ref ADC_Channel. Each frame
+                                         stores the data registers from the lowest to the
+                                         highest of these channels. */
+    const uint8_t *pu8SampleTime;   /*!< Sampling time of each channel, see ADC_ChCmd() */
+    uint32_t u32SampleTimeNs;       /*!< Duration of the sampling window of one channel */
+    uint32_t u32ConvTimeNs;         /*!< Duration of one channel conversion, sampling included */
+    uint32_t u32GuardNs;            /*!< Dead time plus ringing settling time after the low
+                                         side switch turns on */
+    uint32_t u32DmaCh;              /*!< DMA channel, @ref DMA_Channel_selection */
+    uint16_t *pu16Buf;              /*!< Frame ring, TMR4_ADC_BUF_LEN() half words */
+    uint32_t u32FrameNum;           /*!< Number of frames in the ring, 1 ~ TMR4_ADC_FRAME_NUM_MAX */
+    uint32_t u32IrqPriority;        /*!< Priority of the DMA block transfer complete interrupt,
+                                         @ref INTC_Priority_Sel */
+    func_ptr_tmr4_adc_frame_t pfnFrameCallback; /*!< Frame complete callback, NULL for none */
+} stc_tmr4_adc_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_ADC_Global_Macros TMR4_ADC Global Macros
+ * @{
+ */
+
+#define TMR4_ADC_FRAME_NUM_MAX          (1023UL)
+
+/**
+ * @brief Frame ring length in half words.
+ * @param frame_len                 Frame length, see TMR4_ADC_GetFrameLen().
+ * @param frame_num                 Number of frames.
+ */
+#define TMR4_ADC_BUF_LEN(frame_len, frame_num)      ((frame_len) * (frame_num))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMR4_ADC_Global_Functions
+ * @{
+ */
+en_result_t TMR4_ADC_StructInit(stc_tmr4_adc_init_t *pstcInit);
+en_result_t TMR4_ADC_Init(const stc_tmr4_adc_init_t *pstcInit);
+void TMR4_ADC_DeInit(void);
+
+void TMR4_ADC_Start(void);
+void TMR4_ADC_Stop(void);
+
+uint32_t TMR4_ADC_GetFrameLen(uint32_t u32AdcCh);
+uint32_t TMR4_ADC_GetChOffset(uint32_t u32ChNum);
+const uint16_t *TMR4_ADC_GetLatestFrame(void);
+uint16_t TMR4_ADC_GetTriggerAdvance(void);
+uint16_t TMR4_ADC_GetMinCompare(void);
+uint16_t TMR4_ADC_GetMaxDuty(void);
+uint32_t TMR4_ADC_GetMissedCount(void);
+
+void TMR4_ADC_DmaBtc_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMR4_ADC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_TMR4_ADC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,146 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmr4_mod.h
+ * @brief This file contains all the functions prototypes of the TMR4
+ *        three-phase modulation driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_TMR4_MOD_H__
+#define __HC32M423_TMR4_MOD_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_TMR4_MOD
+ * @{
+ */
+
+#if (DDL_TMR4_MOD_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_MOD_Global_Types TMR4_MOD Global Types
+ * @{
+ */
+
+/**
+ * @brief Three-phase modulation configuration structure
+ */
+typedef struct
+{
+    uint32_t u32PwmFreq;            /*!< Carrier frequency in Hz */
+    uint32_t u32DeadTime;           /*!< Dead time in ns, applied to both edges */
+    uint32_t u32Method;             /*!< Modulation method, @ref TMR4_MOD_Method */
+    uint16_t u16UpdateCond;         /*!< Compare buffer transfer: TMR4_OCO_BUF_COND_UDF (zero),
+                                         TMR4_OCO_BUF_COND_OVF (peak) or TMR4_OCO_BUF_COND_UDF_OVF */
+    uint32_t u32AbnormalPolarity;   /*!< Output state on EMB or master output off,
+                                         @ref TMR4_PWM_Abnormal_Polarity */
+} stc_tmr4_mod_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_MOD_Global_Macros TMR4_MOD Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup TMR4_MOD_Method TMR4_MOD Method
+ * @note  For TMR4_MOD_SetAlphaBeta(), 32767 is the largest linear amplitude
+ *        of SVPWM, Vdc / sqrt(3). Sinusoidal PWM saturates above 28377.
+ * @{
+ */
+#define TMR4_MOD_SPWM                   (0UL)   /*!< Sinusoidal */
+#define TMR4_MOD_THIPWM                 (1UL)   /*!< Sinusoidal with 1/6 third harmonic injection */
+#define TMR4_MOD_SVPWM                  (2UL)   /*!< Space vector, min-max zero sequence injection */
+/**
+ * @}
+ */
+
+#define TMR4_MOD_DUTY_FULL              (32768U)    /*!< 100% for TMR4_MOD_SetDuty() */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMR4_MOD_Global_Functions
+ * @{
+ */
+en_result_t TMR4_MOD_StructInit(stc_tmr4_mod_init_t *pstcInit);
+en_result_t TMR4_MOD_Init(const stc_tmr4_mod_init_t *pstcInit);
+void TMR4_MOD_DeInit(void);
+
+void TMR4_MOD_Start(void);
+void TMR4_MOD_Stop(void);
+
+void TMR4_MOD_SetMethod(uint32_t u32Method);
+void TMR4_MOD_SetAlphaBeta(int16_t i16Alpha, int16_t i16Beta);
+void TMR4_MOD_SetDuty(uint16_t u16DutyU, uint16_t u16DutyV, uint16_t u16DutyW);
+uint16_t TMR4_MOD_GetPeakValue(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMR4_MOD_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_TMR4_MOD_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,154 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmr_sync.h
+ * @brief This file contains all the functions prototypes of the
+ *        synchronized timer group driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_TMR_SYNC_H__
+#define __HC32M423_TMR_SYNC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_TMR_SYNC
+ * @{
+ */
+
+#if (DDL_TMR_SYNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMR_SYNC_Global_Types TMR_SYNC Global Types
+ * @{
+ */
+
+/**
+ * @brief Timer group configuration structure
+ */
+typedef struct
+{
+    uint32_t u32Unit;                           /*!< Units of the group, any composed value of @ref TMR_SYNC_Unit.
+                                                     The lowest unit is the reference of TMR_SYNC_Realign() */
+    uint16_t au16Phase[5U];                     /*!< Phase of each unit, indexed by TMR_SYNC_UNIT_IDX_xxx,
+                                                     in 1/65536 of the period, see TMR_SYNC_PHASE_DEG() */
+} stc_tmr_sync_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR_SYNC_Global_Macros TMR_SYNC Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup TMR_SYNC_Unit TMR_SYNC Unit
+ * @{
+ */
+#define TMR_SYNC_UNIT_IDX_TMRA_1        (0UL)
+#define TMR_SYNC_UNIT_IDX_TMRA_2        (1UL)
+#define TMR_SYNC_UNIT_IDX_TMRA_3        (2UL)
+#define TMR_SYNC_UNIT_IDX_TMRA_4        (3UL)
+#define TMR_SYNC_UNIT_IDX_TMRB          (4UL)
+
+#define TMR_SYNC_UNIT_TMRA_1            (1UL << TMR_SYNC_UNIT_IDX_TMRA_1)
+#define TMR_SYNC_UNIT_TMRA_2            (1UL << TMR_SYNC_UNIT_IDX_TMRA_2)
+#define TMR_SYNC_UNIT_TMRA_3            (1UL << TMR_SYNC_UNIT_IDX_TMRA_3)
+#define TMR_SYNC_UNIT_TMRA_4            (1UL << TMR_SYNC_UNIT_IDX_TMRA_4)
+#define TMR_SYNC_UNIT_TMRB              (1UL << TMR_SYNC_UNIT_IDX_TMRB)
+#define TMR_SYNC_UNIT_ALL               (0x1FUL)
+/**
+ * @}
+ */
+
+#define TMR_SYNC_UNIT_NUM               (5UL)
+
+/**
+ * @brief Phase in degrees, 0 ~ 359, to the scale of au16Phase
+ */
+#define TMR_SYNC_PHASE_DEG(deg)         ((uint16_t)((((uint32_t)(deg) % 360UL) * 65536UL) / 360UL))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMR_SYNC_Global_Functions
+ * @{
+ */
+en_result_t TMR_SYNC_StructInit(stc_tmr_sync_init_t *pstcInit);
+en_result_t TMR_SYNC_Init(const stc_tmr_sync_init_t *pstcInit);
+void TMR_SYNC_DeInit(void);
+
+void TMR_SYNC_Start(void);
+void TMR_SYNC_Stop(void);
+void TMR_SYNC_Realign(void);
+
+void TMR_SYNC_SetPhase(uint32_t u32UnitIdx, uint16_t u16Phase);
+uint16_t TMR_SYNC_GetPhaseCount(uint32_t u32UnitIdx);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMR_SYNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_TMR_SYNC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
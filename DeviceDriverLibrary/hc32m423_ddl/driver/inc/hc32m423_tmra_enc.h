@@ -0,0 +1,170 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmra_enc.h
+ * @brief This file contains all the functions prototypes of the TMRA
+ *        quadrature encoder driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_TMRA_ENC_H__
+#define __HC32M423_TMRA_ENC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_TMRA_ENC
+ * @{
+ */
+
+#if (DDL_TMRA_ENC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_ENC_Global_Types TMRA_ENC Global Types
+ * @{
+ */
+
+/**
+ * @brief Index pulse callback.
+ * @param [in] i64Position          Position latched by the index pulse.
+ * @param [in] u32IndexCnt          Number of index pulses since TMRA_ENC_Init().
+ * @note  Called from the compare interrupt of the encoder unit.
+ */
+typedef void (*func_ptr_tmra_enc_index_t)(int64_t i64Position, uint32_t u32IndexCnt);
+
+/**
+ * @brief Quadrature encoder configuration structure
+ */
+typedef struct
+{
+    CM_TMRA_TypeDef *pstcTmraEnc;   /*!< Encoder unit, CLKA/CLKB take phases A/B. CM_TMRA_1 ~ CM_TMRA_4 */
+    CM_TMRA_TypeDef *pstcTmraTime;  /*!< Time base unit, another unit than pstcTmraEnc */
+    uint16_t u16TimeClockDiv;       /*!< Time base clock, @ref TMRA_Clock_Divider. 65536 counts
+                                         must be longer than the TMRA_ENC_Update() period. */
+    uint32_t u32Resolution;         /*!< Counts per cycle of phase A, @ref TMRA_ENC_Resolution */
+    en_functional_state_t enEdgeLatch;  /*!< Phase A also on PWM1 of the encoder unit: each A edge
+                                             latches the position and the time base in hardware.
+                                             Disable to time edges at TMRA_ENC_Update() instead. */
+    uint16_t u16FilterClockDiv;     /*!< Input filter clock, @ref TMRA_Filter_Clock_Divider */
+    en_functional_state_t enIndex;  /*!< Index pulse on PWM2 of the encoder unit, CM_TMRA_3 and
+                                         CM_TMRA_4 only */
+    uint32_t u32StandstillUs;       /*!< No edge for this long reports zero speed */
+    uint32_t u32IrqPriority;        /*!< Priority of the encoder unit interrupts, @ref INTC_Priority_Sel */
+    func_ptr_tmra_enc_index_t pfnIndexCallback; /*!< Index pulse callback, NULL for none */
+} stc_tmra_enc_init_t;
+
+/**
+ * @brief Encoder state, see TMRA_ENC_Update()
+ */
+typedef struct
+{
+    int64_t i64Position;            /*!< Position in counts */
+    float32_t f32Velocity;          /*!< Velocity in counts per second */
+    float32_t f32Accel;             /*!< Acceleration in counts per second squared */
+    int64_t i64IndexPosition;       /*!< Position latched by the last index pulse */
+    uint32_t u32IndexCnt;           /*!< Number of index pulses */
+} stc_tmra_enc_state_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_ENC_Global_Macros TMRA_ENC Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup TMRA_ENC_Resolution TMRA_ENC Resolution
+ * @note  Phase A leading phase B counts up.
+ * @{
+ */
+#define TMRA_ENC_X1                     (1UL)   /*!< Rising edges of A */
+#define TMRA_ENC_X2                     (2UL)   /*!< Both edges of A */
+#define TMRA_ENC_X4                     (4UL)   /*!< Both edges of A and B */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMRA_ENC_Global_Functions
+ * @{
+ */
+en_result_t TMRA_ENC_StructInit(stc_tmra_enc_init_t *pstcInit);
+en_result_t TMRA_ENC_Init(const stc_tmra_enc_init_t *pstcInit);
+void TMRA_ENC_DeInit(void);
+
+int64_t TMRA_ENC_GetPosition(void);
+void TMRA_ENC_SetPosition(int64_t i64Position);
+en_result_t TMRA_ENC_Update(stc_tmra_enc_state_t *pstcState);
+
+void TMRA_ENC_Ovf_IrqHandler(void);
+void TMRA_ENC_Udf_IrqHandler(void);
+void TMRA_ENC_Cmp_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMRA_ENC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_TMRA_ENC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
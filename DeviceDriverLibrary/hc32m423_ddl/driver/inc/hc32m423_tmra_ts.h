@@ -0,0 +1,119 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmra_ts.h
+ * @brief This file contains all the functions prototypes of the 64-bit
+ *        timestamp driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32M423_TMRA_TS_H__
+#define __HC32M423_TMRA_TS_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_common.h"
+#include "ddl_config.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup DDL_TMRA_TS
+ * @{
+ */
+
+#if (DDL_TMRA_TS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_TS_Global_Types TMRA_TS Global Types
+ * @{
+ */
+
+/**
+ * @brief Timestamp configuration structure
+ */
+typedef struct
+{
+    CM_TMRA_TypeDef *pstcTmraLow;   /*!< Low half unit, CM_TMRA_1 or CM_TMRA_3. The next unit,
+                                         CM_TMRA_2 or CM_TMRA_4, counts its overflows */
+    uint16_t u16ClockDiv;           /*!< Clock division of the low half unit, @ref TMRA_Clock_Divider */
+    uint32_t u32IrqPriority;        /*!< High half overflow interrupt priority, @ref INTC_Priority_Sel */
+} stc_tmra_ts_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMRA_TS_Global_Functions
+ * @{
+ */
+en_result_t TMRA_TS_StructInit(stc_tmra_ts_init_t *pstcInit);
+en_result_t TMRA_TS_Init(const stc_tmra_ts_init_t *pstcInit);
+void TMRA_TS_DeInit(void);
+
+uint64_t TMRA_TS_GetCount(void);
+uint32_t TMRA_TS_GetFreq(void);
+uint64_t TMRA_TS_CountToNs(uint64_t u64Count);
+uint64_t TMRA_TS_GetNs(void);
+
+void TMRA_TS_IrqHandler(void);
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMRA_TS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32M423_TMRA_TS_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -6,6 +6,8 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Add time based deadline functions for driver timeouts
+   2026-10-18       CDT             Add SysTick_AddTick function for tickless idle
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -47,10 +49,42 @@ extern "C"
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup UTILITY_Global_Types UTILITY Global Types
+ * @{
+ */
+
+/**
+ * @brief Deadline used by the driver wait loops
+ */
+typedef struct
+{
+    uint32_t u32LastCycle;      /*!< Cycle count at the previous check */
+    uint32_t u32CycleAcc;       /*!< Elapsed cycles not yet accounted in u32RemainUs */
+    uint32_t u32CyclePerUs;     /*!< HCLK cycles per microsecond, 0 when no cycle counter */
+    uint32_t u32RemainUs;       /*!< Remaining time in microseconds */
+} stc_ddl_deadline_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
  ******************************************************************************/
+/**
+ * @defgroup UTILITY_Global_Macros UTILITY Global Macros
+ * @{
+ */
+
+/**
+ * @brief Timeout value that never expires
+ */
+#define DDL_TIMEOUT_MAX                 (0xFFFFFFFFUL)
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global variable definitions ('extern')
@@ -72,10 +106,16 @@ void DDL_DelayUS(uint32_t u32Count);
 en_result_t SysTick_Init(uint32_t u32Freq);
 void SysTick_Delay(uint32_t u32Delay);
 void SysTick_IncTick(void);
+void SysTick_AddTick(uint32_t u32Tick);
 uint32_t SysTick_GetTick(void);
 void SysTick_Suspend(void);
 void SysTick_Resume(void);
 
+/* Time based timeout */
+uint32_t DDL_GetCycleCount(void);
+void DDL_DeadlineStart(stc_ddl_deadline_t *pstcDeadline, uint32_t u32TimeoutUs);
+en_flag_status_t DDL_DeadlineIsExpired(stc_ddl_deadline_t *pstcDeadline);
+
 /* You can add your own assert functions by implement the function DDL_AssertHandler
    definition follow the function DDL_AssertHandler declaration */
 #ifdef __DEBUG
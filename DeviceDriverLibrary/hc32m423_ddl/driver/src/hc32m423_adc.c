@@ -8,6 +8,7 @@
    Date             Author          Notes
    2020-09-15       CDT             First version
    2020-12-04       CDT             Corrected comments of ADC unit.
+   2026-10-18       CDT             Use time based timeout in microseconds
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -716,7 +717,7 @@ void ADC_ContinuousSampleCmd(CM_ADC_TypeDef *ADCx, en_functional_state_t enNewSt
  *                                      au16Value[1] = value of the 2nd enabled channel,
  *                                      au16Value[2] = value of the 3rd enabled channel,
  * @param  [in]  u32Len                 The length of the ADC value to be got.
- * @param  [in]  u32Timeout             Timeout value.
+ * @param  [in]  u32Timeout             Timeout value in microseconds.
  * @retval An en_result_t enumeration value.
  *   @arg  Ok:                          No errors occurred.
  *   @arg  ErrorInvalidParameter:      -au16Value == NULL.
@@ -729,6 +730,7 @@ en_result_t ADC_PollingSeqA(CM_ADC_TypeDef *ADCx, uint16_t au16Value[], \
 {
     uint32_t u32Ch;
     en_result_t enRet = ErrorInvalidParameter;
+    stc_ddl_deadline_t stcDeadline;
 
     if ((au16Value != NULL) && \
         (u32Len != 0U) && \
@@ -739,15 +741,15 @@ en_result_t ADC_PollingSeqA(CM_ADC_TypeDef *ADCx, uint16_t au16Value[], \
         SET_REG8_BIT(ADCx->STR, ADC_STR_STRT);
         /* Check timeout. */
         enRet = Ok;
+        DDL_DeadlineStart(&stcDeadline, u32Timeout);
         while (READ_REG8_BIT(ADCx->ISR, ADC_ISR_EOCAF) == 0U)
         {
-            if (u32Timeout == 0UL)
+            if (Set == DDL_DeadlineIsExpired(&stcDeadline))
             {
                 CLEAR_REG8_BIT(ADCx->STR, ADC_STR_STRT);
                 enRet = ErrorTimeout;
                 break;
             }
-            u32Timeout--;
         }
 
         if (enRet == Ok)
@@ -0,0 +1,359 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_awd.c
+ * @brief This file provides firmware functions to watch an ADC channel
+ *        against a window with the DCU compare mode.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_adc_awd.h"
+#include "hc32m423_adc.h"
+#include "hc32m423_dcu.h"
+#include "hc32m423_dma.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_ADC_AWD ADC_AWD
+ * @brief ADC Threshold Watch Driver Library
+ * @details The ADC has no analog watchdog, so one is built from the DCU:
+ *          every end of conversion of the watched sequence triggers a DMA
+ *          transfer of the channel data register into DCU DATA0. The DCU runs
+ *          in compare mode triggered by the DATA0 write, with the high
+ *          threshold in DATA1 and the low threshold in DATA2, and raises the
+ *          window outside interrupt only when a sample leaves the window.
+ *          The CPU is not involved while the samples stay inside.
+ *          The application configures the ADC, enables the ADC, DMA, DCU and
+ *          AOS function clocks, and calls ADC_AWD_DCU_IrqHandler() from
+ *          DCU_IrqHandler().
+ * @{
+ */
+
+#if (DDL_ADC_AWD_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_AWD_Local_Macros ADC_AWD Local Macros
+ * @{
+ */
+#define ADC_AWD_ADC_UNIT                (CM_ADC)
+#define ADC_AWD_DMA_UNIT                (CM_DMA)
+#define ADC_AWD_DCU_UNIT                (CM_DCU)
+
+#define ADC_AWD_FLAG_OUTSIDE            (DCU_FLAG_DATA0_LT_DATA2 | DCU_FLAG_DATA0_GT_DATA1)
+
+/**
+ * @defgroup ADC_AWD_Check_Parameters_Validity ADC_AWD Check Parameters Validity
+ * @{
+ */
+#define IS_ADC_AWD_SEQ(x)                                                      \
+(   ((x) == ADC_SEQ_A)                          ||                             \
+    ((x) == ADC_SEQ_B))
+
+#define IS_ADC_AWD_DMA_CH(x)            ((x) <= DMA_CH3)
+
+/* Thresholds ordered and still fitting DCU 16-bit data once aligned */
+#define IS_ADC_AWD_WINDOW(low, high, shift)                                    \
+(   ((low) <= (high))                           &&                             \
+    ((uint32_t)(high) <= (0xFFFFUL >> (shift))))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_AWD_Local_Variables ADC_AWD Local Variables
+ * @{
+ */
+static uint32_t m_u32DmaCh = DMA_CH0;
+static uint32_t m_u32Shift = 0UL;
+static func_ptr_adc_awd_t m_pfnCallback = NULL;
+static __IO uint32_t m_u32ViolationCnt = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_AWD_Global_Functions ADC_AWD Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_adc_awd_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_adc_awd_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t ADC_AWD_StructInit(stc_adc_awd_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32Seq = ADC_SEQ_A;
+        pstcInit->u32ChNum = 0UL;
+        pstcInit->u32DmaCh = DMA_CH0;
+        pstcInit->u16LowThreshold = 0U;
+        pstcInit->u16HighThreshold = 0xFFFU;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI03;
+        pstcInit->pfnCallback = NULL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the DMA channel and the DCU of the threshold watch.
+ * @param  [in] pstcInit                Pointer to a stc_adc_awd_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration, nothing is configured:
+ *                                      NULL pointer, channel out of range, low threshold
+ *                                      above the high one, or high threshold above the
+ *                                      code range of the left-aligned data
+ * @note   The thresholds follow the resolution and data alignment the ADC is
+ *         configured with when this function is called. The watch is not
+ *         running after initialization, see ADC_AWD_Start().
+ */
+en_result_t ADC_AWD_Init(const stc_adc_awd_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_dma_init_t stcDmaInit;
+    stc_dcu_init_t stcDcuInit;
+    uint16_t u16Cfg;
+    uint32_t u32Shift = 0UL;
+
+    /* Thresholds are compared against the raw data register */
+    if (0U != READ_REG16_BIT(ADC_AWD_ADC_UNIT->CR0, ADC_CR0_DFMT))
+    {
+        u16Cfg = READ_REG16_BIT(ADC_AWD_ADC_UNIT->CR0, ADC_CR0_ACCSEL);
+        if (ADC_RESOLUTION_8BIT == u16Cfg)
+        {
+            u32Shift = 8UL;
+        }
+        else if (ADC_RESOLUTION_10BIT == u16Cfg)
+        {
+            u32Shift = 6UL;
+        }
+        else
+        {
+            u32Shift = 4UL;
+        }
+    }
+
+    /* Nothing is touched unless the whole configuration is valid */
+    if ((pstcInit != NULL) && (pstcInit->u32ChNum <= ADC_CH_NUM_MAX) &&
+        IS_ADC_AWD_WINDOW(pstcInit->u16LowThreshold, pstcInit->u16HighThreshold, u32Shift))
+    {
+        DDL_ASSERT(IS_ADC_AWD_SEQ(pstcInit->u32Seq));
+        DDL_ASSERT(IS_ADC_AWD_DMA_CH(pstcInit->u32DmaCh));
+
+        m_u32DmaCh = pstcInit->u32DmaCh;
+        m_pfnCallback = pstcInit->pfnCallback;
+        m_u32ViolationCnt = 0UL;
+        m_u32Shift = u32Shift;
+
+        /* DCU: window compare on every DATA0 write */
+        (void)DCU_StructInit(&stcDcuInit);
+        stcDcuInit.u32Mode = DCU_MD_CMP;
+        stcDcuInit.u32DataWidth = DCU_DATA_WIDTH_16BIT;
+        stcDcuInit.u32CompareTriggerMode = DCU_CMP_TRIG_DATA0;
+        (void)DCU_Init(ADC_AWD_DCU_UNIT, &stcDcuInit);
+        (void)ADC_AWD_SetWindow(pstcInit->u16LowThreshold, pstcInit->u16HighThreshold);
+        DCU_IntCmd(ADC_AWD_DCU_UNIT, DCU_CATEGORY_CMP_WIN, DCU_INT_CMP_WIN_OUTSIDE, Enable);
+
+        /* DMA: one data register to DATA0 per end of conversion, endless */
+        DMA_ChCmd(ADC_AWD_DMA_UNIT, m_u32DmaCh, Disable);
+        (void)DMA_StructInit(&stcDmaInit);
+        stcDmaInit.u32SrcAddr = (uint32_t)(&ADC_AWD_ADC_UNIT->DR0 + pstcInit->u32ChNum);
+        stcDmaInit.u32DestAddr = (uint32_t)&ADC_AWD_DCU_UNIT->DATA0;
+        stcDmaInit.u32DataWidth = DMA_DATA_WIDTH_16BIT;
+        stcDmaInit.u32BlockSize = 1UL;
+        stcDmaInit.u32TransCount = 0UL;
+        stcDmaInit.u32SrcAddrMode = DMA_SRC_ADDR_MD_FIX;
+        stcDmaInit.u32DestAddrMode = DMA_DEST_ADDR_MD_FIX;
+        (void)DMA_Init(ADC_AWD_DMA_UNIT, m_u32DmaCh, &stcDmaInit);
+        DMA_SetTriggerSrc(ADC_AWD_DMA_UNIT, m_u32DmaCh,
+                          (ADC_SEQ_A == pstcInit->u32Seq) ? EVT_ADC_EOCA : EVT_ADC_EOCB);
+        DMA_Cmd(ADC_AWD_DMA_UNIT, Enable);
+
+        NVIC_ClearPendingIRQ(DCU_IRQn);
+        NVIC_SetPriority(DCU_IRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(DCU_IRQn);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the threshold watch.
+ * @param  None
+ * @retval None
+ */
+void ADC_AWD_DeInit(void)
+{
+    ADC_AWD_Stop();
+    NVIC_DisableIRQ(DCU_IRQn);
+    (void)DCU_DeInit(ADC_AWD_DCU_UNIT);
+    m_pfnCallback = NULL;
+}
+
+/**
+ * @brief  Start watching.
+ * @param  None
+ * @retval None
+ */
+void ADC_AWD_Start(void)
+{
+    DCU_ClearStatus(ADC_AWD_DCU_UNIT, DCU_FLAG_ALL);
+    DCU_GlobalIntCmd(ADC_AWD_DCU_UNIT, Enable);
+    DMA_ChCmd(ADC_AWD_DMA_UNIT, m_u32DmaCh, Enable);
+}
+
+/**
+ * @brief  Stop watching.
+ * @param  None
+ * @retval None
+ */
+void ADC_AWD_Stop(void)
+{
+    DMA_ChCmd(ADC_AWD_DMA_UNIT, m_u32DmaCh, Disable);
+    DCU_GlobalIntCmd(ADC_AWD_DCU_UNIT, Disable);
+}
+
+/**
+ * @brief  Change the window.
+ * @param  [in] u16LowThreshold         Lowest allowed code, right-aligned.
+ * @param  [in] u16HighThreshold        Highest allowed code, right-aligned.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       u16LowThreshold > u16HighThreshold, or u16HighThreshold
+ *                                      out of the code range, the window is unchanged
+ * @note   May be called while watching. A sample compared between the two
+ *         register writes sees one old and one new threshold.
+ */
+en_result_t ADC_AWD_SetWindow(uint16_t u16LowThreshold, uint16_t u16HighThreshold)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (IS_ADC_AWD_WINDOW(u16LowThreshold, u16HighThreshold, m_u32Shift))
+    {
+        DCU_WriteData16(ADC_AWD_DCU_UNIT, DCU_DATA1_IDX, (uint16_t)((uint32_t)u16HighThreshold << m_u32Shift));
+        DCU_WriteData16(ADC_AWD_DCU_UNIT, DCU_DATA2_IDX, (uint16_t)((uint32_t)u16LowThreshold << m_u32Shift));
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Re-enable the window interrupt after a violation.
+ * @param  None
+ * @retval None
+ */
+void ADC_AWD_Rearm(void)
+{
+    DCU_ClearStatus(ADC_AWD_DCU_UNIT, DCU_FLAG_ALL);
+    DCU_IntCmd(ADC_AWD_DCU_UNIT, DCU_CATEGORY_CMP_WIN, DCU_INT_CMP_WIN_OUTSIDE, Enable);
+}
+
+/**
+ * @brief  Get the number of window violations since initialization.
+ * @param  None
+ * @retval Number of violations reported
+ */
+uint32_t ADC_AWD_GetViolationCount(void)
+{
+    return m_u32ViolationCnt;
+}
+
+/**
+ * @brief  DCU interrupt handler of the threshold watch.
+ * @param  None
+ * @retval None
+ * @note   Disarms the watch so that a sustained fault raises one interrupt,
+ *         see ADC_AWD_Rearm().
+ */
+void ADC_AWD_DCU_IrqHandler(void)
+{
+    uint16_t u16Value;
+
+    if (Set == DCU_GetStatus(ADC_AWD_DCU_UNIT, ADC_AWD_FLAG_OUTSIDE))
+    {
+        DCU_IntCmd(ADC_AWD_DCU_UNIT, DCU_CATEGORY_CMP_WIN, DCU_INT_CMP_WIN_OUTSIDE, Disable);
+        u16Value = (uint16_t)(DCU_ReadData16(ADC_AWD_DCU_UNIT, DCU_DATA0_IDX) >> m_u32Shift);
+        DCU_ClearStatus(ADC_AWD_DCU_UNIT, DCU_FLAG_ALL);
+        m_u32ViolationCnt++;
+
+        if (m_pfnCallback != NULL)
+        {
+            m_pfnCallback(u16Value);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_AWD_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,741 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_dsp.c
+ * @brief This file provides fixed-point DSP kernels for ADC sample buffers.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_adc_dsp.h"
+#include "hc32m423_adc.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_ADC_DSP ADC_DSP
+ * @brief ADC Fixed-point DSP Kernels
+ * @details The kernels work on the right-aligned conversion code, whatever
+ *          the resolution and data alignment the ADC was configured with, see
+ *          ADC_DSP_BufInit(). Contiguous buffers (u32Stride == 1) take the
+ *          Cortex-M4 SIMD path, which handles two samples per instruction;
+ *          strided buffers and targets without the DSP extension take the
+ *          portable C path. Both paths use the same wrap-around integer
+ *          arithmetic, so they return the same results.
+ * @{
+ */
+
+#if (DDL_ADC_DSP_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_DSP_Local_Macros ADC_DSP Local Macros
+ * @{
+ */
+
+/* Sample u32Idx of a buffer as right-aligned code */
+#define ADC_DSP_SAMPLE(buf, idx)                                               \
+(   (uint32_t)(buf)->pu16Data[(idx) * (buf)->u32Stride] >> (buf)->u32Shift)
+
+/* Mask that clears the bits shifted across the half word boundary */
+#define ADC_DSP_PAIR_MASK(shift)        ((0xFFFFUL >> (shift)) * 0x00010001UL)
+
+#define ADC_DSP_PAIR_ONE                (0x00010001UL)
+
+#define ADC_DSP_MIN(a, b)               (((a) < (b)) ? (a) : (b))
+#define ADC_DSP_MAX(a, b)               (((a) > (b)) ? (a) : (b))
+
+#define ADC_DSP_Q14_ROUND               (1UL << 13U)
+#define ADC_DSP_Q15_ROUND               (1UL << 14U)
+
+#define ADC_DSP_RMS_FRAC_BITS           (8U)
+
+/**
+ * @defgroup ADC_DSP_Check_Parameters_Validity ADC_DSP Check Parameters Validity
+ * @{
+ */
+#define IS_ADC_DSP_RESOLUTION(x)                                               \
+(   ((x) == ADC_RESOLUTION_8BIT)            ||                                 \
+    ((x) == ADC_RESOLUTION_10BIT)           ||                                 \
+    ((x) == ADC_RESOLUTION_12BIT))
+
+#define IS_ADC_DSP_DATA_ALIGN(x)                                               \
+(   ((x) == ADC_DATA_ALIGN_LEFT)            ||                                 \
+    ((x) == ADC_DATA_ALIGN_RIGHT))
+
+#define IS_ADC_DSP_BUF(x)                                                      \
+(   ((x) != NULL)                           &&                                 \
+    ((x)->pu16Data != NULL)                 &&                                 \
+    ((x)->u32Len != 0UL)                    &&                                 \
+    ((x)->u32Len <= ADC_DSP_LEN_MAX)        &&                                 \
+    ((x)->u32Stride != 0UL)                 &&                                 \
+    ((x)->u32Shift < 16UL))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_DSP_Local_Functions
+ * @{
+ */
+static void ADC_DSP_SumSq(const stc_adc_dsp_buf_t *pstcBuf, uint32_t *pu32Sum, uint64_t *pu64SumSq);
+static uint32_t ADC_DSP_Sqrt64(uint64_t u64Val);
+static int16_t ADC_DSP_Sat16(int32_t i32Val);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_DSP_Global_Functions ADC_DSP Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Describe an ADC sample buffer.
+ * @param  [out] pstcBuf                Pointer to a stc_adc_dsp_buf_t structure.
+ * @param  [in] au16Data                First sample.
+ * @param  [in] u32Len                  Number of samples, 1 ~ ADC_DSP_LEN_MAX.
+ * @param  [in] u32Stride               Distance between samples in half words.
+ * @param  [in] u16Resolution           Resolution the samples were converted with.
+ *                                      This parameter can be one of the following values:
+ *   @arg  ADC_RESOLUTION_12BIT:        12 bit.
+ *   @arg  ADC_RESOLUTION_10BIT:        10 bit.
+ *   @arg  ADC_RESOLUTION_8BIT:         8 bit.
+ * @param  [in] u16DataAlign            Data alignment the samples were stored with.
+ *                                      This parameter can be one of the following values:
+ *   @arg  ADC_DATA_ALIGN_RIGHT:        Right alignment.
+ *   @arg  ADC_DATA_ALIGN_LEFT:         Left alignment.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid parameter
+ */
+en_result_t ADC_DSP_BufInit(stc_adc_dsp_buf_t *pstcBuf, const uint16_t au16Data[],
+                            uint32_t u32Len, uint32_t u32Stride,
+                            uint16_t u16Resolution, uint16_t u16DataAlign)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Bits;
+
+    if ((pstcBuf != NULL) && (au16Data != NULL) &&
+        (u32Len != 0UL) && (u32Len <= ADC_DSP_LEN_MAX) && (u32Stride != 0UL))
+    {
+        DDL_ASSERT(IS_ADC_DSP_RESOLUTION(u16Resolution));
+        DDL_ASSERT(IS_ADC_DSP_DATA_ALIGN(u16DataAlign));
+
+        if (ADC_RESOLUTION_8BIT == u16Resolution)
+        {
+            u32Bits = 8UL;
+        }
+        else if (ADC_RESOLUTION_10BIT == u16Resolution)
+        {
+            u32Bits = 10UL;
+        }
+        else
+        {
+            u32Bits = 12UL;
+        }
+
+        pstcBuf->pu16Data = au16Data;
+        pstcBuf->u32Len = u32Len;
+        pstcBuf->u32Stride = u32Stride;
+        pstcBuf->u32Shift = (ADC_DATA_ALIGN_LEFT == u16DataAlign) ? (16UL - u32Bits) : 0UL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Mean and population variance of a buffer.
+ * @param  [in] pstcBuf                 Pointer to a stc_adc_dsp_buf_t structure.
+ * @param  [out] pf32Mean               Mean in codes.
+ * @param  [out] pf32Var                Variance in codes squared, may be NULL.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid parameter
+ * @note   The sums are exact integers, only the final division is floating point.
+ */
+en_result_t ADC_DSP_MeanVar(const stc_adc_dsp_buf_t *pstcBuf, float32_t *pf32Mean, float32_t *pf32Var)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Sum;
+    uint64_t u64SumSq;
+    uint64_t u64Dev;
+
+    if (IS_ADC_DSP_BUF(pstcBuf) && (pf32Mean != NULL))
+    {
+        ADC_DSP_SumSq(pstcBuf, &u32Sum, &u64SumSq);
+        *pf32Mean = (float32_t)u32Sum / (float32_t)pstcBuf->u32Len;
+        if (pf32Var != NULL)
+        {
+            /* n * var = sum(x^2) - sum(x)^2 / n */
+            u64Dev = u64SumSq - (((uint64_t)u32Sum * u32Sum) / pstcBuf->u32Len);
+            *pf32Var = (float32_t)u64Dev / (float32_t)pstcBuf->u32Len;
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Root mean square of a buffer.
+ * @param  [in] pstcBuf                 Pointer to a stc_adc_dsp_buf_t structure.
+ * @retval RMS value in codes with a resolution of 1/256 code, 0.0 for an
+ *         invalid buffer.
+ * @note   The square root is computed with integers, no math library is needed.
+ */
+float32_t ADC_DSP_Rms(const stc_adc_dsp_buf_t *pstcBuf)
+{
+    float32_t f32Rms = 0.0F;
+    uint32_t u32Sum;
+    uint64_t u64SumSq;
+
+    if (IS_ADC_DSP_BUF(pstcBuf))
+    {
+        ADC_DSP_SumSq(pstcBuf, &u32Sum, &u64SumSq);
+        u64SumSq = (u64SumSq << (2U * ADC_DSP_RMS_FRAC_BITS)) / pstcBuf->u32Len;
+        f32Rms = (float32_t)ADC_DSP_Sqrt64(u64SumSq) / (float32_t)(1UL << ADC_DSP_RMS_FRAC_BITS);
+    }
+
+    return f32Rms;
+}
+
+/**
+ * @brief  Minimum and maximum of a buffer.
+ * @param  [in] pstcBuf                 Pointer to a stc_adc_dsp_buf_t structure.
+ * @param  [out] pstcPeak               Pointer to a stc_adc_dsp_peak_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid parameter
+ */
+en_result_t ADC_DSP_Peak(const stc_adc_dsp_buf_t *pstcBuf, stc_adc_dsp_peak_t *pstcPeak)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Min = 0xFFFFUL;
+    uint32_t u32Max = 0UL;
+    uint32_t u32Start = 0UL;
+    uint32_t u32Val;
+    uint32_t i;
+#if (ADC_DSP_USE_SIMD == 1U)
+    const uint32_t *pu32Pair;
+    uint32_t u32Mask;
+    uint32_t u32Pair;
+    uint32_t u32MinPair = 0xFFFFFFFFUL;
+    uint32_t u32MaxPair = 0UL;
+#endif
+
+    if (IS_ADC_DSP_BUF(pstcBuf) && (pstcPeak != NULL))
+    {
+#if (ADC_DSP_USE_SIMD == 1U)
+        if (1UL == pstcBuf->u32Stride)
+        {
+            /* Odd first sample keeps the pair loads word aligned */
+            if (0UL != ((uint32_t)pstcBuf->pu16Data & 2UL))
+            {
+                u32Min = ADC_DSP_SAMPLE(pstcBuf, 0UL);
+                u32Max = u32Min;
+                u32Start = 1UL;
+            }
+
+            pu32Pair = (const uint32_t *)&pstcBuf->pu16Data[u32Start];
+            u32Mask = ADC_DSP_PAIR_MASK(pstcBuf->u32Shift);
+            for (i = (pstcBuf->u32Len - u32Start) / 2UL; i > 0UL; i--)
+            {
+                u32Pair = (*pu32Pair++ >> pstcBuf->u32Shift) & u32Mask;
+                (void)__USUB16(u32Pair, u32MaxPair);
+                u32MaxPair = __SEL(u32Pair, u32MaxPair);
+                (void)__USUB16(u32MinPair, u32Pair);
+                u32MinPair = __SEL(u32Pair, u32MinPair);
+            }
+            u32Start += ((pstcBuf->u32Len - u32Start) & ~1UL);
+
+            u32Min = ADC_DSP_MIN(u32Min, ADC_DSP_MIN(u32MinPair & 0xFFFFUL, u32MinPair >> 16U));
+            u32Max = ADC_DSP_MAX(u32Max, ADC_DSP_MAX(u32MaxPair & 0xFFFFUL, u32MaxPair >> 16U));
+        }
+#endif
+        for (i = u32Start; i < pstcBuf->u32Len; i++)
+        {
+            u32Val = ADC_DSP_SAMPLE(pstcBuf, i);
+            u32Min = ADC_DSP_MIN(u32Min, u32Val);
+            u32Max = ADC_DSP_MAX(u32Max, u32Val);
+        }
+
+        /* Locate the first occurrence of each */
+        pstcPeak->u16Min = (uint16_t)u32Min;
+        pstcPeak->u16Max = (uint16_t)u32Max;
+        pstcPeak->u32MinIdx = 0UL;
+        while (ADC_DSP_SAMPLE(pstcBuf, pstcPeak->u32MinIdx) != u32Min)
+        {
+            pstcPeak->u32MinIdx++;
+        }
+        pstcPeak->u32MaxIdx = 0UL;
+        while (ADC_DSP_SAMPLE(pstcBuf, pstcPeak->u32MaxIdx) != u32Max)
+        {
+            pstcPeak->u32MaxIdx++;
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Moving average (boxcar) filter.
+ * @param  [in] pstcBuf                 Pointer to a stc_adc_dsp_buf_t structure.
+ * @param  [in] u32Win                  Window length, 1 ~ ADC_DSP_LEN_MAX.
+ * @param  [out] au16Out                Filtered codes, pstcBuf->u32Len half words.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid parameter
+ * @note   The first u32Win - 1 outputs average over the samples available so
+ *         far. A running sum keeps the cost at one add and one subtract per
+ *         sample whatever the window, and a power of two window divides by
+ *         shifting.
+ */
+en_result_t ADC_DSP_MovingAverage(const stc_adc_dsp_buf_t *pstcBuf, uint32_t u32Win, uint16_t au16Out[])
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Sum = 0UL;
+    uint32_t u32WinShift = 0UL;
+    uint32_t i;
+
+    if (IS_ADC_DSP_BUF(pstcBuf) && (au16Out != NULL) &&
+        (u32Win != 0UL) && (u32Win <= ADC_DSP_LEN_MAX))
+    {
+        while ((1UL << u32WinShift) < u32Win)
+        {
+            u32WinShift++;
+        }
+
+        for (i = 0UL; i < pstcBuf->u32Len; i++)
+        {
+            u32Sum += ADC_DSP_SAMPLE(pstcBuf, i);
+            if (i < u32Win)
+            {
+                au16Out[i] = (uint16_t)((u32Sum + ((i + 1UL) / 2UL)) / (i + 1UL));
+            }
+            else
+            {
+                u32Sum -= ADC_DSP_SAMPLE(pstcBuf, i - u32Win);
+                if ((1UL << u32WinShift) == u32Win)
+                {
+                    au16Out[i] = (uint16_t)((u32Sum + (u32Win / 2UL)) >> u32WinShift);
+                }
+                else
+                {
+                    au16Out[i] = (uint16_t)((u32Sum + (u32Win / 2UL)) / u32Win);
+                }
+            }
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the coefficients of a biquad section and clear its state.
+ * @param  [out] pstcBiquad             Pointer to a stc_adc_dsp_biquad_t structure.
+ * @param  [in] ai16Coef                b0, b1, b2, a1, a2 in Q14.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid parameter
+ */
+en_result_t ADC_DSP_BiquadInit(stc_adc_dsp_biquad_t *pstcBiquad, const int16_t ai16Coef[])
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t i;
+
+    /* -a1 is used as a 16-bit multiplier */
+    if ((pstcBiquad != NULL) && (ai16Coef != NULL) && (ai16Coef[3U] != INT16_MIN))
+    {
+        for (i = 0UL; i < 5UL; i++)
+        {
+            pstcBiquad->ai16Coef[i] = ai16Coef[i];
+        }
+        pstcBiquad->i16X1 = 0;
+        pstcBiquad->i16X2 = 0;
+        pstcBiquad->i16Y1 = 0;
+        pstcBiquad->i16Y2 = 0;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Biquad IIR filter.
+ * @param  [in,out] pstcBiquad          Pointer to a stc_adc_dsp_biquad_t structure,
+ *                                      the state carries over to the next block.
+ * @param  [in] pstcBuf                 Pointer to a stc_adc_dsp_buf_t structure.
+ * @param  [out] ai16Out                Filtered codes, saturated to 16 bits,
+ *                                      pstcBuf->u32Len half words.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid parameter
+ */
+en_result_t ADC_DSP_Biquad(stc_adc_dsp_biquad_t *pstcBiquad, const stc_adc_dsp_buf_t *pstcBuf, int16_t ai16Out[])
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    int32_t i32X0;
+    int32_t i32X1;
+    int32_t i32X2;
+    int32_t i32Y1;
+    int32_t i32Y2;
+    uint32_t u32Acc;
+    uint32_t i;
+#if (ADC_DSP_USE_SIMD == 1U)
+    uint32_t u32B0B1;
+    uint32_t u32B2A1;
+#endif
+
+    if ((pstcBiquad != NULL) && IS_ADC_DSP_BUF(pstcBuf) && (ai16Out != NULL))
+    {
+        i32X1 = pstcBiquad->i16X1;
+        i32X2 = pstcBiquad->i16X2;
+        i32Y1 = pstcBiquad->i16Y1;
+        i32Y2 = pstcBiquad->i16Y2;
+#if (ADC_DSP_USE_SIMD == 1U)
+        u32B0B1 = __PKHBT((uint32_t)(uint16_t)pstcBiquad->ai16Coef[0U],
+                          (uint32_t)(uint16_t)pstcBiquad->ai16Coef[1U], 16);
+        u32B2A1 = __PKHBT((uint32_t)(uint16_t)pstcBiquad->ai16Coef[2U],
+                          (uint32_t)(uint16_t)(-pstcBiquad->ai16Coef[3U]), 16);
+#endif
+
+        for (i = 0UL; i < pstcBuf->u32Len; i++)
+        {
+            i32X0 = (int32_t)ADC_DSP_SAMPLE(pstcBuf, i);
+#if (ADC_DSP_USE_SIMD == 1U)
+            u32Acc = __SMLAD(__PKHBT((uint32_t)i32X0, (uint32_t)i32X1, 16), u32B0B1, ADC_DSP_Q14_ROUND);
+            u32Acc = __SMLAD(__PKHBT((uint32_t)i32X2, (uint32_t)i32Y1, 16), u32B2A1, u32Acc);
+#else
+            u32Acc = ADC_DSP_Q14_ROUND;
+            u32Acc += (uint32_t)(pstcBiquad->ai16Coef[0U] * i32X0);
+            u32Acc += (uint32_t)(pstcBiquad->ai16Coef[1U] * i32X1);
+            u32Acc += (uint32_t)(pstcBiquad->ai16Coef[2U] * i32X2);
+            u32Acc -= (uint32_t)(pstcBiquad->ai16Coef[3U] * i32Y1);
+#endif
+            u32Acc -= (uint32_t)(pstcBiquad->ai16Coef[4U] * i32Y2);
+
+            i32X2 = i32X1;
+            i32X1 = i32X0;
+            i32Y2 = i32Y1;
+            i32Y1 = ADC_DSP_Sat16((int32_t)u32Acc >> 14U);
+            ai16Out[i] = (int16_t)i32Y1;
+        }
+
+        pstcBiquad->i16X1 = (int16_t)i32X1;
+        pstcBiquad->i16X2 = (int16_t)i32X2;
+        pstcBiquad->i16Y1 = (int16_t)i32Y1;
+        pstcBiquad->i16Y2 = (int16_t)i32Y2;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Decimating FIR filter over one block.
+ * @param  [in] pstcFir                 Pointer to a stc_adc_dsp_fir_t structure.
+ * @param  [in] pstcBuf                 Pointer to a stc_adc_dsp_buf_t structure.
+ * @param  [out] ai16Out                Filtered codes, saturated to 16 bits.
+ *                                      (u32Len - u32TapNum) / u32Factor + 1 half words.
+ * @param  [out] pu32OutLen             Number of outputs written, 0 when the
+ *                                      block is shorter than the filter.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid parameter
+ * @note   Output k is sum(h[j] * x[k * u32Factor + j]), only the outputs kept
+ *         by the decimation are computed. The filter keeps no state between
+ *         blocks; overlap the blocks by u32TapNum - 1 samples for a continuous
+ *         stream.
+ */
+en_result_t ADC_DSP_FirDecimate(const stc_adc_dsp_fir_t *pstcFir, const stc_adc_dsp_buf_t *pstcBuf,
+                                int16_t ai16Out[], uint32_t *pu32OutLen)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32OutLen = 0UL;
+    uint32_t u32Base;
+    uint32_t u32Acc;
+    uint32_t j;
+#if (ADC_DSP_USE_SIMD == 1U)
+    uint32_t u32Mask;
+    uint32_t u32Pair;
+#endif
+
+    if ((pstcFir != NULL) && (pstcFir->pi16Coef != NULL) &&
+        (pstcFir->u32TapNum != 0UL) && (pstcFir->u32Factor != 0UL) &&
+        IS_ADC_DSP_BUF(pstcBuf) && (ai16Out != NULL) && (pu32OutLen != NULL))
+    {
+#if (ADC_DSP_USE_SIMD == 1U)
+        u32Mask = ADC_DSP_PAIR_MASK(pstcBuf->u32Shift);
+#endif
+        for (u32Base = 0UL; (u32Base + pstcFir->u32TapNum) <= pstcBuf->u32Len; u32Base += pstcFir->u32Factor)
+        {
+            u32Acc = ADC_DSP_Q15_ROUND;
+            j = 0UL;
+#if (ADC_DSP_USE_SIMD == 1U)
+            if (1UL == pstcBuf->u32Stride)
+            {
+                for (; (j + 1UL) < pstcFir->u32TapNum; j += 2UL)
+                {
+                    u32Pair = (__UNALIGNED_UINT32_READ(&pstcBuf->pu16Data[u32Base + j]) >> pstcBuf->u32Shift) & u32Mask;
+                    u32Acc = __SMLAD(u32Pair, __UNALIGNED_UINT32_READ(&pstcFir->pi16Coef[j]), u32Acc);
+                }
+            }
+#endif
+            for (; j < pstcFir->u32TapNum; j++)
+            {
+                u32Acc += (uint32_t)(pstcFir->pi16Coef[j] * (int32_t)ADC_DSP_SAMPLE(pstcBuf, u32Base + j));
+            }
+            ai16Out[u32OutLen] = ADC_DSP_Sat16((int32_t)u32Acc >> 15U);
+            u32OutLen++;
+        }
+        *pu32OutLen = u32OutLen;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+/**
+ * @brief  Measure the cycles each kernel takes on a buffer.
+ * @param  [in] pstcBuf                 Pointer to a stc_adc_dsp_buf_t structure.
+ * @param  [out] ai16Work               Scratch output, pstcBuf->u32Len half words.
+ * @param  [out] pstcBench              Pointer to a stc_adc_dsp_bench_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid parameter
+ * @note   Counts come from the DWT cycle counter and include the call
+ *         overhead. Run once with a contiguous and once with a strided buffer
+ *         to compare the SIMD and the portable paths on the same build.
+ */
+en_result_t ADC_DSP_Benchmark(const stc_adc_dsp_buf_t *pstcBuf, int16_t ai16Work[],
+                              stc_adc_dsp_bench_t *pstcBench)
+{
+    /* 2nd order Butterworth low pass, fc = fs / 10 */
+    const int16_t ai16Lpf[5U] = {1106, 2210, 1106, -18727, 6763};
+    /* 16 tap boxcar, unity gain */
+    const int16_t ai16Box[16U] = {2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048,
+                                  2048, 2048, 2048, 2048, 2048, 2048, 2048, 2048};
+    const stc_adc_dsp_fir_t stcFir = {ai16Box, 16UL, 4UL};
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_adc_dsp_biquad_t stcBiquad;
+    stc_adc_dsp_peak_t stcPeak;
+    float32_t f32Mean;
+    float32_t f32Var;
+    uint32_t u32OutLen;
+    uint32_t u32Start;
+
+    if (IS_ADC_DSP_BUF(pstcBuf) && (ai16Work != NULL) && (pstcBench != NULL))
+    {
+        (void)ADC_DSP_BiquadInit(&stcBiquad, ai16Lpf);
+
+        u32Start = DDL_GetCycleCount();
+        (void)ADC_DSP_MeanVar(pstcBuf, &f32Mean, &f32Var);
+        pstcBench->u32MeanVar = DDL_GetCycleCount() - u32Start;
+
+        u32Start = DDL_GetCycleCount();
+        (void)ADC_DSP_Rms(pstcBuf);
+        pstcBench->u32Rms = DDL_GetCycleCount() - u32Start;
+
+        u32Start = DDL_GetCycleCount();
+        (void)ADC_DSP_Peak(pstcBuf, &stcPeak);
+        pstcBench->u32Peak = DDL_GetCycleCount() - u32Start;
+
+        u32Start = DDL_GetCycleCount();
+        (void)ADC_DSP_MovingAverage(pstcBuf, 8UL, (uint16_t *)ai16Work);
+        pstcBench->u32MovingAverage = DDL_GetCycleCount() - u32Start;
+
+        u32Start = DDL_GetCycleCount();
+        (void)ADC_DSP_Biquad(&stcBiquad, pstcBuf, ai16Work);
+        pstcBench->u32Biquad = DDL_GetCycleCount() - u32Start;
+
+        u32Start = DDL_GetCycleCount();
+        (void)ADC_DSP_FirDecimate(&stcFir, pstcBuf, ai16Work, &u32OutLen);
+        pstcBench->u32FirDecimate = DDL_GetCycleCount() - u32Start;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+#endif /* DDL_UTILITY_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_DSP_Local_Functions ADC_DSP Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Sum and sum of squares of a buffer.
+ * @param  [in] pstcBuf                 Pointer to a stc_adc_dsp_buf_t structure.
+ * @param  [out] pu32Sum                Sum of the codes.
+ * @param  [out] pu64SumSq              Sum of the squared codes.
+ * @retval None
+ */
+static void ADC_DSP_SumSq(const stc_adc_dsp_buf_t *pstcBuf, uint32_t *pu32Sum, uint64_t *pu64SumSq)
+{
+    uint32_t u32Sum = 0UL;
+    uint64_t u64SumSq = 0ULL;
+    uint32_t u32Start = 0UL;
+    uint32_t u32Val;
+    uint32_t i;
+#if (ADC_DSP_USE_SIMD == 1U)
+    const uint32_t *pu32Pair;
+    uint32_t u32Mask;
+    uint32_t u32Pair;
+
+    if (1UL == pstcBuf->u32Stride)
+    {
+        /* Odd first sample keeps the pair loads word aligned */
+        if (0UL != ((uint32_t)pstcBuf->pu16Data & 2UL))
+        {
+            u32Sum = ADC_DSP_SAMPLE(pstcBuf, 0UL);
+            u64SumSq = (uint64_t)u32Sum * u32Sum;
+            u32Start = 1UL;
+        }
+
+        pu32Pair = (const uint32_t *)&pstcBuf->pu16Data[u32Start];
+        u32Mask = ADC_DSP_PAIR_MASK(pstcBuf->u32Shift);
+        for (i = (pstcBuf->u32Len - u32Start) / 2UL; i > 0UL; i--)
+        {
+            u32Pair = (*pu32Pair++ >> pstcBuf->u32Shift) & u32Mask;
+            u32Sum = __SMLAD(u32Pair, ADC_DSP_PAIR_ONE, u32Sum);
+            u64SumSq = __SMLALD(u32Pair, u32Pair, u64SumSq);
+        }
+        u32Start += ((pstcBuf->u32Len - u32Start) & ~1UL);
+    }
+#endif
+    for (i = u32Start; i < pstcBuf->u32Len; i++)
+    {
+        u32Val = ADC_DSP_SAMPLE(pstcBuf, i);
+        u32Sum += u32Val;
+        u64SumSq += (uint64_t)(u32Val * u32Val);
+    }
+
+    *pu32Sum = u32Sum;
+    *pu64SumSq = u64SumSq;
+}
+
+/**
+ * @brief  Integer square root, rounded down.
+ * @param  [in] u64Val                  Radicand.
+ * @retval floor(sqrt(u64Val))
+ */
+static uint32_t ADC_DSP_Sqrt64(uint64_t u64Val)
+{
+    uint64_t u64Root = 0ULL;
+    uint64_t u64Bit = 1ULL << 62U;
+
+    while (u64Bit > u64Val)
+    {
+        u64Bit >>= 2U;
+    }
+
+    while (u64Bit != 0ULL)
+    {
+        if (u64Val >= (u64Root + u64Bit))
+        {
+            u64Val -= (u64Root + u64Bit);
+            u64Root = (u64Root >> 1U) + u64Bit;
+        }
+        else
+        {
+            u64Root >>= 1U;
+        }
+        u64Bit >>= 2U;
+    }
+
+    return (uint32_t)u64Root;
+}
+
+/**
+ * @brief  Saturate to the int16_t range.
+ * @param  [in] i32Val                  Value.
+ * @retval Saturated value.
+ */
+static int16_t ADC_DSP_Sat16(int32_t i32Val)
+{
+    int16_t i16Ret;
+
+    if (i32Val > INT16_MAX)
+    {
+        i16Ret = INT16_MAX;
+    }
+    else if (i32Val < INT16_MIN)
+    {
+        i16Ret = INT16_MIN;
+    }
+    else
+    {
+        i16Ret = (int16_t)i32Val;
+    }
+
+    return i16Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_DSP_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
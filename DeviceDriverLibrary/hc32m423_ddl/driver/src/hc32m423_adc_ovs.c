@@ -0,0 +1,398 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_ovs.c
+ * @brief This file provides firmware functions to oversample and decimate
+ *        the ADC stream for extra resolution.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_adc_ovs.h"
+#include "hc32m423_adc_stream.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_ADC_OVS ADC_OVS
+ * @brief ADC Oversampling and Decimation Driver Library
+ * @details Two stages process the sequence A channels: the hardware
+ *          averager (ADC_SetAverageCount()) first combines conversions of a
+ *          channel into one stored sample, then the software stage sums the
+ *          stored samples of each channel over its own decimation length and
+ *          rescales the sum to the requested bit depth. The averager returns
+ *          the native resolution, so it only lowers the noise; the extra bits
+ *          come from the decimation alone.
+ *          The samples arrive in blocks through the ADC_STREAM half buffer
+ *          callback: set stc_adc_stream_init_t::pfnHalfCallback to
+ *          ADC_OVS_HalfCallback() (directly or through ADC_SCHED), so there is
+ *          no per-conversion interrupt.
+ *          The ADC resolution and data alignment are read back from the ADC
+ *          at ADC_OVS_Init(), so configure the ADC first.
+ * @{
+ */
+
+#if (DDL_ADC_OVS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_OVS_Local_Macros ADC_OVS Local Macros
+ * @{
+ */
+#define ADC_OVS_ADC_UNIT                (CM_ADC)
+#define ADC_OVS_CH_NUM                  (ADC_CH_NUM_MAX + 1U)
+
+
+/**
+ * @defgroup ADC_OVS_Check_Parameters_Validity ADC_OVS Check Parameters Validity
+ * @{
+ */
+#define IS_ADC_OVS_AVG_CNT(x)           (((x) & (uint16_t)(~ADC_CR0_AVCNT)) == 0U)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_OVS_Local_Variables ADC_OVS Local Variables
+ * @{
+ */
+static uint32_t m_u32Ch = 0UL;
+static uint32_t m_u32AvgCh = 0UL;
+static uint32_t m_u32ScanLen = 0UL;
+static uint32_t m_u32Shift = 0UL;
+static uint32_t m_u32BaseBits = 12UL;
+static func_ptr_adc_ovs_output_t m_pfnOutput = NULL;
+
+/* Active channels in scan order */
+static uint32_t m_u32ActiveNum = 0UL;
+static uint8_t m_au8ChNum[ADC_OVS_CH_NUM];
+static uint8_t m_au8Offset[ADC_OVS_CH_NUM];
+
+static stc_adc_ovs_ch_t m_astcCh[ADC_OVS_CH_NUM];
+static uint32_t m_au32Sum[ADC_OVS_CH_NUM];
+static uint32_t m_au32Cnt[ADC_OVS_CH_NUM];
+static __IO uint16_t m_au16Value[ADC_OVS_CH_NUM];
+static __IO uint32_t m_u32ValidCh = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_OVS_Global_Functions ADC_OVS Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_adc_ovs_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_adc_ovs_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t ADC_OVS_StructInit(stc_adc_ovs_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t i;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32Ch = 0UL;
+        pstcInit->u32AvgCh = 0UL;
+        pstcInit->u16AvgCount = ADC_AVG_CNT2;
+        for (i = 0UL; i < ADC_OVS_CH_NUM; i++)
+        {
+            pstcInit->astcCh[i].u32ExtraBits = 0UL;
+            pstcInit->astcCh[i].u32Decimation = 1UL;
+        }
+        pstcInit->pfnOutput = NULL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the oversampling stages.
+ * @param  [in] pstcInit                Pointer to a stc_adc_ovs_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration, or the
+ *                                      oversampling ratio of a channel is too
+ *                                      low for its extra bits
+ * @note   u32Ch must match the channels of the ADC stream. Call while the
+ *         stream is stopped.
+ */
+en_result_t ADC_OVS_Init(const stc_adc_ovs_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    const stc_adc_ovs_ch_t *pstcCh;
+    uint32_t u32Ch;
+    uint32_t u32FirstChNum = 0UL;
+    uint16_t u16Cfg;
+    uint32_t i;
+
+    if ((pstcInit != NULL) && ((pstcInit->u32Ch & (uint32_t)ADC_CH_ALL) != 0UL))
+    {
+        DDL_ASSERT(IS_ADC_OVS_AVG_CNT(pstcInit->u16AvgCount));
+
+        u32Ch = pstcInit->u32Ch & (uint32_t)ADC_CH_ALL;
+        enRet = Ok;
+        for (i = 0UL; i < ADC_OVS_CH_NUM; i++)
+        {
+            if ((u32Ch & (1UL << i)) != 0UL)
+            {
+                pstcCh = &pstcInit->astcCh[i];
+                if ((pstcCh->u32Decimation == 0UL) ||
+                    (pstcCh->u32Decimation > ADC_OVS_DECIMATION_MAX) ||
+                    (pstcCh->u32ExtraBits > ADC_OVS_EXTRA_BITS_MAX) ||
+                    (pstcCh->u32Decimation < (1UL << (2UL * pstcCh->u32ExtraBits))))
+                {
+                    enRet = ErrorInvalidParameter;
+                }
+            }
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        m_u32Ch = u32Ch;
+        m_u32AvgCh = pstcInit->u32AvgCh & u32Ch;
+        m_u32ScanLen = ADC_STREAM_GetScanLen(u32Ch);
+        m_pfnOutput = pstcInit->pfnOutput;
+
+        /* Right-align the stored samples */
+        u16Cfg = READ_REG16_BIT(ADC_OVS_ADC_UNIT->CR0, ADC_CR0_ACCSEL);
+        if (ADC_RESOLUTION_8BIT == u16Cfg)
+        {
+            m_u32BaseBits = 8UL;
+        }
+        else if (ADC_RESOLUTION_10BIT == u16Cfg)
+        {
+            m_u32BaseBits = 10UL;
+        }
+        else
+        {
+            m_u32BaseBits = 12UL;
+        }
+        m_u32Shift = 0UL;
+        if (0U != READ_REG16_BIT(ADC_OVS_ADC_UNIT->CR0, ADC_CR0_DFMT))
+        {
+            m_u32Shift = 16UL - m_u32BaseBits;
+        }
+
+        while ((u32Ch & (1UL << u32FirstChNum)) == 0UL)
+        {
+            u32FirstChNum++;
+        }
+        m_u32ActiveNum = 0UL;
+        for (i = 0UL; i < ADC_OVS_CH_NUM; i++)
+        {
+            m_astcCh[i] = pstcInit->astcCh[i];
+            if ((u32Ch & (1UL << i)) != 0UL)
+            {
+                m_au8ChNum[m_u32ActiveNum] = (uint8_t)i;
+                m_au8Offset[m_u32ActiveNum] = (uint8_t)(i - u32FirstChNum);
+                m_u32ActiveNum++;
+            }
+        }
+        ADC_OVS_Reset();
+
+        /* Hardware stage */
+        ADC_SetAverageCount(ADC_OVS_ADC_UNIT, pstcInit->u16AvgCount);
+        ADC_AverageChCmd(ADC_OVS_ADC_UNIT, (uint32_t)ADC_CH_ALL, Disable);
+        if (m_u32AvgCh != 0UL)
+        {
+            ADC_AverageChCmd(ADC_OVS_ADC_UNIT, m_u32AvgCh, Enable);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the oversampling stages and release the hardware averager.
+ * @param  None
+ * @retval None
+ */
+void ADC_OVS_DeInit(void)
+{
+    if (m_u32AvgCh != 0UL)
+    {
+        ADC_AverageChCmd(ADC_OVS_ADC_UNIT, m_u32AvgCh, Disable);
+    }
+    m_u32Ch = 0UL;
+    m_u32AvgCh = 0UL;
+    m_u32ActiveNum = 0UL;
+    m_pfnOutput = NULL;
+    ADC_OVS_Reset();
+}
+
+/**
+ * @brief  Discard the partial sums and the last outputs.
+ * @param  None
+ * @retval None
+ * @note   Call while the stream is stopped, e.g. after a change of input.
+ */
+void ADC_OVS_Reset(void)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < ADC_OVS_CH_NUM; i++)
+    {
+        m_au32Sum[i] = 0UL;
+        m_au32Cnt[i] = 0UL;
+        m_au16Value[i] = 0U;
+    }
+    m_u32ValidCh = 0UL;
+}
+
+/**
+ * @brief  Get the last output of a channel.
+ * @param  [in] u32ChNum                Channel number, 0 ~ ADC_CH_NUM_MAX.
+ * @param  [out] pu16Value              Last output, ADC_OVS_GetBitDepth() bits.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorNotReady:               No output since the last reset
+ *   @arg  ErrorInvalidParameter:       Invalid parameter
+ */
+en_result_t ADC_OVS_GetValue(uint32_t u32ChNum, uint16_t *pu16Value)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((u32ChNum < ADC_OVS_CH_NUM) && (pu16Value != NULL) &&
+        ((m_u32Ch & (1UL << u32ChNum)) != 0UL))
+    {
+        enRet = ErrorNotReady;
+        if ((m_u32ValidCh & (1UL << u32ChNum)) != 0UL)
+        {
+            *pu16Value = m_au16Value[u32ChNum];
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the output bit depth of a channel.
+ * @param  [in] u32ChNum                Channel number, 0 ~ ADC_CH_NUM_MAX.
+ * @retval ADC resolution plus the extra bits, 0 if the channel is not used.
+ */
+uint32_t ADC_OVS_GetBitDepth(uint32_t u32ChNum)
+{
+    uint32_t u32Bits = 0UL;
+
+    if ((u32ChNum < ADC_OVS_CH_NUM) && ((m_u32Ch & (1UL << u32ChNum)) != 0UL))
+    {
+        u32Bits = m_u32BaseBits + m_astcCh[u32ChNum].u32ExtraBits;
+    }
+
+    return u32Bits;
+}
+
+/**
+ * @brief  Software stage, to be installed as the ADC stream half buffer callback.
+ * @param  [in] u32Half                 Index of the completed half, unused.
+ * @param  [in] au16Data                First scan of the completed half.
+ * @param  [in] u32ScanNum              Number of scans in the half.
+ * @retval None
+ */
+void ADC_OVS_HalfCallback(uint32_t u32Half, const uint16_t au16Data[], uint32_t u32ScanNum)
+{
+    const uint16_t *pu16Scan = au16Data;
+    const stc_adc_ovs_ch_t *pstcCh;
+    uint32_t u32ChNum;
+    uint32_t u32Value;
+    uint32_t u32Scan;
+    uint32_t i;
+
+    (void)u32Half;
+    for (u32Scan = 0UL; u32Scan < u32ScanNum; u32Scan++)
+    {
+        for (i = 0UL; i < m_u32ActiveNum; i++)
+        {
+            u32ChNum = m_au8ChNum[i];
+            m_au32Sum[u32ChNum] += (uint32_t)pu16Scan[m_au8Offset[i]] >> m_u32Shift;
+            m_au32Cnt[u32ChNum]++;
+
+            pstcCh = &m_astcCh[u32ChNum];
+            if (m_au32Cnt[u32ChNum] >= pstcCh->u32Decimation)
+            {
+                /* sum * 2^extra / D, rounded */
+                u32Value = ((m_au32Sum[u32ChNum] << pstcCh->u32ExtraBits) +
+                            (pstcCh->u32Decimation / 2UL)) / pstcCh->u32Decimation;
+                m_au32Sum[u32ChNum] = 0UL;
+                m_au32Cnt[u32ChNum] = 0UL;
+
+                m_au16Value[u32ChNum] = (uint16_t)u32Value;
+                m_u32ValidCh |= (1UL << u32ChNum);
+                if (m_pfnOutput != NULL)
+                {
+                    m_pfnOutput(u32ChNum, (uint16_t)u32Value);
+                }
+            }
+        }
+        pu16Scan = &pu16Scan[m_u32ScanLen];
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_OVS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
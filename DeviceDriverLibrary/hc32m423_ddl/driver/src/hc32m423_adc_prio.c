@@ -0,0 +1,521 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_prio.c
+ * @brief This file provides firmware functions to schedule high priority
+ *        sequence B bursts over background sequence A scans.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_adc_prio.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_ADC_PRIO ADC_PRIO
+ * @brief ADC Sequence A/B Priority Scheduler Driver Library
+ * @details Sequence B carries the high priority channels and is started by a
+ *          hardware event; sequence A carries the background channels and is
+ *          started by ADC_PRIO_TriggerBackground(). A sequence B trigger that
+ *          arrives during a sequence A scan preempts it (ADC_SEQ_FLAG_NESTED),
+ *          and sequence A then resumes as selected by u16SAResumePos.
+ *          The two channel sets are disjoint, so each sequence keeps its own
+ *          data registers and the results are copied, in channel order, to
+ *          separate buffers from the EOCB and EOCA interrupts. Every scan gets
+ *          a completion order number shared by both sequences.
+ *          When background scans restart from the first channel after each
+ *          preemption, frequent bursts could starve them; after u32MaxRestart
+ *          preemptions the scan is switched to resume from the interrupted
+ *          channel until it completes.
+ *          The application enables the ADC function clock, calls ADC_Init()
+ *          and calls the two handlers from ADC_SeqA_IrqHandler() and
+ *          ADC_SeqB_IrqHandler().
+ * @{
+ */
+
+#if (DDL_ADC_PRIO_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_PRIO_Local_Macros ADC_PRIO Local Macros
+ * @{
+ */
+#define ADC_PRIO_ADC_UNIT               (CM_ADC)
+
+/**
+ * @defgroup ADC_PRIO_Check_Parameters_Validity ADC_PRIO Check Parameters Validity
+ * @{
+ */
+#define IS_ADC_PRIO_RESUME_POS(x)                                              \
+(   ((x) == ADC_SA_RESUME_POS_INT_CH)           ||                             \
+    ((x) == ADC_SA_RESUME_POS_FIRST_CH))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_PRIO_Local_Functions
+ * @{
+ */
+static uint32_t ADC_PRIO_ChList(uint32_t u32Ch, uint8_t au8ChNum[]);
+static void ADC_PRIO_ReadData(const uint8_t au8ChNum[], uint32_t u32ChCnt, uint16_t au16Data[]);
+static void ADC_PRIO_Preempted(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_PRIO_Local_Variables ADC_PRIO Local Variables
+ * @{
+ */
+static uint8_t m_au8HpChNum[ADC_CH_CNT];
+static uint32_t m_u32HpChCnt = 0UL;
+static uint16_t *m_pu16HpBuf = NULL;
+static uint32_t m_u32HpDepth = 0UL;
+static uint32_t m_u32HpWrIdx = 0UL;
+static func_ptr_adc_prio_scan_t m_pfnHpCallback = NULL;
+
+static uint8_t m_au8BgChNum[ADC_CH_CNT];
+static uint32_t m_u32BgChCnt = 0UL;
+static uint16_t *m_pu16BgBuf = NULL;
+static func_ptr_adc_prio_scan_t m_pfnBgCallback = NULL;
+static __IO uint32_t m_u32BgBusy = 0UL;
+
+static uint16_t m_u16ResumePos = ADC_SA_RESUME_POS_INT_CH;
+static uint32_t m_u32MaxRestart = 0UL;
+static uint32_t m_u32PreemptCnt = 0UL;
+static uint32_t m_u32Order = 0UL;
+static stc_adc_prio_stat_t m_stcStat;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_PRIO_Global_Functions ADC_PRIO Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_adc_prio_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_adc_prio_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t ADC_PRIO_StructInit(stc_adc_prio_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32HpCh = 0UL;
+        pstcInit->pu8HpSampleTime = NULL;
+        (void)ADC_TriggerSrcStructInit(&pstcInit->stcHpTrigger);
+        pstcInit->pu16HpBuf = NULL;
+        pstcInit->u32HpDepth = 1UL;
+        pstcInit->u32HpIrqPriority = DDL_IRQ_PRI01;
+        pstcInit->pfnHpCallback = NULL;
+        pstcInit->u32BgCh = 0UL;
+        pstcInit->pu8BgSampleTime = NULL;
+        pstcInit->pu16BgBuf = NULL;
+        pstcInit->u32BgIrqPriority = DDL_IRQ_PRI03;
+        pstcInit->pfnBgCallback = NULL;
+        pstcInit->u16SAResumePos = ADC_SA_RESUME_POS_INT_CH;
+        pstcInit->u32MaxRestart = 2UL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize both sequences, the sequence B trigger and the interrupts.
+ * @param  [in] pstcInit                Pointer to a stc_adc_prio_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration, or the two
+ *                                      channel sets overlap
+ * @note   Sets the scan mode to ADC_MD_SA_SB_SSHOT.
+ */
+en_result_t ADC_PRIO_Init(const stc_adc_prio_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32HpCh;
+    uint32_t u32BgCh;
+
+    if ((pstcInit != NULL) &&
+        (pstcInit->pu8HpSampleTime != NULL) && (pstcInit->pu16HpBuf != NULL) &&
+        (pstcInit->u32HpDepth != 0UL) &&
+        (pstcInit->pu8BgSampleTime != NULL) && (pstcInit->pu16BgBuf != NULL))
+    {
+        DDL_ASSERT(IS_ADC_PRIO_RESUME_POS(pstcInit->u16SAResumePos));
+
+        u32HpCh = pstcInit->u32HpCh & (uint32_t)ADC_CH_ALL;
+        u32BgCh = pstcInit->u32BgCh & (uint32_t)ADC_CH_ALL;
+        if ((u32HpCh != 0UL) && (u32BgCh != 0UL) && ((u32HpCh & u32BgCh) == 0UL))
+        {
+            enRet = Ok;
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        m_u32HpChCnt = ADC_PRIO_ChList(u32HpCh, m_au8HpChNum);
+        m_pu16HpBuf = pstcInit->pu16HpBuf;
+        m_u32HpDepth = pstcInit->u32HpDepth;
+        m_pfnHpCallback = pstcInit->pfnHpCallback;
+        m_u32BgChCnt = ADC_PRIO_ChList(u32BgCh, m_au8BgChNum);
+        m_pu16BgBuf = pstcInit->pu16BgBuf;
+        m_pfnBgCallback = pstcInit->pfnBgCallback;
+        m_u16ResumePos = pstcInit->u16SAResumePos;
+        m_u32MaxRestart = pstcInit->u32MaxRestart;
+
+        m_u32HpWrIdx = 0UL;
+        m_u32BgBusy = 0UL;
+        m_u32PreemptCnt = 0UL;
+        m_u32Order = 0UL;
+        m_stcStat.u32HpScanCnt = 0UL;
+        m_stcStat.u32BgScanCnt = 0UL;
+        m_stcStat.u32NestedCnt = 0UL;
+        m_stcStat.u32MaxPreemptCnt = 0UL;
+
+        ADC_SetScanMode(ADC_PRIO_ADC_UNIT, ADC_MD_SA_SB_SSHOT);
+        MODIFY_REG16(ADC_PRIO_ADC_UNIT->CR1, ADC_CR1_RSCHSEL, m_u16ResumePos);
+        enRet = ADC_ChCmd(ADC_PRIO_ADC_UNIT, ADC_SEQ_A, u32BgCh, pstcInit->pu8BgSampleTime, Enable);
+    }
+
+    if (enRet == Ok)
+    {
+        enRet = ADC_ChCmd(ADC_PRIO_ADC_UNIT, ADC_SEQ_B, u32HpCh, pstcInit->pu8HpSampleTime, Enable);
+    }
+
+    if (enRet == Ok)
+    {
+        enRet = ADC_TriggerSrcConfig(ADC_PRIO_ADC_UNIT, ADC_SEQ_B, &pstcInit->stcHpTrigger);
+    }
+
+    if (enRet == Ok)
+    {
+        NVIC_ClearPendingIRQ(ADC_EOCB_IRQn);
+        NVIC_SetPriority(ADC_EOCB_IRQn, pstcInit->u32HpIrqPriority);
+        NVIC_EnableIRQ(ADC_EOCB_IRQn);
+        NVIC_ClearPendingIRQ(ADC_EOCA_IRQn);
+        NVIC_SetPriority(ADC_EOCA_IRQn, pstcInit->u32BgIrqPriority);
+        NVIC_EnableIRQ(ADC_EOCA_IRQn);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the scheduler.
+ * @param  None
+ * @retval None
+ * @note   The channel selection and trigger source registers are left as they are.
+ */
+void ADC_PRIO_DeInit(void)
+{
+    ADC_PRIO_Stop();
+    NVIC_DisableIRQ(ADC_EOCA_IRQn);
+    NVIC_DisableIRQ(ADC_EOCB_IRQn);
+    m_pfnHpCallback = NULL;
+    m_pfnBgCallback = NULL;
+    m_u32HpChCnt = 0UL;
+    m_u32BgChCnt = 0UL;
+}
+
+/**
+ * @brief  Enable the sequence B trigger and both end of conversion interrupts.
+ * @param  None
+ * @retval None
+ */
+void ADC_PRIO_Start(void)
+{
+    ADC_SeqClearStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_ALL);
+    ADC_SeqIntCmd(ADC_PRIO_ADC_UNIT, ADC_SEQ_A, Enable);
+    ADC_SeqIntCmd(ADC_PRIO_ADC_UNIT, ADC_SEQ_B, Enable);
+    ADC_TriggerSrcCmd(ADC_PRIO_ADC_UNIT, ADC_SEQ_B, Enable);
+}
+
+/**
+ * @brief  Disable the sequence B trigger, stop the ADC and disable the interrupts.
+ * @param  None
+ * @retval None
+ */
+void ADC_PRIO_Stop(void)
+{
+    ADC_TriggerSrcCmd(ADC_PRIO_ADC_UNIT, ADC_SEQ_B, Disable);
+    ADC_Stop(ADC_PRIO_ADC_UNIT);
+    ADC_SeqIntCmd(ADC_PRIO_ADC_UNIT, ADC_SEQ_A, Disable);
+    ADC_SeqIntCmd(ADC_PRIO_ADC_UNIT, ADC_SEQ_B, Disable);
+    ADC_SeqClearStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_ALL);
+    m_u32BgBusy = 0UL;
+    m_u32PreemptCnt = 0UL;
+    MODIFY_REG16(ADC_PRIO_ADC_UNIT->CR1, ADC_CR1_RSCHSEL, m_u16ResumePos);
+}
+
+/**
+ * @brief  Start one background scan.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          Scan started
+ *   @arg  ErrorOperationInProgress:    The previous background scan has not completed
+ */
+en_result_t ADC_PRIO_TriggerBackground(void)
+{
+    en_result_t enRet = ErrorOperationInProgress;
+
+    if (0UL == m_u32BgBusy)
+    {
+        m_u32BgBusy = 1UL;
+        ADC_Start(ADC_PRIO_ADC_UNIT);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the scheduler statistics.
+ * @param  [out] pstcStat               Pointer to a stc_adc_prio_stat_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcStat == NULL
+ */
+en_result_t ADC_PRIO_GetStatistics(stc_adc_prio_stat_t *pstcStat)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Primask;
+
+    if (pstcStat != NULL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        *pstcStat = m_stcStat;
+        __set_PRIMASK(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Sequence A (background) end of conversion handler.
+ * @param  None
+ * @retval None
+ */
+void ADC_PRIO_SeqA_IrqHandler(void)
+{
+    stc_adc_prio_scan_t stcScan;
+    uint32_t u32Primask;
+
+    if (Set == ADC_SeqGetStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_EOCA))
+    {
+        ADC_SeqClearStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_EOCA);
+        /* The EOCB handler preempts this one and updates the same counters */
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        /* A preemption whose EOCB has not been handled yet */
+        if (Set == ADC_SeqGetStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_NESTED))
+        {
+            ADC_SeqClearStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_NESTED);
+            ADC_PRIO_Preempted();
+        }
+
+        ADC_PRIO_ReadData(m_au8BgChNum, m_u32BgChCnt, m_pu16BgBuf);
+        stcScan.pu16Data = m_pu16BgBuf;
+        stcScan.u32ChCnt = m_u32BgChCnt;
+        stcScan.u32Order = m_u32Order++;
+        stcScan.u32PreemptCnt = m_u32PreemptCnt;
+
+        m_stcStat.u32BgScanCnt++;
+        if (m_u32PreemptCnt > m_stcStat.u32MaxPreemptCnt)
+        {
+            m_stcStat.u32MaxPreemptCnt = m_u32PreemptCnt;
+        }
+
+        /* Next scan starts with the configured resume behaviour */
+        m_u32PreemptCnt = 0UL;
+        MODIFY_REG16(ADC_PRIO_ADC_UNIT->CR1, ADC_CR1_RSCHSEL, m_u16ResumePos);
+        m_u32BgBusy = 0UL;
+        __set_PRIMASK(u32Primask);
+
+        if (m_pfnBgCallback != NULL)
+        {
+            m_pfnBgCallback(&stcScan);
+        }
+    }
+}
+
+/**
+ * @brief  Sequence B (high priority) end of conversion handler.
+ * @param  None
+ * @retval None
+ */
+void ADC_PRIO_SeqB_IrqHandler(void)
+{
+    stc_adc_prio_scan_t stcScan;
+    uint16_t *pu16Slot;
+
+    if (Set == ADC_SeqGetStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_EOCB))
+    {
+        ADC_SeqClearStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_EOCB);
+        if (Set == ADC_SeqGetStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_NESTED))
+        {
+            ADC_SeqClearStatus(ADC_PRIO_ADC_UNIT, ADC_SEQ_FLAG_NESTED);
+            ADC_PRIO_Preempted();
+        }
+
+        pu16Slot = &m_pu16HpBuf[m_u32HpWrIdx * m_u32HpChCnt];
+        ADC_PRIO_ReadData(m_au8HpChNum, m_u32HpChCnt, pu16Slot);
+        m_u32HpWrIdx++;
+        if (m_u32HpWrIdx >= m_u32HpDepth)
+        {
+            m_u32HpWrIdx = 0UL;
+        }
+
+        stcScan.pu16Data = pu16Slot;
+        stcScan.u32ChCnt = m_u32HpChCnt;
+        stcScan.u32Order = m_u32Order++;
+        stcScan.u32PreemptCnt = 0UL;
+        m_stcStat.u32HpScanCnt++;
+
+        if (m_pfnHpCallback != NULL)
+        {
+            m_pfnHpCallback(&stcScan);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_PRIO_Local_Functions ADC_PRIO Local Functions
+ * @{
+ */
+
+/**
+ * @brief  List the channel numbers of a channel mask in ascending order.
+ * @param  [in] u32Ch                   Channel mask, @ref ADC_Channel.
+ * @param  [out] au8ChNum               Channel numbers.
+ * @retval Number of channels
+ */
+static uint32_t ADC_PRIO_ChList(uint32_t u32Ch, uint8_t au8ChNum[])
+{
+    uint32_t u32Cnt = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < ADC_CH_CNT; i++)
+    {
+        if ((u32Ch & (1UL << i)) != 0UL)
+        {
+            au8ChNum[u32Cnt] = (uint8_t)i;
+            u32Cnt++;
+        }
+    }
+
+    return u32Cnt;
+}
+
+/**
+ * @brief  Copy the data registers of a channel list.
+ * @param  [in] au8ChNum                Channel numbers.
+ * @param  [in] u32ChCnt                Number of channels.
+ * @param  [out] au16Data               Results.
+ * @retval None
+ */
+static void ADC_PRIO_ReadData(const uint8_t au8ChNum[], uint32_t u32ChCnt, uint16_t au16Data[])
+{
+    const __IO uint16_t *pu16DR = &ADC_PRIO_ADC_UNIT->DR0;
+    uint32_t i;
+
+    for (i = 0UL; i < u32ChCnt; i++)
+    {
+        au16Data[i] = pu16DR[au8ChNum[i]];
+    }
+}
+
+/**
+ * @brief  Account for one preemption of the running background scan.
+ * @param  None
+ * @retval None
+ * @note   The resume position change takes effect from the next preemption,
+ *         the current one has already resumed.
+ */
+static void ADC_PRIO_Preempted(void)
+{
+    m_u32PreemptCnt++;
+    if (1UL == m_u32PreemptCnt)
+    {
+        m_stcStat.u32NestedCnt++;
+    }
+
+    if ((ADC_SA_RESUME_POS_FIRST_CH == m_u16ResumePos) && (m_u32PreemptCnt >= m_u32MaxRestart))
+    {
+        MODIFY_REG16(ADC_PRIO_ADC_UNIT->CR1, ADC_CR1_RSCHSEL, ADC_SA_RESUME_POS_INT_CH);
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_PRIO_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,418 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_sched.c
+ * @brief This file provides firmware functions to run timer paced ADC
+ *        acquisitions and measure their sampling jitter.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_adc_sched.h"
+#include "hc32m423_adc.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_dma.h"
+#include "hc32m423_tmr0.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_ADC_SCHED ADC_SCHED
+ * @brief Timer Paced ADC Acquisition Scheduler Driver Library
+ * @details The chain is: TMR0 compare match -> AOS -> ADC sequence A trigger
+ *          -> EVT_ADC_EOCA -> DMA (ADC_STREAM ping-pong buffer).
+ *          TMR0 runs in compare mode and restarts from 0 at every match, so
+ *          its count at the end of a scan is the latency from the trigger.
+ *          A second DMA channel, also triggered by EVT_ADC_EOCA, copies that
+ *          count into a ring buffer, which gives per-scan timestamps without
+ *          any interrupt.
+ *          Requires DDL_ADC_STREAM_ENABLE. The application enables the ADC,
+ *          TMR0, DMA and AOS function clocks, sets the ADC clock and calls
+ *          ADC_Init() with a single shot sequence A scan mode.
+ * @{
+ */
+
+#if (DDL_ADC_SCHED_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SCHED_Local_Macros ADC_SCHED Local Macros
+ * @{
+ */
+#define ADC_SCHED_ADC_UNIT              (CM_ADC)
+#define ADC_SCHED_DMA_UNIT              (CM_DMA)
+
+/* Timestamp ring fill value, never reached by the counter (CMPAR <= 0xFFFE) */
+#define ADC_SCHED_TS_INVALID            (0xFFFFU)
+#define ADC_SCHED_PERIOD_MAX            (0xFFFFUL)
+#define ADC_SCHED_CLK_DIV_NUM           (11UL)
+
+/**
+ * @defgroup ADC_SCHED_Check_Parameters_Validity ADC_SCHED Check Parameters Validity
+ * @{
+ */
+#define IS_ADC_SCHED_TMR0_UNIT(x)                                              \
+(   ((x) == CM_TMR0_1)                          ||                             \
+    ((x) == CM_TMR0_2))
+
+#define IS_ADC_SCHED_TMR0_CH(x)                                                \
+(   ((x) == TMR0_CH_A)                          ||                             \
+    ((x) == TMR0_CH_B))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SCHED_Local_Variables ADC_SCHED Local Variables
+ * @{
+ */
+static CM_TMR0_TypeDef *m_pstcTmr0 = NULL;
+static uint32_t m_u32Tmr0Ch = TMR0_CH_A;
+static uint32_t m_u32TickFreq = 0UL;
+static uint32_t m_u32PeriodCnt = 0UL;
+static uint32_t m_u32TsDmaCh = ADC_SCHED_DMA_NONE;
+static uint16_t *m_pu16TsBuf = NULL;
+static uint32_t m_u32TsNum = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SCHED_Global_Functions ADC_SCHED Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_adc_sched_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_adc_sched_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t ADC_SCHED_StructInit(stc_adc_sched_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32Ch = 0UL;
+        pstcInit->pu8SampleTime = NULL;
+        pstcInit->u32SampleRate = 1000UL;
+        pstcInit->pstcTmr0 = CM_TMR0_1;
+        pstcInit->u32Tmr0Ch = TMR0_CH_A;
+        (void)ADC_STREAM_StructInit(&pstcInit->stcStream);
+        pstcInit->u32TsDmaCh = ADC_SCHED_DMA_NONE;
+        pstcInit->pu16TsBuf = NULL;
+        pstcInit->u32TsNum = 0UL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Configure the timer, AOS, ADC and DMA chain for paced acquisition.
+ * @param  [in] pstcInit                Pointer to a stc_adc_sched_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration, or the sample rate
+ *                                      cannot be reached from PCLK1
+ * @note   The timer divider is the smallest one that fits the period in 16
+ *         bits, which also gives the finest timestamp resolution. The rate
+ *         actually achieved is returned by ADC_SCHED_GetActualRate().
+ */
+en_result_t ADC_SCHED_Init(const stc_adc_sched_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_clock_freq_t stcClkFreq;
+    stc_tmr0_init_t stcTmr0Init;
+    stc_adc_trigger_config_t stcTrigCfg;
+    stc_adc_stream_init_t stcStream;
+    stc_dma_init_t stcDmaInit;
+    stc_dma_repeat_init_t stcRptInit;
+    uint32_t u32Div;
+    uint32_t u32Freq = 0UL;
+    uint32_t u32Cnt = 0UL;
+    uint32_t i;
+
+    if ((pstcInit != NULL) && (pstcInit->pu8SampleTime != NULL) &&
+        (pstcInit->u32SampleRate != 0UL) &&
+        ((pstcInit->u32TsDmaCh == ADC_SCHED_DMA_NONE) ||
+         ((pstcInit->pu16TsBuf != NULL) && (pstcInit->u32TsNum != 0UL) &&
+          (pstcInit->u32TsNum <= ADC_SCHED_TS_NUM_MAX) &&
+          (pstcInit->u32TsDmaCh != pstcInit->stcStream.u32DmaCh))))
+    {
+        DDL_ASSERT(IS_ADC_SCHED_TMR0_UNIT(pstcInit->pstcTmr0));
+        DDL_ASSERT(IS_ADC_SCHED_TMR0_CH(pstcInit->u32Tmr0Ch));
+
+        (void)CLK_GetClockFreq(&stcClkFreq);
+        for (u32Div = 0UL; u32Div < ADC_SCHED_CLK_DIV_NUM; u32Div++)
+        {
+            u32Freq = stcClkFreq.u32Pclk1Freq >> u32Div;
+            u32Cnt = (u32Freq + (pstcInit->u32SampleRate / 2UL)) / pstcInit->u32SampleRate;
+            if (u32Cnt <= ADC_SCHED_PERIOD_MAX)
+            {
+                break;
+            }
+        }
+
+        if ((u32Div < ADC_SCHED_CLK_DIV_NUM) && (u32Cnt >= 2UL))
+        {
+            enRet = Ok;
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        m_pstcTmr0 = pstcInit->pstcTmr0;
+        m_u32Tmr0Ch = pstcInit->u32Tmr0Ch;
+        m_u32TickFreq = u32Freq;
+        m_u32PeriodCnt = u32Cnt;
+
+        /* Timer: compare match every u32Cnt counts */
+        (void)TMR0_StructInit(&stcTmr0Init);
+        stcTmr0Init.u32ClockSrc = TMR0_SYNC_CLK_PCLK;
+        stcTmr0Init.u32ClockDiv = u32Div << TMR0_BCONR_CKDIVA_POS;
+        stcTmr0Init.u16PeriodValue = (uint16_t)(u32Cnt - 1UL);
+        TMR0_Stop(m_pstcTmr0, m_u32Tmr0Ch);
+        (void)TMR0_Init(m_pstcTmr0, m_u32Tmr0Ch, &stcTmr0Init);
+        TMR0_SetCountValue(m_pstcTmr0, m_u32Tmr0Ch, 0U);
+
+        /* ADC: sequence A channels, triggered by the compare match through AOS */
+        enRet = ADC_ChCmd(ADC_SCHED_ADC_UNIT, ADC_SEQ_A, pstcInit->u32Ch, pstcInit->pu8SampleTime, Enable);
+        (void)ADC_TriggerSrcStructInit(&stcTrigCfg);
+        stcTrigCfg.u16TriggerSrc = ADC_TRIG_SRC_EVT0;
+        stcTrigCfg.enEvent0 = (en_event_src_t)((uint32_t)EVT_TMR0_1_GCMA + m_u32Tmr0Ch +
+                                               ((m_pstcTmr0 == CM_TMR0_2) ? 2UL : 0UL));
+        (void)ADC_TriggerSrcConfig(ADC_SCHED_ADC_UNIT, ADC_SEQ_A, &stcTrigCfg);
+    }
+
+    if (enRet == Ok)
+    {
+        /* Data: ping-pong stream */
+        stcStream = pstcInit->stcStream;
+        stcStream.u32Ch = pstcInit->u32Ch;
+        enRet = ADC_STREAM_Init(&stcStream);
+    }
+
+    if (enRet == Ok)
+    {
+        /* Timestamps: timer count at each end of scan into a ring */
+        m_u32TsDmaCh = pstcInit->u32TsDmaCh;
+        m_pu16TsBuf = pstcInit->pu16TsBuf;
+        m_u32TsNum = pstcInit->u32TsNum;
+        if (m_u32TsDmaCh != ADC_SCHED_DMA_NONE)
+        {
+            for (i = 0UL; i < m_u32TsNum; i++)
+            {
+                m_pu16TsBuf[i] = ADC_SCHED_TS_INVALID;
+            }
+
+            DMA_ChCmd(ADC_SCHED_DMA_UNIT, m_u32TsDmaCh, Disable);
+            (void)DMA_StructInit(&stcDmaInit);
+            stcDmaInit.u32SrcAddr = (uint32_t)&m_pstcTmr0->CNTAR + (m_u32Tmr0Ch * 4UL);
+            stcDmaInit.u32DestAddr = (uint32_t)m_pu16TsBuf;
+            stcDmaInit.u32DataWidth = DMA_DATA_WIDTH_16BIT;
+            stcDmaInit.u32BlockSize = 1UL;
+            stcDmaInit.u32TransCount = 0UL;
+            stcDmaInit.u32SrcAddrMode = DMA_SRC_ADDR_MD_FIX;
+            stcDmaInit.u32DestAddrMode = DMA_DEST_ADDR_MD_INC;
+            (void)DMA_Init(ADC_SCHED_DMA_UNIT, m_u32TsDmaCh, &stcDmaInit);
+
+            (void)DMA_RepeatStructInit(&stcRptInit);
+            stcRptInit.u32RepeatEn = DMA_RPT_ENABLE;
+            stcRptInit.u32RepeatSel = DMA_DEST_RPT;
+            stcRptInit.u32RepeatSize = m_u32TsNum;
+            (void)DMA_RepeatInit(ADC_SCHED_DMA_UNIT, m_u32TsDmaCh, &stcRptInit);
+
+            DMA_SetTriggerSrc(ADC_SCHED_DMA_UNIT, m_u32TsDmaCh, EVT_ADC_EOCA);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the scheduler.
+ * @param  None
+ * @retval None
+ * @note   The ADC channels and the timer registers are left as they are.
+ */
+void ADC_SCHED_DeInit(void)
+{
+    ADC_SCHED_Stop();
+    ADC_STREAM_DeInit();
+    m_u32TsDmaCh = ADC_SCHED_DMA_NONE;
+    m_pu16TsBuf = NULL;
+    m_u32TickFreq = 0UL;
+}
+
+/**
+ * @brief  Start paced acquisition.
+ * @param  None
+ * @retval None
+ */
+void ADC_SCHED_Start(void)
+{
+    ADC_STREAM_Start();
+    if (m_u32TsDmaCh != ADC_SCHED_DMA_NONE)
+    {
+        DMA_ChCmd(ADC_SCHED_DMA_UNIT, m_u32TsDmaCh, Enable);
+    }
+    ADC_TriggerSrcCmd(ADC_SCHED_ADC_UNIT, ADC_SEQ_A, Enable);
+    TMR0_SetCountValue(m_pstcTmr0, m_u32Tmr0Ch, 0U);
+    TMR0_Start(m_pstcTmr0, m_u32Tmr0Ch);
+}
+
+/**
+ * @brief  Stop paced acquisition.
+ * @param  None
+ * @retval None
+ * @note   The timestamp ring keeps its content for ADC_SCHED_GetJitter().
+ */
+void ADC_SCHED_Stop(void)
+{
+    if (m_pstcTmr0 != NULL)
+    {
+        TMR0_Stop(m_pstcTmr0, m_u32Tmr0Ch);
+    }
+    ADC_TriggerSrcCmd(ADC_SCHED_ADC_UNIT, ADC_SEQ_A, Disable);
+    ADC_STREAM_Stop();
+    if (m_u32TsDmaCh != ADC_SCHED_DMA_NONE)
+    {
+        DMA_ChCmd(ADC_SCHED_DMA_UNIT, m_u32TsDmaCh, Disable);
+    }
+}
+
+/**
+ * @brief  Get the scan rate actually produced by the timer.
+ * @param  None
+ * @retval Scan rate in Hz, 0.0 if not initialized
+ */
+float32_t ADC_SCHED_GetActualRate(void)
+{
+    float32_t f32Rate = 0.0F;
+
+    if (m_u32PeriodCnt != 0UL)
+    {
+        f32Rate = (float32_t)m_u32TickFreq / (float32_t)m_u32PeriodCnt;
+    }
+
+    return f32Rate;
+}
+
+/**
+ * @brief  Compute the sampling latency statistics from the timestamp ring.
+ * @param  [out] pstcJitter             Pointer to a stc_adc_sched_jitter_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          Statistics computed
+ *   @arg  ErrorInvalidParameter:       pstcJitter == NULL
+ *   @arg  ErrorUninitialized:          Timestamp capture is not configured
+ *   @arg  ErrorNotReady:               No scan captured yet
+ * @note   May be called while acquisition runs; a slot being written at the
+ *         same time holds either its old or its new value.
+ */
+en_result_t ADC_SCHED_GetJitter(stc_adc_sched_jitter_t *pstcJitter)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Min = ADC_SCHED_PERIOD_MAX;
+    uint32_t u32Max = 0UL;
+    uint32_t u32Sum = 0UL;
+    uint32_t u32Num = 0UL;
+    uint32_t u32Ts;
+    uint32_t i;
+
+    if (pstcJitter != NULL)
+    {
+        enRet = ErrorUninitialized;
+        if ((m_u32TsDmaCh != ADC_SCHED_DMA_NONE) && (m_pu16TsBuf != NULL))
+        {
+            for (i = 0UL; i < m_u32TsNum; i++)
+            {
+                u32Ts = (uint32_t)m_pu16TsBuf[i];
+                if (u32Ts != ADC_SCHED_TS_INVALID)
+                {
+                    u32Min = (u32Ts < u32Min) ? u32Ts : u32Min;
+                    u32Max = (u32Ts > u32Max) ? u32Ts : u32Max;
+                    u32Sum += u32Ts;
+                    u32Num++;
+                }
+            }
+
+            enRet = ErrorNotReady;
+            if (u32Num != 0UL)
+            {
+                pstcJitter->u32ScanNum = u32Num;
+                pstcJitter->u32MinNs = (uint32_t)(((uint64_t)u32Min * 1000000000ULL) / m_u32TickFreq);
+                pstcJitter->u32MaxNs = (uint32_t)(((uint64_t)u32Max * 1000000000ULL) / m_u32TickFreq);
+                pstcJitter->u32MeanNs = (uint32_t)(((uint64_t)u32Sum * 1000000000ULL) / ((uint64_t)m_u32TickFreq * u32Num));
+                pstcJitter->u32JitterNs = pstcJitter->u32MaxNs - pstcJitter->u32MinNs;
+                pstcJitter->u32ResolutionNs = (1000000000UL + m_u32TickFreq - 1UL) / m_u32TickFreq;
+                enRet = Ok;
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_SCHED_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
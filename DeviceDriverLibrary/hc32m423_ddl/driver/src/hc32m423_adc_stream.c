@@ -0,0 +1,426 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_adc_stream.c
+ * @brief This file provides firmware functions to stream ADC sequence A
+ *        conversions into a ping-pong buffer by DMA.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_adc_stream.h"
+#include "hc32m423_adc.h"
+#include "hc32m423_dma.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_ADC_STREAM ADC_STREAM
+ * @brief ADC DMA Streaming Driver Library
+ * @details Every EVT_ADC_EOCA moves one scan (the data registers from the
+ *          lowest to the highest selected channel) into the ping-pong buffer.
+ *          Two linked list descriptors point at the two halves and link to
+ *          each other, so the DMA switches halves without CPU help and the
+ *          only interrupt is one transfer complete per half.
+ *          The ADC itself (channels, sampling time, continuous mode or
+ *          trigger source) is configured by the application with the ADC
+ *          driver; the DMA and AOS function clocks must be enabled.
+ * @{
+ */
+
+#if (DDL_ADC_STREAM_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_STREAM_Local_Macros ADC_STREAM Local Macros
+ * @{
+ */
+#define ADC_STREAM_ADC_UNIT             (CM_ADC)
+#define ADC_STREAM_DMA_UNIT             (CM_DMA)
+
+#define ADC_STREAM_LLP_POS              (DMA_CH0CTL0_LLP_POS - 4U)
+
+#define ADC_STREAM_DESC_CTL0(blk, cnt, next)                                   \
+(   (blk)                                               |                      \
+    ((cnt) << DMA_CH0CTL0_CNT_POS)                      |                      \
+    (((uint32_t)(next) << ADC_STREAM_LLP_POS) & DMA_CH0CTL0_LLP) |             \
+    DMA_LLP_ENABLE                                      |                      \
+    DMA_LLP_WAIT                                        |                      \
+    DMA_DATA_WIDTH_16BIT)
+
+/* Source returns to the first data register after each scan */
+#define ADC_STREAM_DESC_CTL1(blk)                                              \
+(   DMA_SRC_ADDR_MD_INC                                 |                      \
+    DMA_DEST_ADDR_MD_INC                                |                      \
+    DMA_RPT_ENABLE                                      |                      \
+    DMA_SRC_RPT                                         |                      \
+    ((blk) << DMA_CH0CTL1_RPTNSCNT_POS)                 |                      \
+    DMA_LLP_ADDR_RAM)
+
+/**
+ * @defgroup ADC_STREAM_Check_Parameters_Validity ADC_STREAM Check Parameters Validity
+ * @{
+ */
+#define IS_ADC_STREAM_DMA_CH(x)         ((x) <= DMA_CH3)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_STREAM_Local_Functions
+ * @{
+ */
+static void ADC_STREAM_Rewind(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_STREAM_Local_Variables ADC_STREAM Local Variables
+ * @{
+ */
+#if defined (__ICCARM__)
+_Pragma("data_alignment=16")
+static stc_dma_llp_descriptor_t m_astcLlpDesc[2U];
+#else
+static stc_dma_llp_descriptor_t m_astcLlpDesc[2U] __ALIGNED(16);
+#endif
+
+static uint32_t m_u32DmaCh = DMA_CH0;
+static uint16_t *m_pu16Buf = NULL;
+static uint32_t m_u32HalfLen = 0UL;
+static uint32_t m_u32ScanPerHalf = 0UL;
+static uint32_t m_u32FirstChNum = 0UL;
+static func_ptr_adc_stream_half_t m_pfnHalfCallback = NULL;
+
+static uint32_t m_u32NextHalf = 0UL;
+static __IO uint32_t m_u32OverrunCnt = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_STREAM_Global_Functions ADC_STREAM Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_adc_stream_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_adc_stream_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t ADC_STREAM_StructInit(stc_adc_stream_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32Ch = 0UL;
+        pstcInit->u32DmaCh = DMA_CH0;
+        pstcInit->pu16Buf = NULL;
+        pstcInit->u32ScanPerHalf = 1UL;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI03;
+        pstcInit->pfnHalfCallback = NULL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the DMA channel and descriptors of the ADC stream.
+ * @param  [in] pstcInit                Pointer to a stc_adc_stream_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration
+ * @note   The stream is not running after initialization, see ADC_STREAM_Start().
+ *         Call ADC_STREAM_DmaTc_IrqHandler() from DMA_TCx_IrqHandler() of
+ *         the channel given by u32DmaCh.
+ */
+en_result_t ADC_STREAM_Init(const stc_adc_stream_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32ScanLen;
+    uint32_t u32Ch;
+    IRQn_Type enIRQn;
+
+    if ((pstcInit != NULL) && (pstcInit->pu16Buf != NULL) &&
+        ((pstcInit->u32Ch & (uint32_t)ADC_CH_ALL) != 0UL) &&
+        (pstcInit->u32ScanPerHalf != 0UL) &&
+        (pstcInit->u32ScanPerHalf <= ADC_STREAM_SCAN_PER_HALF_MAX))
+    {
+        DDL_ASSERT(IS_ADC_STREAM_DMA_CH(pstcInit->u32DmaCh));
+
+        u32Ch = pstcInit->u32Ch & (uint32_t)ADC_CH_ALL;
+        m_u32FirstChNum = 0UL;
+        while ((u32Ch & (1UL << m_u32FirstChNum)) == 0UL)
+        {
+            m_u32FirstChNum++;
+        }
+        u32ScanLen = ADC_STREAM_GetScanLen(u32Ch);
+
+        m_u32DmaCh = pstcInit->u32DmaCh;
+        m_pu16Buf = pstcInit->pu16Buf;
+        m_u32ScanPerHalf = pstcInit->u32ScanPerHalf;
+        m_u32HalfLen = u32ScanLen * m_u32ScanPerHalf;
+        m_pfnHalfCallback = pstcInit->pfnHalfCallback;
+
+        /* Descriptor 0 fills half 0 then links to descriptor 1, and back */
+        m_astcLlpDesc[0U].SARx = (uint32_t)(&ADC_STREAM_ADC_UNIT->DR0 + m_u32FirstChNum);
+        m_astcLlpDesc[0U].DARx = (uint32_t)&m_pu16Buf[0U];
+        m_astcLlpDesc[0U].CHxCTL0 = ADC_STREAM_DESC_CTL0(u32ScanLen, m_u32ScanPerHalf, &m_astcLlpDesc[1U]);
+        m_astcLlpDesc[0U].CHxCTL1 = ADC_STREAM_DESC_CTL1(u32ScanLen);
+        m_astcLlpDesc[1U].SARx = m_astcLlpDesc[0U].SARx;
+        m_astcLlpDesc[1U].DARx = (uint32_t)&m_pu16Buf[m_u32HalfLen];
+        m_astcLlpDesc[1U].CHxCTL0 = ADC_STREAM_DESC_CTL0(u32ScanLen, m_u32ScanPerHalf, &m_astcLlpDesc[0U]);
+        m_astcLlpDesc[1U].CHxCTL1 = m_astcLlpDesc[0U].CHxCTL1;
+
+        DMA_ChCmd(ADC_STREAM_DMA_UNIT, m_u32DmaCh, Disable);
+        ADC_STREAM_Rewind();
+        DMA_SetTriggerSrc(ADC_STREAM_DMA_UNIT, m_u32DmaCh, EVT_ADC_EOCA);
+
+        enIRQn = (IRQn_Type)((uint32_t)DMA_TC0_IRQn + m_u32DmaCh);
+        DMA_ClearTransIntStatus(ADC_STREAM_DMA_UNIT, (DMA_INT_TC0 << m_u32DmaCh));
+        DMA_TransIntCmd(ADC_STREAM_DMA_UNIT, (DMA_INT_TC0 << m_u32DmaCh), Enable);
+        NVIC_ClearPendingIRQ(enIRQn);
+        NVIC_SetPriority(enIRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(enIRQn);
+
+        DMA_Cmd(ADC_STREAM_DMA_UNIT, Enable);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the ADC stream and release the DMA channel.
+ * @param  None
+ * @retval None
+ */
+void ADC_STREAM_DeInit(void)
+{
+    ADC_STREAM_Stop();
+    NVIC_DisableIRQ((IRQn_Type)((uint32_t)DMA_TC0_IRQn + m_u32DmaCh));
+    DMA_TransIntCmd(ADC_STREAM_DMA_UNIT, (DMA_INT_TC0 << m_u32DmaCh), Disable);
+    m_pu16Buf = NULL;
+    m_pfnHalfCallback = NULL;
+}
+
+/**
+ * @brief  Start streaming from the beginning of half 0.
+ * @param  None
+ * @retval None
+ * @note   Start sequence A afterwards, e.g. ADC_Start() in continuous mode or
+ *         ADC_TriggerSrcCmd() for a triggered sequence.
+ */
+void ADC_STREAM_Start(void)
+{
+    m_u32NextHalf = 0UL;
+    m_u32OverrunCnt = 0UL;
+    ADC_SeqClearStatus(ADC_STREAM_ADC_UNIT, ADC_SEQ_FLAG_EOCA);
+    DMA_ClearTransIntStatus(ADC_STREAM_DMA_UNIT, (DMA_INT_TC0 << m_u32DmaCh));
+    DMA_ChCmd(ADC_STREAM_DMA_UNIT, m_u32DmaCh, Enable);
+}
+
+/**
+ * @brief  Stop streaming. The next ADC_STREAM_Start() restarts at half 0.
+ * @param  None
+ * @retval None
+ * @note   Stop sequence A first, otherwise the last scan may be partial.
+ */
+void ADC_STREAM_Stop(void)
+{
+    DMA_ChCmd(ADC_STREAM_DMA_UNIT, m_u32DmaCh, Disable);
+    if (m_pu16Buf != NULL)
+    {
+        ADC_STREAM_Rewind();
+    }
+}
+
+/**
+ * @brief  Get the scan length, i.e. half words stored per sequence A scan.
+ * @param  [in] u32Ch                   Channels of sequence A, @ref ADC_Channel
+ * @retval Number of data registers from the lowest to the highest channel
+ */
+uint32_t ADC_STREAM_GetScanLen(uint32_t u32Ch)
+{
+    uint32_t u32Low = 0UL;
+    uint32_t u32High = ADC_CH_NUM_MAX;
+    uint32_t u32Len = 0UL;
+
+    u32Ch &= (uint32_t)ADC_CH_ALL;
+    if (u32Ch != 0UL)
+    {
+        while ((u32Ch & (1UL << u32Low)) == 0UL)
+        {
+            u32Low++;
+        }
+        while ((u32Ch & (1UL << u32High)) == 0UL)
+        {
+            u32High--;
+        }
+        u32Len = u32High - u32Low + 1UL;
+    }
+
+    return u32Len;
+}
+
+/**
+ * @brief  Get the offset of a channel inside one scan of the stream.
+ * @param  [in] u32ChNum                Channel number, @ref ADC_Channel_Number
+ * @retval Offset in half words from the start of a scan
+ */
+uint32_t ADC_STREAM_GetChOffset(uint32_t u32ChNum)
+{
+    DDL_ASSERT(u32ChNum >= m_u32FirstChNum);
+
+    return u32ChNum - m_u32FirstChNum;
+}
+
+/**
+ * @brief  Get the number of half buffers overwritten before their callback ran.
+ * @param  None
+ * @retval Overrun count since ADC_STREAM_Start()
+ */
+uint32_t ADC_STREAM_GetOverrunCount(void)
+{
+    return m_u32OverrunCnt;
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler of the ADC stream.
+ * @param  None
+ * @retval None
+ * @note   The completed half is derived from the destination address the
+ *         DMA has moved on to, so a late interrupt is detected as an overrun
+ *         instead of reporting the wrong half.
+ */
+void ADC_STREAM_DmaTc_IrqHandler(void)
+{
+    uint32_t u32Dest;
+    uint32_t u32Half;
+
+    DMA_ClearTransIntStatus(ADC_STREAM_DMA_UNIT, (DMA_INT_TC0 << m_u32DmaCh));
+
+    u32Dest = DMA_GetDestAddr(ADC_STREAM_DMA_UNIT, m_u32DmaCh);
+    /* DMA is writing half 1: half 0 completed, and vice versa */
+    u32Half = (u32Dest >= (uint32_t)&m_pu16Buf[m_u32HalfLen]) ? 0UL : 1UL;
+    if (u32Half != m_u32NextHalf)
+    {
+        m_u32OverrunCnt++;
+    }
+    m_u32NextHalf = u32Half ^ 1UL;
+
+    if (m_pfnHalfCallback != NULL)
+    {
+        m_pfnHalfCallback(u32Half, &m_pu16Buf[u32Half * m_u32HalfLen], m_u32ScanPerHalf);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_STREAM_Local_Functions ADC_STREAM Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Load descriptor 0 into the DMA channel and link it to descriptor 1.
+ * @param  None
+ * @retval None
+ */
+static void ADC_STREAM_Rewind(void)
+{
+    stc_dma_init_t stcDmaInit;
+    stc_dma_repeat_init_t stcRptInit;
+    stc_dma_llp_init_t stcLlpInit;
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32SrcAddr = m_astcLlpDesc[0U].SARx;
+    stcDmaInit.u32DestAddr = m_astcLlpDesc[0U].DARx;
+    stcDmaInit.u32DataWidth = DMA_DATA_WIDTH_16BIT;
+    stcDmaInit.u32BlockSize = m_u32HalfLen / m_u32ScanPerHalf;
+    stcDmaInit.u32TransCount = m_u32ScanPerHalf;
+    stcDmaInit.u32SrcAddrMode = DMA_SRC_ADDR_MD_INC;
+    stcDmaInit.u32DestAddrMode = DMA_DEST_ADDR_MD_INC;
+    (void)DMA_Init(ADC_STREAM_DMA_UNIT, m_u32DmaCh, &stcDmaInit);
+
+    (void)DMA_RepeatStructInit(&stcRptInit);
+    stcRptInit.u32RepeatEn = DMA_RPT_ENABLE;
+    stcRptInit.u32RepeatSel = DMA_SRC_RPT;
+    stcRptInit.u32RepeatSize = stcDmaInit.u32BlockSize;
+    (void)DMA_RepeatInit(ADC_STREAM_DMA_UNIT, m_u32DmaCh, &stcRptInit);
+
+    (void)DMA_LlpStructInit(&stcLlpInit);
+    stcLlpInit.u32Llp = DMA_LLP_ENABLE;
+    stcLlpInit.u32LlpMode = DMA_LLP_WAIT;
+    stcLlpInit.u32LlpAddr = (uint32_t)&m_astcLlpDesc[1U];
+    stcLlpInit.u32LlpAddrMode = DMA_LLP_ADDR_RAM;
+    (void)DMA_LlpInit(ADC_STREAM_DMA_UNIT, m_u32DmaCh, &stcLlpInit);
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_ADC_STREAM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
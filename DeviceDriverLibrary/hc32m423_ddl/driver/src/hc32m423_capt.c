@@ -0,0 +1,852 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_capt.c
+ * @brief This file provides firmware functions for DMA buffered input
+ *        capture on TMRB and TMRA.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_capt.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_dma.h"
+#include "hc32m423_gpio.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_tmra.h"
+#include "hc32m423_tmrb.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_CAPT CAPT
+ * @brief DMA Buffered Input Capture Driver Library
+ * @details Every capture event of the timer makes a DMA channel move the
+ *          capture register to the next half word of a ring, so edges are
+ *          time stamped without the CPU. The ring descriptor links to itself
+ *          and the only interrupt is the DMA transfer complete, once per lap
+ *          of the ring, which counts the laps. CAPT_Process(), called
+ *          periodically, turns the edges written since the previous call
+ *          into frequency, duty, pulse width extremes and a histogram.
+ *          With CAPT_UNIT_TMRB time stamps are 16-bit, so every period and
+ *          pulse must be shorter than 65536 counts. With a TMRA pair the
+ *          high unit counts the overflows of the low unit and captures on
+ *          the capture event of the low unit, a second DMA channel moves its
+ *          capture register to a parallel ring, giving 32-bit time stamps.
+ *          The TMRA pair uses the TMRA capture trigger source, which is
+ *          shared by all TMRA units.
+ *          The application enables the timer, AOS and DMA function clocks
+ *          and sets the capture pin function (TIMB_1_PWMn or TIMA_<t>_PWMn).
+ * @{
+ */
+
+#if (DDL_CAPT_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup CAPT_Local_Macros CAPT Local Macros
+ * @{
+ */
+#define CAPT_DMA_UNIT                   (CM_DMA)
+#define CAPT_TMRB_UNIT                  (CM_TMRB)
+
+#define CAPT_RING_NUM                   (2UL)
+#define CAPT_RING_LOW                   (0UL)
+#define CAPT_RING_HIGH                  (1UL)
+
+/* Capture registers are 4 bytes apart for both timers */
+#define CAPT_CMPAR_STEP                 (4UL)
+#define CAPT_TMRA_UNIT_STEP             (3UL)
+
+#define CAPT_LLP_POS                    (DMA_CH0CTL0_LLP_POS - 4U)
+
+#define CAPT_DESC_CTL0(cnt, next)                                              \
+(   1UL                                                 |                      \
+    ((cnt) << DMA_CH0CTL0_CNT_POS)                      |                      \
+    (((uint32_t)(next) << CAPT_LLP_POS) & DMA_CH0CTL0_LLP) |                   \
+    DMA_LLP_ENABLE                                      |                      \
+    DMA_LLP_WAIT                                        |                      \
+    DMA_DATA_WIDTH_16BIT)
+
+#define CAPT_DESC_CTL1                                                         \
+(   DMA_SRC_ADDR_MD_FIX                                 |                      \
+    DMA_DEST_ADDR_MD_INC                                |                      \
+    DMA_LLP_ADDR_RAM)
+
+/**
+ * @defgroup CAPT_Check_Parameters_Validity CAPT Check Parameters Validity
+ * @{
+ */
+#define IS_CAPT_UNIT(x)                                                        \
+(   ((x) == CAPT_UNIT_TMRB)                     ||                             \
+    ((x) == CAPT_UNIT_TMRA_1_2)                 ||                             \
+    ((x) == CAPT_UNIT_TMRA_3_4))
+
+#define IS_CAPT_MD(x)                                                          \
+(   ((x) == CAPT_MD_PERIOD)                     ||                             \
+    ((x) == CAPT_MD_PULSE))
+
+#define IS_CAPT_DMA_CH(x)               ((x) <= DMA_CH3)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup CAPT_Local_Functions
+ * @{
+ */
+static void CAPT_Rewind(uint32_t u32Ring);
+static void CAPT_Fold(void);
+static uint32_t CAPT_ReadTotal(void);
+static void CAPT_Edge(uint32_t u32Time, stc_capt_result_t *pstcResult, uint64_t *pu64PeriodSum,
+                      uint64_t *pu64WidthSum);
+static void CAPT_Hist(uint32_t u32Value);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup CAPT_Local_Variables CAPT Local Variables
+ * @{
+ */
+#if defined (__ICCARM__)
+_Pragma("data_alignment=16")
+static stc_dma_llp_descriptor_t m_astcLlpDesc[CAPT_RING_NUM];
+#else
+static stc_dma_llp_descriptor_t m_astcLlpDesc[CAPT_RING_NUM] __ALIGNED(16);
+#endif
+
+static uint32_t m_u32Unit = CAPT_UNIT_TMRB;
+static uint32_t m_u32Ch = 0UL;
+static uint32_t m_u32Mode = CAPT_MD_PERIOD;
+static uint8_t m_u8Port = 0U;
+static uint8_t m_u8Pin = 0U;
+static CM_TMRA_TypeDef *m_pstcTmraLow = NULL;
+static CM_TMRA_TypeDef *m_pstcTmraHigh = NULL;
+static uint32_t m_u32RingNum = 0UL;
+static uint32_t m_au32DmaCh[CAPT_RING_NUM];
+static uint16_t *m_apu16Buf[CAPT_RING_NUM];
+static uint32_t m_u32BufLen = 0UL;
+static uint32_t m_u32Mask = 0UL;
+static uint32_t m_u32Freq = 0UL;
+static uint32_t *m_pu32Hist = NULL;
+static uint32_t m_u32HistBinNum = 0UL;
+static uint32_t m_u32HistMin = 0UL;
+static uint32_t m_u32HistBinWidth = 1UL;
+
+/* Completed laps of each ring, folded in from the DMA transfer complete flags */
+static __IO uint32_t m_au32Lap[CAPT_RING_NUM];
+static __IO uint32_t m_u32OverrunCnt = 0UL;
+
+/* Reader state, owned by CAPT_Process() */
+static uint32_t m_u32ReadTotal = 0UL;
+static uint32_t m_u32ReadIdx = 0UL;
+static uint32_t m_u32Rising = 0UL;
+static uint32_t m_u32LastRise = 0UL;
+static uint32_t m_u32RiseValid = 0UL;
+static uint32_t m_u32Width = 0UL;
+static uint32_t m_u32WidthValid = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup CAPT_Global_Functions CAPT Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_capt_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_capt_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t CAPT_StructInit(stc_capt_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32Unit = CAPT_UNIT_TMRB;
+        pstcInit->u32Ch = TMRB_CH1;
+        pstcInit->u16ClockDiv = TMRB_CLK_DIV1;
+        pstcInit->u32Mode = CAPT_MD_PERIOD;
+        pstcInit->u8Port = GPIO_PORT_0;
+        pstcInit->u8Pin = GPIO_PIN_0;
+        pstcInit->u32DmaCh = DMA_CH0;
+        pstcInit->u32DmaChHigh = DMA_CH1;
+        pstcInit->pu16Buf = NULL;
+        pstcInit->pu16BufHigh = NULL;
+        pstcInit->u32BufLen = 64UL;
+        pstcInit->pu32Hist = NULL;
+        pstcInit->u32HistBinNum = 0UL;
+        pstcInit->u32HistMin = 0UL;
+        pstcInit->u32HistBinWidth = 1UL;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI03;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the capture timer and the DMA rings.
+ * @param  [in] pstcInit                Pointer to a stc_capt_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration
+ * @note   Call CAPT_DmaTc_IrqHandler() from DMA_TCx_IrqHandler() of the
+ *         channel given by u32DmaCh. Capturing begins with CAPT_Start().
+ */
+en_result_t CAPT_Init(const stc_capt_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_clock_freq_t stcClkFreq;
+    stc_tmrb_init_t stcTmrbInit;
+    stc_tmra_init_t stcTmraInit;
+    uint32_t u32Src[CAPT_RING_NUM];
+    en_event_src_t aenEvt[CAPT_RING_NUM];
+    uint16_t u16Cond;
+    uint32_t u32UnitIdx;
+    uint32_t i;
+    IRQn_Type enIRQn;
+
+    if ((pstcInit != NULL) && (pstcInit->pu16Buf != NULL) &&
+        (pstcInit->u32BufLen >= 2UL) && (pstcInit->u32BufLen <= CAPT_BUF_LEN_MAX) &&
+        ((pstcInit->pu32Hist == NULL) ||
+         ((pstcInit->u32HistBinNum != 0UL) && (pstcInit->u32HistBinWidth != 0UL))))
+    {
+        DDL_ASSERT(IS_CAPT_UNIT(pstcInit->u32Unit));
+        DDL_ASSERT(IS_CAPT_MD(pstcInit->u32Mode));
+        DDL_ASSERT(IS_CAPT_DMA_CH(pstcInit->u32DmaCh));
+
+        if (pstcInit->u32Unit == CAPT_UNIT_TMRB)
+        {
+            DDL_ASSERT(pstcInit->u32Ch <= TMRB_CH4);
+            enRet = Ok;
+        }
+        else if ((pstcInit->pu16BufHigh != NULL) && (pstcInit->u32DmaChHigh != pstcInit->u32DmaCh) &&
+                 ((pstcInit->u32Ch == TMRA_CH1) ||
+                  ((pstcInit->u32Ch == TMRA_CH2) && (pstcInit->u32Unit == CAPT_UNIT_TMRA_3_4))))
+        {
+            DDL_ASSERT(IS_CAPT_DMA_CH(pstcInit->u32DmaChHigh));
+            enRet = Ok;
+        }
+        else
+        {
+            /* TMRA pair without a second ring, or no such channel */
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        CAPT_DeInit();
+
+        m_u32Unit = pstcInit->u32Unit;
+        m_u32Ch = pstcInit->u32Ch;
+        m_u32Mode = pstcInit->u32Mode;
+        m_u8Port = pstcInit->u8Port;
+        m_u8Pin = pstcInit->u8Pin;
+        m_au32DmaCh[CAPT_RING_LOW] = pstcInit->u32DmaCh;
+        m_au32DmaCh[CAPT_RING_HIGH] = pstcInit->u32DmaChHigh;
+        m_apu16Buf[CAPT_RING_LOW] = pstcInit->pu16Buf;
+        m_apu16Buf[CAPT_RING_HIGH] = pstcInit->pu16BufHigh;
+        m_u32BufLen = pstcInit->u32BufLen;
+        m_pu32Hist = pstcInit->pu32Hist;
+        m_u32HistBinNum = pstcInit->u32HistBinNum;
+        m_u32HistMin = pstcInit->u32HistMin;
+        m_u32HistBinWidth = pstcInit->u32HistBinWidth;
+
+        u16Cond = (m_u32Mode == CAPT_MD_PULSE) ? (TMRB_CAPT_COND_PWMR | TMRB_CAPT_COND_PWMF) :
+                  TMRB_CAPT_COND_PWMR;
+        (void)CLK_GetClockFreq(&stcClkFreq);
+
+        if (m_u32Unit == CAPT_UNIT_TMRB)
+        {
+            m_u32RingNum = 1UL;
+            m_u32Mask = 0xFFFFUL;
+            m_u32Freq = stcClkFreq.u32Pclk1Freq >> ((uint32_t)pstcInit->u16ClockDiv >> TMRB_BCSTR_CKDIV_POS);
+
+            (void)TMRB_StructInit(&stcTmrbInit);
+            stcTmrbInit.u16ClockDiv = pstcInit->u16ClockDiv;
+            stcTmrbInit.u16CountMode = TMRB_MD_SAWTOOTH;
+            stcTmrbInit.u16CountDir = TMRB_DIR_UP;
+            stcTmrbInit.u16PeriodValue = 0xFFFFU;
+            (void)TMRB_Init(CAPT_TMRB_UNIT, &stcTmrbInit);
+            TMRB_SetFunc(CAPT_TMRB_UNIT, m_u32Ch, TMRB_FUNC_CAPT);
+            TMRB_HWCaptureCondCmd(CAPT_TMRB_UNIT, m_u32Ch, u16Cond, Enable);
+            TMRB_EventCmd(CAPT_TMRB_UNIT, m_u32Ch, Enable);
+
+            u32Src[CAPT_RING_LOW] = (uint32_t)&CAPT_TMRB_UNIT->CMPAR1 + (m_u32Ch * CAPT_CMPAR_STEP);
+            aenEvt[CAPT_RING_LOW] = EVT_TMRB_CMP;
+        }
+        else
+        {
+            if (m_u32Unit == CAPT_UNIT_TMRA_1_2)
+            {
+                m_pstcTmraLow = CM_TMRA_1;
+                m_pstcTmraHigh = CM_TMRA_2;
+                u32UnitIdx = 0UL;
+            }
+            else
+            {
+                m_pstcTmraLow = CM_TMRA_3;
+                m_pstcTmraHigh = CM_TMRA_4;
+                u32UnitIdx = 2UL;
+            }
+            m_u32RingNum = 2UL;
+            m_u32Mask = 0xFFFFFFFFUL;
+            m_u32Freq = stcClkFreq.u32Pclk1Freq >> ((uint32_t)pstcInit->u16ClockDiv >> TMRA_BCSTR_CKDIV_POS);
+
+            (void)TMRA_StructInit(&stcTmraInit);
+            stcTmraInit.u16ClockDiv = pstcInit->u16ClockDiv;
+            stcTmraInit.u16CountMode = TMRA_MD_SAWTOOTH;
+            stcTmraInit.u16CountDir = TMRA_DIR_UP;
+            (void)TMRA_Init(m_pstcTmraLow, &stcTmraInit);
+            (void)TMRA_Init(m_pstcTmraHigh, &stcTmraInit);
+            TMRA_HWCountUpCondCmd(m_pstcTmraHigh, TMRA_CNT_UP_COND_SYM_OVF, Enable);
+
+            /* The capture event of the low unit also captures the high unit */
+            TMRA_SetFunc(m_pstcTmraLow, m_u32Ch, TMRA_FUNC_CAPT);
+            TMRA_HWCaptureCondCmd(m_pstcTmraLow, m_u32Ch,
+                                  (m_u32Mode == CAPT_MD_PULSE) ? (TMRA_CAPT_COND_PWMR | TMRA_CAPT_COND_PWMF) :
+                                  TMRA_CAPT_COND_PWMR, Enable);
+            TMRA_EventCmd(m_pstcTmraLow, m_u32Ch, Enable);
+            TMRA_SetTriggerSrc(TMRA_EVT_USAGE_CAPT,
+                               (en_event_src_t)((uint32_t)EVT_TMRA_1_CMP + (u32UnitIdx * CAPT_TMRA_UNIT_STEP)));
+            TMRA_SetFunc(m_pstcTmraHigh, TMRA_CH1, TMRA_FUNC_CAPT);
+            TMRA_HWCaptureCondCmd(m_pstcTmraHigh, TMRA_CH1, TMRA_CAPT_COND_EVT, Enable);
+            TMRA_EventCmd(m_pstcTmraHigh, TMRA_CH1, Enable);
+            TMRA_SyncStartCmd(m_pstcTmraHigh, Enable);
+
+            u32Src[CAPT_RING_LOW] = (uint32_t)&m_pstcTmraLow->CMPAR1 + (m_u32Ch * CAPT_CMPAR_STEP);
+            u32Src[CAPT_RING_HIGH] = (uint32_t)&m_pstcTmraHigh->CMPAR1;
+            aenEvt[CAPT_RING_LOW] = (en_event_src_t)((uint32_t)EVT_TMRA_1_CMP + (u32UnitIdx * CAPT_TMRA_UNIT_STEP));
+            aenEvt[CAPT_RING_HIGH] = (en_event_src_t)((uint32_t)EVT_TMRA_1_CMP +
+                                                      ((u32UnitIdx + 1UL) * CAPT_TMRA_UNIT_STEP));
+        }
+
+        /* One half word per capture event, the descriptor links to itself to wrap the ring */
+        for (i = 0UL; i < m_u32RingNum; i++)
+        {
+            m_astcLlpDesc[i].SARx = u32Src[i];
+            m_astcLlpDesc[i].DARx = (uint32_t)&m_apu16Buf[i][0U];
+            m_astcLlpDesc[i].CHxCTL0 = CAPT_DESC_CTL0(m_u32BufLen, &m_astcLlpDesc[i]);
+            m_astcLlpDesc[i].CHxCTL1 = CAPT_DESC_CTL1;
+
+            DMA_ChCmd(CAPT_DMA_UNIT, m_au32DmaCh[i], Disable);
+            CAPT_Rewind(i);
+            DMA_SetTriggerSrc(CAPT_DMA_UNIT, m_au32DmaCh[i], aenEvt[i]);
+            DMA_ClearTransIntStatus(CAPT_DMA_UNIT, (DMA_INT_TC0 << m_au32DmaCh[i]));
+        }
+
+        /* The laps of the high ring are folded with those of the low ring */
+        enIRQn = (IRQn_Type)((uint32_t)DMA_TC0_IRQn + m_au32DmaCh[CAPT_RING_LOW]);
+        DMA_TransIntCmd(CAPT_DMA_UNIT, (DMA_INT_TC0 << m_au32DmaCh[CAPT_RING_LOW]), Enable);
+        NVIC_ClearPendingIRQ(enIRQn);
+        NVIC_SetPriority(enIRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(enIRQn);
+
+        DMA_Cmd(CAPT_DMA_UNIT, Enable);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the capture engine.
+ * @param  None
+ * @retval None
+ */
+void CAPT_DeInit(void)
+{
+    if (m_u32RingNum != 0UL)
+    {
+        CAPT_Stop();
+        NVIC_DisableIRQ((IRQn_Type)((uint32_t)DMA_TC0_IRQn + m_au32DmaCh[CAPT_RING_LOW]));
+        DMA_TransIntCmd(CAPT_DMA_UNIT, (DMA_INT_TC0 << m_au32DmaCh[CAPT_RING_LOW]), Disable);
+
+        if (m_u32Unit == CAPT_UNIT_TMRB)
+        {
+            TMRB_EventCmd(CAPT_TMRB_UNIT, m_u32Ch, Disable);
+            TMRB_HWCaptureCondCmd(CAPT_TMRB_UNIT, m_u32Ch, TMRB_CAPT_COND_ALL, Disable);
+            TMRB_SetFunc(CAPT_TMRB_UNIT, m_u32Ch, TMRB_FUNC_CMP);
+        }
+        else
+        {
+            TMRA_EventCmd(m_pstcTmraLow, m_u32Ch, Disable);
+            TMRA_HWCaptureCondCmd(m_pstcTmraLow, m_u32Ch, TMRA_CAPT_COND_ALL, Disable);
+            TMRA_SetFunc(m_pstcTmraLow, m_u32Ch, TMRA_FUNC_CMP);
+            TMRA_EventCmd(m_pstcTmraHigh, TMRA_CH1, Disable);
+            TMRA_HWCaptureCondCmd(m_pstcTmraHigh, TMRA_CH1, TMRA_CAPT_COND_ALL, Disable);
+            TMRA_SetFunc(m_pstcTmraHigh, TMRA_CH1, TMRA_FUNC_CMP);
+            TMRA_HWCountUpCondCmd(m_pstcTmraHigh, TMRA_CNT_UP_COND_SYM_OVF, Disable);
+            TMRA_SyncStartCmd(m_pstcTmraHigh, Disable);
+            m_pstcTmraLow = NULL;
+            m_pstcTmraHigh = NULL;
+        }
+        m_pu32Hist = NULL;
+        m_u32RingNum = 0UL;
+    }
+}
+
+/**
+ * @brief  Start capturing from the start of the rings.
+ * @param  None
+ * @retval None
+ * @note   The histogram is cleared. In CAPT_MD_PULSE the input level is
+ *         read to tell the polarity of the first edge, so the input must
+ *         not toggle while this function runs.
+ */
+void CAPT_Start(void)
+{
+    uint32_t i;
+
+    if (m_u32RingNum != 0UL)
+    {
+        CAPT_Stop();
+
+        for (i = 0UL; i < m_u32RingNum; i++)
+        {
+            m_au32Lap[i] = 0UL;
+            DMA_ClearTransIntStatus(CAPT_DMA_UNIT, (DMA_INT_TC0 << m_au32DmaCh[i]));
+            DMA_ChCmd(CAPT_DMA_UNIT, m_au32DmaCh[i], Enable);
+        }
+        if (m_pu32Hist != NULL)
+        {
+            for (i = 0UL; i < m_u32HistBinNum; i++)
+            {
+                m_pu32Hist[i] = 0UL;
+            }
+        }
+        m_u32OverrunCnt = 0UL;
+        m_u32ReadTotal = 0UL;
+        m_u32ReadIdx = 0UL;
+        m_u32RiseValid = 0UL;
+        m_u32WidthValid = 0UL;
+        /* Edge 0 is rising unless the input is high now */
+        m_u32Rising = ((m_u32Mode == CAPT_MD_PULSE) &&
+                       (Pin_Set == GPIO_ReadInputPins(m_u8Port, m_u8Pin))) ? 0UL : 1UL;
+
+        if (m_u32Unit == CAPT_UNIT_TMRB)
+        {
+            TMRB_SetCountValue(CAPT_TMRB_UNIT, 0U);
+            TMRB_Start(CAPT_TMRB_UNIT);
+        }
+        else
+        {
+            TMRA_SetCountValue(m_pstcTmraLow, 0U);
+            TMRA_SetCountValue(m_pstcTmraHigh, 0U);
+            TMRA_Start(m_pstcTmraLow);
+        }
+    }
+}
+
+/**
+ * @brief  Stop capturing.
+ * @param  None
+ * @retval None
+ * @note   Edges not yet processed are dropped.
+ */
+void CAPT_Stop(void)
+{
+    uint32_t i;
+
+    if (m_u32RingNum != 0UL)
+    {
+        if (m_u32Unit == CAPT_UNIT_TMRB)
+        {
+            TMRB_Stop(CAPT_TMRB_UNIT);
+        }
+        else
+        {
+            TMRA_Stop(m_pstcTmraLow);
+            TMRA_Stop(m_pstcTmraHigh);
+        }
+
+        for (i = 0UL; i < m_u32RingNum; i++)
+        {
+            DMA_ChCmd(CAPT_DMA_UNIT, m_au32DmaCh[i], Disable);
+            CAPT_Rewind(i);
+        }
+    }
+}
+
+/**
+ * @brief  Measure the edges captured since the previous call.
+ * @param  [out] pstcResult             Pointer to a stc_capt_result_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorNotReady:               Not started
+ *   @arg  ErrorInvalidParameter:       pstcResult == NULL
+ * @note   Call at least once per u32BufLen - 1 edges. Edges overwritten
+ *         before they are processed are counted in u32OverrunCnt and the
+ *         period across them is not measured. Each period is counted in
+ *         the batch of the edge that ends it. The histogram accumulates
+ *         until the next CAPT_Start().
+ */
+en_result_t CAPT_Process(stc_capt_result_t *pstcResult)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint64_t u64PeriodSum = 0ULL;
+    uint64_t u64WidthSum = 0ULL;
+    uint32_t u32Total;
+    uint32_t u32Num;
+    uint32_t u32Time;
+
+    if (pstcResult != NULL)
+    {
+        enRet = ErrorNotReady;
+        if (m_u32RingNum != 0UL)
+        {
+            enRet = Ok;
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        pstcResult->u32EdgeNum = 0UL;
+        pstcResult->u32PeriodNum = 0UL;
+        pstcResult->f32Freq = 0.0F;
+        pstcResult->f32Duty = 0.0F;
+        pstcResult->u32MinPeriod = 0xFFFFFFFFUL;
+        pstcResult->u32MaxPeriod = 0UL;
+        pstcResult->u32MinWidth = 0xFFFFFFFFUL;
+        pstcResult->u32MaxWidth = 0UL;
+
+        u32Total = CAPT_ReadTotal();
+        u32Num = u32Total - m_u32ReadTotal;
+        /* The entry the DMA writes next is not readable */
+        if (u32Num > (m_u32BufLen - 1UL))
+        {
+            m_u32OverrunCnt += u32Num - (m_u32BufLen - 1UL);
+            m_u32ReadIdx = (m_u32ReadIdx + (u32Num - (m_u32BufLen - 1UL))) % m_u32BufLen;
+            if (m_u32Mode == CAPT_MD_PULSE)
+            {
+                m_u32Rising ^= (u32Num - (m_u32BufLen - 1UL)) & 1UL;
+            }
+            m_u32RiseValid = 0UL;
+            m_u32WidthValid = 0UL;
+            u32Num = m_u32BufLen - 1UL;
+        }
+        m_u32ReadTotal = u32Total;
+
+        while (u32Num != 0UL)
+        {
+            u32Time = m_apu16Buf[CAPT_RING_LOW][m_u32ReadIdx];
+            if (m_u32RingNum > 1UL)
+            {
+                u32Time |= (uint32_t)m_apu16Buf[CAPT_RING_HIGH][m_u32ReadIdx] << 16U;
+            }
+            CAPT_Edge(u32Time, pstcResult, &u64PeriodSum, &u64WidthSum);
+
+            m_u32ReadIdx++;
+            if (m_u32ReadIdx >= m_u32BufLen)
+            {
+                m_u32ReadIdx = 0UL;
+            }
+            u32Num--;
+        }
+
+        if (pstcResult->u32PeriodNum != 0UL)
+        {
+            pstcResult->f32Freq = ((float32_t)pstcResult->u32PeriodNum * (float32_t)m_u32Freq) /
+                                  (float32_t)u64PeriodSum;
+            if (m_u32Mode == CAPT_MD_PULSE)
+            {
+                pstcResult->f32Duty = (float32_t)u64WidthSum / (float32_t)u64PeriodSum;
+            }
+        }
+        else
+        {
+            pstcResult->u32MinPeriod = 0UL;
+        }
+        if (pstcResult->u32MaxWidth == 0UL)
+        {
+            pstcResult->u32MinWidth = 0UL;
+        }
+        pstcResult->u32OverrunCnt = m_u32OverrunCnt;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the capture count clock.
+ * @param  None
+ * @retval Frequency in Hz of one count, 0 if not initialized.
+ */
+uint32_t CAPT_GetFreq(void)
+{
+    return (m_u32RingNum != 0UL) ? m_u32Freq : 0UL;
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler, once per lap of the ring.
+ * @param  None
+ * @retval None
+ */
+void CAPT_DmaTc_IrqHandler(void)
+{
+    if (m_u32RingNum != 0UL)
+    {
+        CAPT_Fold();
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup CAPT_Local_Functions CAPT Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Load the ring descriptor into the DMA channel.
+ * @param  [in] u32Ring                 CAPT_RING_LOW or CAPT_RING_HIGH.
+ * @retval None
+ */
+static void CAPT_Rewind(uint32_t u32Ring)
+{
+    stc_dma_init_t stcDmaInit;
+    stc_dma_llp_init_t stcLlpInit;
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32SrcAddr = m_astcLlpDesc[u32Ring].SARx;
+    stcDmaInit.u32DestAddr = m_astcLlpDesc[u32Ring].DARx;
+    stcDmaInit.u32DataWidth = DMA_DATA_WIDTH_16BIT;
+    stcDmaInit.u32BlockSize = 1UL;
+    stcDmaInit.u32TransCount = m_u32BufLen;
+    stcDmaInit.u32SrcAddrMode = DMA_SRC_ADDR_MD_FIX;
+    stcDmaInit.u32DestAddrMode = DMA_DEST_ADDR_MD_INC;
+    (void)DMA_Init(CAPT_DMA_UNIT, m_au32DmaCh[u32Ring], &stcDmaInit);
+
+    (void)DMA_LlpStructInit(&stcLlpInit);
+    stcLlpInit.u32Llp = DMA_LLP_ENABLE;
+    stcLlpInit.u32LlpMode = DMA_LLP_WAIT;
+    stcLlpInit.u32LlpAddr = (uint32_t)&m_astcLlpDesc[u32Ring];
+    stcLlpInit.u32LlpAddrMode = DMA_LLP_ADDR_RAM;
+    (void)DMA_LlpInit(CAPT_DMA_UNIT, m_au32DmaCh[u32Ring], &stcLlpInit);
+}
+
+/**
+ * @brief  Fold the pending transfer complete flags into the lap counters.
+ * @param  None
+ * @retval None
+ * @note   Called with the interrupt masked or from the interrupt.
+ */
+static void CAPT_Fold(void)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < m_u32RingNum; i++)
+    {
+        if (Set == DMA_GetTransIntStatus(CAPT_DMA_UNIT, (DMA_INT_TC0 << m_au32DmaCh[i])))
+        {
+            DMA_ClearTransIntStatus(CAPT_DMA_UNIT, (DMA_INT_TC0 << m_au32DmaCh[i]));
+            m_au32Lap[i]++;
+        }
+    }
+}
+
+/**
+ * @brief  Get the number of edges written to all rings since CAPT_Start().
+ * @param  None
+ * @retval Edge count, modulo 2^32.
+ */
+static uint32_t CAPT_ReadTotal(void)
+{
+    uint32_t u32Primask;
+    uint32_t au32Idx[CAPT_RING_NUM];
+    uint32_t u32Total = 0UL;
+    uint32_t u32RingTotal;
+    uint32_t i;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    for (i = 0UL; i < m_u32RingNum; i++)
+    {
+        CAPT_Fold();
+        au32Idx[i] = (DMA_GetDestAddr(CAPT_DMA_UNIT, m_au32DmaCh[i]) - (uint32_t)&m_apu16Buf[i][0U]) / 2UL;
+        if (Set == DMA_GetTransIntStatus(CAPT_DMA_UNIT, (DMA_INT_TC0 << m_au32DmaCh[i])))
+        {
+            /* Lap completed while reading */
+            CAPT_Fold();
+            au32Idx[i] = (DMA_GetDestAddr(CAPT_DMA_UNIT, m_au32DmaCh[i]) - (uint32_t)&m_apu16Buf[i][0U]) / 2UL;
+        }
+        /* End of the ring before the descriptor is reloaded, the lap is counted */
+        if (au32Idx[i] >= m_u32BufLen)
+        {
+            au32Idx[i] = 0UL;
+        }
+
+        /* An edge is complete once every ring holds it */
+        u32RingTotal = (m_au32Lap[i] * m_u32BufLen) + au32Idx[i];
+        if ((i == 0UL) || ((int32_t)(u32RingTotal - u32Total) < 0L))
+        {
+            u32Total = u32RingTotal;
+        }
+    }
+    __set_PRIMASK(u32Primask);
+
+    return u32Total;
+}
+
+/**
+ * @brief  Account one edge.
+ * @param  [in] u32Time                 Capture time stamp.
+ * @param  [in,out] pstcResult          Batch result.
+ * @param  [in,out] pu64PeriodSum       Sum of the periods of the batch.
+ * @param  [in,out] pu64WidthSum        Sum of the high widths of the periods of the batch.
+ * @retval None
+ */
+static void CAPT_Edge(uint32_t u32Time, stc_capt_result_t *pstcResult, uint64_t *pu64PeriodSum,
+                      uint64_t *pu64WidthSum)
+{
+    uint32_t u32Period;
+
+    pstcResult->u32EdgeNum++;
+
+    if (m_u32Rising != 0UL)
+    {
+        if (m_u32RiseValid != 0UL)
+        {
+            u32Period = (u32Time - m_u32LastRise) & m_u32Mask;
+            pstcResult->u32PeriodNum++;
+            *pu64PeriodSum += u32Period;
+            if (u32Period < pstcResult->u32MinPeriod)
+            {
+                pstcResult->u32MinPeriod = u32Period;
+            }
+            if (u32Period > pstcResult->u32MaxPeriod)
+            {
+                pstcResult->u32MaxPeriod = u32Period;
+            }
+
+            if (m_u32Mode == CAPT_MD_PERIOD)
+            {
+                CAPT_Hist(u32Period);
+            }
+            else if (m_u32WidthValid != 0UL)
+            {
+                *pu64WidthSum += m_u32Width;
+            }
+            else
+            {
+                /* Falling edge lost, the period still counts as low */
+            }
+        }
+        m_u32LastRise = u32Time;
+        m_u32RiseValid = 1UL;
+        m_u32WidthValid = 0UL;
+    }
+    else if (m_u32RiseValid != 0UL)
+    {
+        m_u32Width = (u32Time - m_u32LastRise) & m_u32Mask;
+        m_u32WidthValid = 1UL;
+        if (m_u32Width < pstcResult->u32MinWidth)
+        {
+            pstcResult->u32MinWidth = m_u32Width;
+        }
+        if (m_u32Width > pstcResult->u32MaxWidth)
+        {
+            pstcResult->u32MaxWidth = m_u32Width;
+        }
+        CAPT_Hist(m_u32Width);
+    }
+    else
+    {
+        /* High pulse without its rising edge */
+    }
+
+    if (m_u32Mode == CAPT_MD_PULSE)
+    {
+        m_u32Rising ^= 1UL;
+    }
+}
+
+/**
+ * @brief  Count a value in the histogram.
+ * @param  [in] u32Value                Period or width in counts.
+ * @retval None
+ */
+static void CAPT_Hist(uint32_t u32Value)
+{
+    uint32_t u32Bin = 0UL;
+
+    if (m_pu32Hist != NULL)
+    {
+        if (u32Value > m_u32HistMin)
+        {
+            u32Bin = (u32Value - m_u32HistMin) / m_u32HistBinWidth;
+            if (u32Bin >= m_u32HistBinNum)
+            {
+                u32Bin = m_u32HistBinNum - 1UL;
+            }
+        }
+        m_pu32Hist[u32Bin]++;
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_CAPT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -7,6 +7,7 @@
    Date             Author          Notes
    2020-09-15       CDT             First version
    2020-11-06       CDT             Fix bug for CLK_SetSysclkSrc() and CLK_ClockDiv()
+   2026-10-18       CDT             Add CLK_SwitchSysclk() with flash wait cycle and cache tuning
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -329,6 +330,7 @@
  * Local function prototypes ('static')
  ******************************************************************************/
 static uint32_t Get_TargetClockFreq(uint8_t u8Clock);
+static void Set_FlashWaitCycle(uint32_t u32WaitCycle);
 
 /*******************************************************************************
  * Local variable definitions ('static')
@@ -407,6 +409,20 @@ static uint32_t Get_TargetClockFreq(uint8_t u8Clock)
     }
     return u32Freq;
 }
+
+/**
+ * @brief  Set the flash read wait cycles and wait until they are applied.
+ * @param  [in] u32WaitCycle        Wait cycles, 0 ~ CLK_FLASH_WAIT_MAX.
+ * @retval None
+ */
+static void Set_FlashWaitCycle(uint32_t u32WaitCycle)
+{
+    MODIFY_REG32(CM_EFM->FRMC, EFM_FRMC_FLWT, u32WaitCycle);
+    while (u32WaitCycle != READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT))
+    {
+        ;
+    }
+}
 /**
  * @}
  */
@@ -1074,6 +1090,126 @@ void CLK_ClockDiv(uint8_t u8ClockCate, uint32_t u32Div)
     }
 }
 
+/**
+ * @brief  Switch the system clock source and the Hclk divider with the
+ *         minimum flash read wait cycles.
+ * @param  [in] u8Src               System clock source. @ref CLK_System_Clock_Src
+ * @param  [in] u32HclkDiv          Hclk divider. @ref CLK_Hclk_Div
+ * @param  [out] pstcFlashCfg       Flash read configuration after the switch, may be NULL.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok: Switch done
+ *   @arg  ErrorAccessRights: EFM registers are locked
+ * @note   The wait cycles are raised before the frequency goes up and lowered
+ *         after it goes down. The source and the divider are changed in the
+ *         order giving the lower intermediate Hclk, and the wait cycles during
+ *         the switch cover it. The flash instruction and data caches are
+ *         enabled at the end.
+ *         The target clock source must be enabled and stable. Call
+ *         EFM_Unlock() and unlock the CLK registers first.
+ */
+en_result_t CLK_SwitchSysclk(uint8_t u8Src, uint32_t u32HclkDiv, stc_clock_flash_cfg_t *pstcFlashCfg)
+{
+    en_result_t enRet = ErrorAccessRights;
+    stc_clock_freq_t stcFreq;
+    const uint8_t u8CurSrc = READ_REG8_BIT(CM_CMU->CKSWR, CMU_CKSWR_CKSW);
+    const uint32_t u32CurDiv = READ_REG32_BIT(CM_CMU->SCFGR, CMU_SCFGR_HCLKS);
+    const uint32_t u32DivFirst = (u32HclkDiv >= u32CurDiv) ? 1UL : 0UL;
+    uint32_t u32MidFreq;
+    uint32_t u32NewFreq;
+    uint32_t u32Wait;
+
+    DDL_ASSERT(IS_CLK_SYSCLK_SRC(u8Src));
+    DDL_ASSERT(IS_CLK_HCLK_DIV(u32HclkDiv));
+    DDL_ASSERT(IS_CLK_UNLOCKED());
+
+    if (1UL == READ_REG32(CM_EFM->FAPRT))
+    {
+        u32NewFreq = Get_TargetClockFreq(u8Src) >> (u32HclkDiv >> CMU_SCFGR_HCLKS_POS);
+        /* Slowing the divider first, or changing the source first otherwise,
+           keeps the intermediate Hclk at or below one of the two ends. */
+        if (1UL == u32DivFirst)
+        {
+            u32MidFreq = Get_TargetClockFreq(u8CurSrc) >> (u32HclkDiv >> CMU_SCFGR_HCLKS_POS);
+        }
+        else
+        {
+            u32MidFreq = Get_TargetClockFreq(u8Src) >> (u32CurDiv >> CMU_SCFGR_HCLKS_POS);
+        }
+
+        /* Raise before any step up */
+        u32Wait = READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT);
+        if (CLK_GetFlashWaitCycle(u32MidFreq) > u32Wait)
+        {
+            u32Wait = CLK_GetFlashWaitCycle(u32MidFreq);
+        }
+        if (CLK_GetFlashWaitCycle(u32NewFreq) > u32Wait)
+        {
+            u32Wait = CLK_GetFlashWaitCycle(u32NewFreq);
+        }
+        Set_FlashWaitCycle(u32Wait);
+
+        if (1UL == u32DivFirst)
+        {
+            if (u32CurDiv != u32HclkDiv)
+            {
+                CLK_ClockDiv(CLK_CATE_HCLK, u32HclkDiv);
+            }
+            if (u8CurSrc != u8Src)
+            {
+                CLK_SetSysclkSrc(u8Src);
+            }
+        }
+        else
+        {
+            if (u8CurSrc != u8Src)
+            {
+                CLK_SetSysclkSrc(u8Src);
+            }
+            if (u32CurDiv != u32HclkDiv)
+            {
+                CLK_ClockDiv(CLK_CATE_HCLK, u32HclkDiv);
+            }
+        }
+        SystemCoreClockUpdate();
+
+        /* Lower after the step down */
+        (void)CLK_GetClockFreq(&stcFreq);
+        Set_FlashWaitCycle(CLK_GetFlashWaitCycle(stcFreq.u32HclkFreq));
+        SET_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_ICHE | EFM_FRMC_DCHE);
+
+        if (NULL != pstcFlashCfg)
+        {
+            pstcFlashCfg->u32HclkFreq = stcFreq.u32HclkFreq;
+            pstcFlashCfg->u32WaitCycle = READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT);
+            pstcFlashCfg->u32Cache = READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_ICHE | EFM_FRMC_DCHE);
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the minimum flash read wait cycles for a Hclk frequency.
+ * @param  [in] u32HclkFreq         Hclk frequency in Hz.
+ * @retval Wait cycles, a value of @ref EFM_Wait_Cycle.
+ */
+uint32_t CLK_GetFlashWaitCycle(uint32_t u32HclkFreq)
+{
+    uint32_t u32Wait = 0UL;
+
+    if (u32HclkFreq > 0UL)
+    {
+        u32Wait = (u32HclkFreq - 1UL) / CLK_FLASH_WAIT_FREQ_STEP;
+    }
+    if (u32Wait > CLK_FLASH_WAIT_MAX)
+    {
+        u32Wait = CLK_FLASH_WAIT_MAX;
+    }
+
+    return u32Wait;
+}
+
 /**
  * @brief  Enable or disable the TPIU clock.
  * @param  [in] enNewState          Specifies the new state of the TPIU clock.
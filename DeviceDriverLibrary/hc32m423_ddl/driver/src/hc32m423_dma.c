@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Add DMA_GetTransCount(), DMA_GetSrcAddr() and DMA_GetDestAddr()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -589,6 +590,63 @@ void DMA_SetTransCount(CM_DMA_TypeDef *DMAx, uint32_t u32Ch, uint16_t u16Count)
     MODIFY_REG32(*CHxCTL0, DMA_CH0CTL0_CNT, (uint32_t)u16Count << DMA_CH0CTL0_CNT_POS);
 }
 
+/**
+ * @brief  Get the remaining transfer count of the specified DMA channel.
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  CM_DMA Unit.
+ * @param  [in] u32Ch DMA channel.
+ *   @arg  DMA_CH0.
+ *   @arg  DMA_CH1.
+ *   @arg  DMA_CH2.
+ *   @arg  DMA_CH3.
+ * @retval Remaining transfer count (0 ~ 1023).
+ */
+uint16_t DMA_GetTransCount(const CM_DMA_TypeDef *DMAx, uint32_t u32Ch)
+{
+    DDL_ASSERT(IS_VALID_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_VALID_DMA_CH(u32Ch));
+
+    return (uint16_t)(READ_REG32_BIT(DMA_CH_REG(DMAx->CH0CTL0, u32Ch), DMA_CH0CTL0_CNT) >> DMA_CH0CTL0_CNT_POS);
+}
+
+/**
+ * @brief  Get the current source address of the specified DMA channel.
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  CM_DMA Unit.
+ * @param  [in] u32Ch DMA channel.
+ *   @arg  DMA_CH0.
+ *   @arg  DMA_CH1.
+ *   @arg  DMA_CH2.
+ *   @arg  DMA_CH3.
+ * @retval Source address.
+ */
+uint32_t DMA_GetSrcAddr(const CM_DMA_TypeDef *DMAx, uint32_t u32Ch)
+{
+    DDL_ASSERT(IS_VALID_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_VALID_DMA_CH(u32Ch));
+
+    return READ_REG32(DMA_CH_REG(DMAx->SAR0, u32Ch));
+}
+
+/**
+ * @brief  Get the current destination address of the specified DMA channel.
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  CM_DMA Unit.
+ * @param  [in] u32Ch DMA channel.
+ *   @arg  DMA_CH0.
+ *   @arg  DMA_CH1.
+ *   @arg  DMA_CH2.
+ *   @arg  DMA_CH3.
+ * @retval Destination address.
+ */
+uint32_t DMA_GetDestAddr(const CM_DMA_TypeDef *DMAx, uint32_t u32Ch)
+{
+    DDL_ASSERT(IS_VALID_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_VALID_DMA_CH(u32Ch));
+
+    return READ_REG32(DMA_CH_REG(DMAx->DAR0, u32Ch));
+}
+
 /**
  * @brief  Initialize DMA config structure. Fill each pstcDmaInit with default value
  * @param  [in] pstcDmaInit Pointer to a stc_dma_init_t structure that
@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Use time based timeout in microseconds
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -49,9 +50,9 @@
  * @defgroup EFM_Local_Macros EFM Local Macros
  * @{
  */
-#define EFM_PGM_TIMEOUT              (HCLK_VALUE / 20000UL)   /* EFM Program timeout */
-#define EFM_ERASE_TIMEOUT            (HCLK_VALUE / 20UL)      /* EFM Erase timeout */
-#define EFM_SEQ_PGM_TIMEOUT          (HCLK_VALUE / 200000UL) /* EFM Sequence Program timeout */
+#define EFM_PGM_TIMEOUT              (1000UL)      /* EFM Program timeout(us) */
+#define EFM_ERASE_TIMEOUT            (100000UL)    /* EFM Erase timeout(us) */
+#define EFM_SEQ_PGM_TIMEOUT          (200UL)       /* EFM Sequence Program timeout(us) */
 
 /**
  * @defgroup EFM_Configuration_Bit_Mask EFM Configuration Bit Mask
@@ -338,14 +339,14 @@ void EFM_DataCacheCmd(en_functional_state_t enNewState)
 en_result_t EFM_SetOperateMode(uint32_t u32Mode)
 {
     en_result_t enRet = Ok;
-    uint32_t u32Timeout = 0UL;
+    stc_ddl_deadline_t stcDeadline;
     DDL_ASSERT(IS_VALID_EFM_OPERATE_MD(u32Mode));
     DDL_ASSERT(IS_VALID_EFM_UNLOCK());
 
+    DDL_DeadlineStart(&stcDeadline, EFM_SEQ_PGM_TIMEOUT);
     while (EFM_GetStatus(EFM_FLAG_RDY) != Set)
     {
-        u32Timeout++;
-        if (u32Timeout > EFM_SEQ_PGM_TIMEOUT)
+        if (Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
@@ -481,7 +482,7 @@ en_result_t EFM_Program32(uint32_t u32Addr, uint32_t u32Data)
 {
     en_result_t enRet = Ok;
     uint32_t u32Tmp;
-    uint32_t u32Timeout = 0UL;
+    stc_ddl_deadline_t stcDeadline;
 
     DDL_ASSERT(IS_VALID_EFM_UNLOCK());
     DDL_ASSERT(IS_VALID_EFM_ADDR(u32Addr));
@@ -499,10 +500,10 @@ en_result_t EFM_Program32(uint32_t u32Addr, uint32_t u32Data)
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_PGM_SINGLE);
     /* program data. */
     RW_MEM32(u32Addr) = (uint32_t)u32Data;
+    DDL_DeadlineStart(&stcDeadline, EFM_PGM_TIMEOUT);
     while(Set != EFM_GetStatus(EFM_FLAG_RDY))
     {
-        u32Timeout ++;
-        if(u32Timeout >= EFM_PGM_TIMEOUT)
+        if(Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
@@ -538,7 +539,7 @@ en_result_t EFM_Program16(uint32_t u32Addr, uint16_t u16Data)
 {
     en_result_t enRet = Ok;
     uint32_t u32Tmp;
-    uint32_t u32Timeout = 0UL;
+    stc_ddl_deadline_t stcDeadline;
 
     DDL_ASSERT(IS_VALID_EFM_UNLOCK());
     DDL_ASSERT(IS_VALID_EFM_ADDR(u32Addr));
@@ -556,10 +557,10 @@ en_result_t EFM_Program16(uint32_t u32Addr, uint16_t u16Data)
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_PGM_SINGLE);
     /* program data. */
     RW_MEM16(u32Addr) = u16Data;
+    DDL_DeadlineStart(&stcDeadline, EFM_PGM_TIMEOUT);
     while(Set != EFM_GetStatus(EFM_FLAG_RDY))
     {
-        u32Timeout ++;
-        if(u32Timeout >= EFM_PGM_TIMEOUT)
+        if(Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
@@ -596,7 +597,7 @@ en_result_t EFM_ProgramReadBack32(uint32_t u32Addr, uint32_t u32Data)
 {
     en_result_t enRet = Ok;
     uint32_t u32Tmp;
-    uint32_t u32Timeout = 0UL;
+    stc_ddl_deadline_t stcDeadline;
 
     DDL_ASSERT(IS_VALID_EFM_UNLOCK());
     DDL_ASSERT(IS_VALID_EFM_ADDR(u32Addr));
@@ -615,10 +616,10 @@ en_result_t EFM_ProgramReadBack32(uint32_t u32Addr, uint32_t u32Data)
     /* program data. */
     RW_MEM32(u32Addr) = u32Data;
 
+    DDL_DeadlineStart(&stcDeadline, EFM_PGM_TIMEOUT);
     while(Set != EFM_GetStatus(EFM_FLAG_RDY))
     {
-        u32Timeout ++;
-        if(u32Timeout >= EFM_PGM_TIMEOUT)
+        if(Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
@@ -657,7 +658,7 @@ en_result_t EFM_ProgramReadBack16(uint32_t u32Addr, uint16_t u16Data)
 {
     en_result_t enRet = Ok;
     uint32_t u32Tmp;
-    uint32_t u32Timeout = 0UL;
+    stc_ddl_deadline_t stcDeadline;
 
     DDL_ASSERT(IS_VALID_EFM_UNLOCK());
     DDL_ASSERT(IS_VALID_EFM_ADDR(u32Addr));
@@ -676,10 +677,10 @@ en_result_t EFM_ProgramReadBack16(uint32_t u32Addr, uint16_t u16Data)
     /* program data. */
     RW_MEM16(u32Addr) = u16Data;
 
+    DDL_DeadlineStart(&stcDeadline, EFM_PGM_TIMEOUT);
     while(Set != EFM_GetStatus(EFM_FLAG_RDY))
     {
-        u32Timeout ++;
-        if(u32Timeout > EFM_PGM_TIMEOUT)
+        if(Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
@@ -718,7 +719,7 @@ en_result_t EFM_ProgramReadBack16(uint32_t u32Addr, uint16_t u16Data)
 en_result_t EFM_SeqProgram16(uint32_t u32Addr, uint32_t u32Len, const uint16_t *pu16Buf)
 {
     en_result_t enRet = Ok;
-    uint32_t u32Timeout;
+    stc_ddl_deadline_t stcDeadline;
     uint32_t u32Tmp;
     uint32_t u32TempAddr = u32Addr;
     uint32_t u32pSrc = (uint32_t )pu16Buf;
@@ -743,12 +744,11 @@ en_result_t EFM_SeqProgram16(uint32_t u32Addr, uint32_t u32Len, const uint16_t *
         RW_MEM16(u32TempAddr) = RW_MEM16(u32pSrc);
         u32TempAddr += 2U;
         u32pSrc += 2U;
-        u32Timeout = 0UL;
         /* wait operate end. */
+        DDL_DeadlineStart(&stcDeadline, EFM_SEQ_PGM_TIMEOUT);
         while(Set != EFM_GetStatus(EFM_FLAG_OPTEND))
         {
-            u32Timeout++;
-            if (u32Timeout >= EFM_SEQ_PGM_TIMEOUT)
+            if(Set == DDL_DeadlineIsExpired(&stcDeadline))
             {
                 enRet = ErrorTimeout;
                 break;
@@ -766,11 +766,10 @@ en_result_t EFM_SeqProgram16(uint32_t u32Addr, uint32_t u32Len, const uint16_t *
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
     /* Disable operate mode modified. */
     CLEAR_REG32_BIT(CM_EFM->FWMC, EFM_FWMC_PEMODE);
-    u32Timeout = 0UL;
+    DDL_DeadlineStart(&stcDeadline, EFM_SEQ_PGM_TIMEOUT);
     while(Set != EFM_GetStatus(EFM_FLAG_RDY))
     {
-        u32Timeout ++;
-        if(u32Timeout > EFM_SEQ_PGM_TIMEOUT)
+        if(Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
@@ -799,7 +798,7 @@ en_result_t EFM_SeqProgram16(uint32_t u32Addr, uint32_t u32Len, const uint16_t *
 en_result_t EFM_SeqProgram32(uint32_t u32Addr, uint32_t u32Len, const uint32_t *pu32Buf)
 {
     en_result_t enRet = Ok;
-    uint32_t u32Timeout;
+    stc_ddl_deadline_t stcDeadline;
     uint32_t u32Tmp;
     uint32_t u32TempAddr = u32Addr;
     uint32_t u32pSrc = (uint32_t )pu32Buf;
@@ -824,12 +823,11 @@ en_result_t EFM_SeqProgram32(uint32_t u32Addr, uint32_t u32Len, const uint32_t *
         RW_MEM32(u32TempAddr) = RW_MEM32(u32pSrc);
         u32TempAddr += 4U;
         u32pSrc += 4U;
-        u32Timeout = 0UL;
         /* wait operate end. */
+        DDL_DeadlineStart(&stcDeadline, EFM_SEQ_PGM_TIMEOUT);
         while(Set != EFM_GetStatus(EFM_FLAG_OPTEND))
         {
-            u32Timeout++;
-            if (u32Timeout >= EFM_SEQ_PGM_TIMEOUT)
+            if(Set == DDL_DeadlineIsExpired(&stcDeadline))
             {
                 enRet = ErrorTimeout;
                 break;
@@ -847,11 +845,10 @@ en_result_t EFM_SeqProgram32(uint32_t u32Addr, uint32_t u32Len, const uint32_t *
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
     /* Disable operate mode modified. */
     CLEAR_REG32_BIT(CM_EFM->FWMC, EFM_FWMC_PEMODE);
-    u32Timeout = 0UL;
+    DDL_DeadlineStart(&stcDeadline, EFM_SEQ_PGM_TIMEOUT);
     while(Set != EFM_GetStatus(EFM_FLAG_RDY))
     {
-        u32Timeout ++;
-        if(u32Timeout > EFM_SEQ_PGM_TIMEOUT)
+        if(Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
@@ -876,7 +873,7 @@ en_result_t EFM_SeqProgram32(uint32_t u32Addr, uint32_t u32Len, const uint32_t *
 en_result_t EFM_SectorErase(uint32_t u32Addr)
 {
     en_result_t enRet = Ok;
-    uint32_t u32Timeout = 0UL;
+    stc_ddl_deadline_t stcDeadline;
     uint32_t u32Tmp;
 
     DDL_ASSERT(IS_VALID_EFM_UNLOCK());
@@ -893,10 +890,10 @@ en_result_t EFM_SectorErase(uint32_t u32Addr)
     /* Set sector erase mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_ERASE_SECT);
     RW_MEM32(u32Addr & 0xFFFFFFFCUL) = (uint32_t)0x0UL;
+    DDL_DeadlineStart(&stcDeadline, EFM_ERASE_TIMEOUT);
     while(Set != EFM_GetStatus(EFM_FLAG_RDY))
     {
-        u32Timeout ++;
-        if(u32Timeout >= EFM_ERASE_TIMEOUT)
+        if(Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
@@ -926,7 +923,7 @@ en_result_t EFM_ChipErase(void)
 {
     en_result_t enRet = Ok;
     uint32_t u32Tmp;
-    uint32_t u32Timeout = 0UL;
+    stc_ddl_deadline_t stcDeadline;
 
     /* Clear the error flag. */
     EFM_ClearStatus(EFM_CLR_FLAG_MASK);
@@ -940,10 +937,10 @@ en_result_t EFM_ChipErase(void)
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_ERASE_CHIP);
     RW_MEM32(EFM_ADRR_SECT20) = 0x0UL;
 
+    DDL_DeadlineStart(&stcDeadline, EFM_ERASE_TIMEOUT);
     while(Set != EFM_GetStatus(EFM_FLAG_RDY))
     {
-        u32Timeout ++;
-        if(u32Timeout >= EFM_ERASE_TIMEOUT)
+        if(Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
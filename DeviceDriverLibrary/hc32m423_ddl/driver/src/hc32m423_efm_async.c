@@ -0,0 +1,530 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_efm_async.c
+ * @brief This file provides firmware functions for interrupt driven EFM
+ *        program and erase jobs.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_efm_async.h"
+#include "hc32m423_efm.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_EFM_ASYNC EFM_ASYNC
+ * @brief Interrupt Driven EFM Job Driver Library
+ * @details A job erases the sectors of a range, programs a range, or both.
+ *          EFM_ASYNC_Start() issues the first sector erase or word program
+ *          and returns; each end of operation interrupt checks the error
+ *          flags and issues the next step, so the CPU is free between the
+ *          steps instead of polling the flags.
+ *          Words are programmed in the read back mode, the hardware flags a
+ *          mismatch. The caches stay enabled, cached code keeps running
+ *          during a step, and the cache data is reset after each erase and
+ *          at the end of the job.
+ *          The interrupt handlers and the step functions are placed in RAM
+ *          (__RAM_FUNC). While a step runs, a flash access stalls with
+ *          EFM_BUS_BUSY or raises a read collision with EFM_BUS_RELEASE, so
+ *          code, vector table and constants used by other interrupts must be
+ *          in RAM or in the cache to keep running. Progress and completion
+ *          callbacks are called from the interrupt between steps, when the
+ *          flash can be read.
+ *          Call EFM_Unlock() before EFM_ASYNC_Init(), and call
+ *          EFM_ASYNC_OpEnd_IrqHandler() and EFM_ASYNC_PeErr_IrqHandler()
+ *          from EFM_OpEnd_IrqHandler() and EFM_ProgramEraseError_IrqHandler(),
+ *          or install them with INTC_VectorSignIn() in the direct vector mode.
+ *          A step issued from the interrupt keeps the bus held unless the
+ *          EFM_OpEnd vector points to EFM_ASYNC_OpEnd_IrqHandler() itself:
+ *          through IRQ027_Handler() the handler returns to flash code.
+ *          EFM_BUS_RELEASE also requires the interrupted context to run from
+ *          RAM or from the cache, it resumes while the step runs.
+ * @{
+ */
+
+#if (DDL_EFM_ASYNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_ASYNC_Local_Macros EFM_ASYNC Local Macros
+ * @{
+ */
+#define EFM_ASYNC_SECTOR_SIZE           (0x200UL)
+
+#define EFM_ASYNC_ERR_FLAG              (EFM_FLAG_PEWERR | EFM_FLAG_PEPRTERR | EFM_FLAG_PGMISMTCHERR)
+#define EFM_ASYNC_CLR_FLAG              (EFM_ASYNC_ERR_FLAG | EFM_FLAG_OPTEND | EFM_FLAG_COLERR)
+#define EFM_ASYNC_INT                   (EFM_INT_EOP | EFM_INT_PEERR)
+
+/* Loops waiting for the ready flag after the end of operation */
+#define EFM_ASYNC_RDY_TIMEOUT           (1000UL)
+
+/* EFM_OpEnd entry of the vector table, after the 16 system exceptions */
+#define EFM_ASYNC_OPEND_VECTOR          (16UL + (uint32_t)EFM_OPTEND_IRQn)
+
+/* Job phase */
+#define EFM_ASYNC_PHASE_IDLE            (0UL)
+#define EFM_ASYNC_PHASE_ERASE           (1UL)
+#define EFM_ASYNC_PHASE_PROGRAM         (2UL)
+
+/**
+ * @defgroup EFM_ASYNC_Check_Parameters_Validity EFM_ASYNC Check Parameters Validity
+ * @{
+ */
+#define IS_EFM_ASYNC_OP(x)                                                     \
+(   ((x) == EFM_ASYNC_OP_ERASE)                 ||                             \
+    ((x) == EFM_ASYNC_OP_PROGRAM)               ||                             \
+    ((x) == EFM_ASYNC_OP_UPDATE))
+
+#define IS_EFM_ASYNC_BUS_STATUS(x)                                             \
+(   ((x) == EFM_BUS_BUSY)                       ||                             \
+    ((x) == EFM_BUS_RELEASE))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup EFM_ASYNC_Local_Functions
+ * @{
+ */
+static void __RAM_FUNC EFM_ASYNC_Issue(void);
+static void __RAM_FUNC EFM_ASYNC_Finish(en_result_t enResult);
+static uint32_t __RAM_FUNC EFM_ASYNC_StepBusStatus(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_ASYNC_Local_Variables EFM_ASYNC Local Variables
+ * @{
+ */
+static stc_efm_async_job_t m_stcJob;
+static uint32_t m_u32BusStatus = EFM_BUS_BUSY;
+static uint32_t m_u32BusSave = EFM_BUS_BUSY;
+static uint32_t m_u32Init = 0UL;
+
+static volatile uint32_t m_u32Phase = EFM_ASYNC_PHASE_IDLE;
+static volatile uint32_t m_u32Abort = 0UL;
+static volatile en_result_t m_enResult = Ok;
+static uint32_t m_u32EraseAddr = 0UL;   /* First sector of the erase */
+static uint32_t m_u32EraseSize = 0UL;   /* Bytes of the erased sectors */
+static uint32_t m_u32Pos = 0UL;         /* Bytes done in the phase */
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_ASYNC_Global_Functions EFM_ASYNC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_efm_async_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_efm_async_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t EFM_ASYNC_StructInit(stc_efm_async_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32BusStatus = EFM_BUS_BUSY;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI03;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the EFM job interrupts.
+ * @param  [in] pstcInit                Pointer to a stc_efm_async_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ *   @arg  ErrorOperationInProgress:    A job is running
+ */
+en_result_t EFM_ASYNC_Init(const stc_efm_async_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (m_u32Phase != EFM_ASYNC_PHASE_IDLE)
+    {
+        enRet = ErrorOperationInProgress;
+    }
+    else if (pstcInit != NULL)
+    {
+        DDL_ASSERT(IS_EFM_ASYNC_BUS_STATUS(pstcInit->u32BusStatus));
+
+        m_u32BusStatus = pstcInit->u32BusStatus;
+        m_enResult = Ok;
+
+        NVIC_ClearPendingIRQ(EFM_OPTEND_IRQn);
+        NVIC_SetPriority(EFM_OPTEND_IRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(EFM_OPTEND_IRQn);
+        NVIC_ClearPendingIRQ(EFM_PEERR_IRQn);
+        NVIC_SetPriority(EFM_PEERR_IRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(EFM_PEERR_IRQn);
+
+        m_u32Init = 1UL;
+        enRet = Ok;
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the EFM job interrupts.
+ * @param  None
+ * @retval None
+ * @note   A running job is aborted first.
+ */
+void EFM_ASYNC_DeInit(void)
+{
+    EFM_ASYNC_Abort();
+    while (m_u32Phase != EFM_ASYNC_PHASE_IDLE)
+    {
+        ;
+    }
+    NVIC_DisableIRQ(EFM_OPTEND_IRQn);
+    NVIC_DisableIRQ(EFM_PEERR_IRQn);
+    m_u32Init = 0UL;
+}
+
+/**
+ * @brief  Start an EFM job.
+ * @param  [in] pstcJob                 Pointer to a stc_efm_async_job_t structure, copied.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          The first step is issued
+ *   @arg  ErrorInvalidParameter:       Invalid job
+ *   @arg  ErrorUninitialized:          EFM_ASYNC_Init() not called
+ *   @arg  ErrorOperationInProgress:    A job is running
+ * @note   This function runs from flash, so the first step is issued with
+ *         the bus held (EFM_BUS_BUSY): the CPU stalls on its next flash
+ *         access until that step ends. The following steps use
+ *         stc_efm_async_init_t::u32BusStatus if the EFM_OpEnd vector points
+ *         to EFM_ASYNC_OpEnd_IrqHandler(), EFM_BUS_BUSY otherwise.
+ */
+en_result_t EFM_ASYNC_Start(const stc_efm_async_job_t *pstcJob)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Primask;
+
+    if (m_u32Init == 0UL)
+    {
+        enRet = ErrorUninitialized;
+    }
+    else if (m_u32Phase != EFM_ASYNC_PHASE_IDLE)
+    {
+        enRet = ErrorOperationInProgress;
+    }
+    else if ((pstcJob != NULL) && (pstcJob->u32Size != 0UL) &&
+             ((pstcJob->u32Addr & 3UL) == 0UL) && ((pstcJob->u32Size & 3UL) == 0UL) &&
+             ((pstcJob->u32Addr + pstcJob->u32Size - 1UL) <= EFM_END_ADDR) &&
+             (((pstcJob->u32Op & EFM_ASYNC_OP_PROGRAM) == 0UL) || (pstcJob->pu32Data != NULL)))
+    {
+        DDL_ASSERT(IS_EFM_ASYNC_OP(pstcJob->u32Op));
+
+        m_stcJob = *pstcJob;
+        m_u32EraseAddr = pstcJob->u32Addr & ~(EFM_ASYNC_SECTOR_SIZE - 1UL);
+        m_u32EraseSize = 0UL;
+        if ((pstcJob->u32Op & EFM_ASYNC_OP_ERASE) != 0UL)
+        {
+            m_u32EraseSize = ((pstcJob->u32Addr + pstcJob->u32Size + EFM_ASYNC_SECTOR_SIZE - 1UL) &
+                              ~(EFM_ASYNC_SECTOR_SIZE - 1UL)) - m_u32EraseAddr;
+        }
+        m_u32Pos = 0UL;
+        m_u32Abort = 0UL;
+        m_enResult = ErrorOperationInProgress;
+
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        m_u32BusSave = READ_REG32_BIT(CM_EFM->FWMC, EFM_FWMC_BUSHLDCTL);
+        /* This function returns through flash, so the first step holds the bus */
+        EFM_SetBusStatus(EFM_BUS_BUSY);
+        EFM_ClearStatus(EFM_ASYNC_CLR_FLAG);
+        SET_REG32_BIT(CM_EFM->FWMC, EFM_FWMC_PEMODE);
+        EFM_IntCmd(EFM_ASYNC_INT, Enable);
+        m_u32Phase = (m_u32EraseSize != 0UL) ? EFM_ASYNC_PHASE_ERASE : EFM_ASYNC_PHASE_PROGRAM;
+        EFM_ASYNC_Issue();
+        __set_PRIMASK(u32Primask);
+        enRet = Ok;
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Abort the running job after the current step.
+ * @param  None
+ * @retval None
+ * @note   The completion callback reports ErrorNotReady.
+ */
+void EFM_ASYNC_Abort(void)
+{
+    if (m_u32Phase != EFM_ASYNC_PHASE_IDLE)
+    {
+        m_u32Abort = 1UL;
+    }
+}
+
+/**
+ * @brief  Get the job state.
+ * @param  None
+ * @retval An en_flag_status_t enumeration value:
+ *   @arg  Set:                         A job is running
+ *   @arg  Reset:                       No job is running
+ */
+en_flag_status_t EFM_ASYNC_IsBusy(void)
+{
+    return (m_u32Phase != EFM_ASYNC_PHASE_IDLE) ? Set : Reset;
+}
+
+/**
+ * @brief  Get the result of the last job.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          The job is done
+ *   @arg  ErrorOperationInProgress:    The job is running
+ *   @arg  ErrorNotReady:               The job was aborted
+ *   @arg  Error:                       Flash program or erase error
+ */
+en_result_t EFM_ASYNC_GetResult(void)
+{
+    return m_enResult;
+}
+
+/**
+ * @brief  EFM end of operation interrupt handler, issues the next step.
+ * @param  None
+ * @retval None
+ */
+void __RAM_FUNC EFM_ASYNC_OpEnd_IrqHandler(void)
+{
+    uint32_t u32Err;
+    uint32_t u32Timeout = 0UL;
+    uint32_t u32Done;
+    uint32_t u32Total;
+
+    while ((0UL == READ_REG32_BIT(CM_EFM->FSR, EFM_FLAG_RDY)) && (u32Timeout < EFM_ASYNC_RDY_TIMEOUT))
+    {
+        u32Timeout++;
+    }
+    u32Err = READ_REG32_BIT(CM_EFM->FSR, EFM_ASYNC_ERR_FLAG);
+    SET_REG32_BIT(CM_EFM->FSCLR, EFM_ASYNC_CLR_FLAG);
+
+    if (m_u32Phase == EFM_ASYNC_PHASE_IDLE)
+    {
+        /* Not a job step */
+    }
+    else if (u32Err != 0UL)
+    {
+        EFM_ASYNC_Finish(Error);
+    }
+    else
+    {
+        if (m_u32Phase == EFM_ASYNC_PHASE_ERASE)
+        {
+            m_u32Pos += EFM_ASYNC_SECTOR_SIZE;
+            WRITE_REG32(bCM_EFM->FRMC_b.CRST, Enable);
+            u32Done = m_u32Pos;
+        }
+        else
+        {
+            m_u32Pos += 4UL;
+            u32Done = m_u32EraseSize + m_u32Pos;
+        }
+        u32Total = m_u32EraseSize + (((m_stcJob.u32Op & EFM_ASYNC_OP_PROGRAM) != 0UL) ? m_stcJob.u32Size : 0UL);
+
+        if ((m_stcJob.pfnProgress != NULL) &&
+            (((u32Done & (EFM_ASYNC_SECTOR_SIZE - 1UL)) == 0UL) || (u32Done == u32Total)))
+        {
+            m_stcJob.pfnProgress(u32Done, u32Total);
+        }
+
+        if (u32Done == u32Total)
+        {
+            EFM_ASYNC_Finish(Ok);
+        }
+        else if (m_u32Abort != 0UL)
+        {
+            EFM_ASYNC_Finish(ErrorNotReady);
+        }
+        else
+        {
+            if ((m_u32Phase == EFM_ASYNC_PHASE_ERASE) && (m_u32Pos == m_u32EraseSize))
+            {
+                m_u32Phase = EFM_ASYNC_PHASE_PROGRAM;
+                m_u32Pos = 0UL;
+            }
+            MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_BUSHLDCTL, EFM_ASYNC_StepBusStatus());
+            EFM_ASYNC_Issue();
+        }
+    }
+}
+
+/**
+ * @brief  EFM program/erase error interrupt handler, ends the job.
+ * @param  None
+ * @retval None
+ */
+void __RAM_FUNC EFM_ASYNC_PeErr_IrqHandler(void)
+{
+    SET_REG32_BIT(CM_EFM->FSCLR, EFM_ASYNC_CLR_FLAG);
+    if (m_u32Phase != EFM_ASYNC_PHASE_IDLE)
+    {
+        EFM_ASYNC_Finish(Error);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup EFM_ASYNC_Local_Functions EFM_ASYNC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Issue the erase of the next sector or the program of the next word.
+ * @param  None
+ * @retval None
+ */
+static void __RAM_FUNC EFM_ASYNC_Issue(void)
+{
+    uint32_t u32Data;
+
+    if (m_u32Phase == EFM_ASYNC_PHASE_ERASE)
+    {
+        MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_ERASE_SECT);
+        RW_MEM32(m_u32EraseAddr + m_u32Pos) = 0UL;
+    }
+    else
+    {
+        /* Read the data before the flash gets busy, it may be in flash */
+        u32Data = m_stcJob.pu32Data[m_u32Pos / 4UL];
+        MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_PGM_READBACK);
+        RW_MEM32(m_stcJob.u32Addr + m_u32Pos) = u32Data;
+    }
+}
+
+/**
+ * @brief  Bus status of a step issued from the interrupt.
+ * @param  None
+ * @retval EFM_BUS_RELEASE only if configured and the EFM_OpEnd vector
+ *         points to EFM_ASYNC_OpEnd_IrqHandler(), so the exception returns
+ *         without running flash code; EFM_BUS_BUSY otherwise.
+ * @note   The flash is ready here, the vector table may be in flash.
+ */
+static uint32_t __RAM_FUNC EFM_ASYNC_StepBusStatus(void)
+{
+    uint32_t u32Ret = EFM_BUS_BUSY;
+    uint32_t u32Vector;
+
+    if (m_u32BusStatus == EFM_BUS_RELEASE)
+    {
+        u32Vector = RW_MEM32(READ_REG32(SCB->VTOR) + (EFM_ASYNC_OPEND_VECTOR * 4UL));
+        if ((u32Vector & ~1UL) == ((uint32_t)&EFM_ASYNC_OpEnd_IrqHandler & ~1UL))
+        {
+            u32Ret = EFM_BUS_RELEASE;
+        }
+    }
+
+    return u32Ret;
+}
+
+/**
+ * @brief  End the job: restore the read mode and the bus status, then call
+ *         the completion callback.
+ * @param  [in] enResult                Result of the job.
+ * @retval None
+ */
+static void __RAM_FUNC EFM_ASYNC_Finish(en_result_t enResult)
+{
+    CLEAR_REG32_BIT(CM_EFM->FITE, EFM_ASYNC_INT);
+    MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
+    CLEAR_REG32_BIT(CM_EFM->FWMC, EFM_FWMC_PEMODE);
+    MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_BUSHLDCTL, m_u32BusSave);
+    WRITE_REG32(bCM_EFM->FRMC_b.CRST, Enable);
+
+    m_enResult = enResult;
+    m_u32Phase = EFM_ASYNC_PHASE_IDLE;
+    if (m_stcJob.pfnDone != NULL)
+    {
+        m_stcJob.pfnDone(enResult);
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_EFM_ASYNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
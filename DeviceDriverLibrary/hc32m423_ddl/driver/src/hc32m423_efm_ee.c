@@ -0,0 +1,1192 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_efm_ee.c
+ * @brief This file provides firmware functions for the EEPROM emulation on
+ *        the internal flash.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_efm_ee.h"
+#include "hc32m423_efm.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_EFM_EE EFM_EE
+ * @brief EEPROM Emulation Driver Library
+ * @details Key/value store in a ring of flash sectors. A value is written as
+ *          a record appended to the newest sector: a header word with the
+ *          key, the length and a check byte, the data words, and a word
+ *          with the CRC-16/CCITT of header and data. A RAM index holds the
+ *          flash position of the current record of every key, so a lookup
+ *          costs one index read; it takes 2 bytes per key.
+ *          Each sector starts with a header of magic, sequence number, its
+ *          inverse and a state word. The sequence number orders the
+ *          sectors of the log. When no free sector is left beside the
+ *          spare one, the oldest sector is compacted: its current records
+ *          are copied to the newest sector, then it is marked released and
+ *          erased. Every sector of the ring is erased in turn, which levels
+ *          the wear.
+ *          An interrupted write or compaction leaves at most a record with
+ *          a bad check byte or CRC, which the scan at EFM_EE_Init() skips,
+ *          and copies which are newer than their originals. The scan
+ *          completes an interrupted compaction.
+ *          Flash program, erase and read go through stc_efm_ee_flash_t,
+ *          which defaults to the EFM driver. The example efm_ee_power_loss
+ *          runs the store on a RAM flash model which cuts the power at each
+ *          flash operation in turn.
+ *          With the EFM driver, call EFM_Unlock() and enable the flash
+ *          program (FWMC) before writing. The functions are not reentrant.
+ * @{
+ */
+
+#if (DDL_EFM_EE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_EE_Local_Macros EFM_EE Local Macros
+ * @{
+ */
+#define EFM_EE_SECT_WORDS               (EFM_EE_SECTOR_SIZE / 4UL)
+#define EFM_EE_SECT_HDR_WORDS           (4UL)
+#define EFM_EE_SECT_CAP                 (EFM_EE_SECT_WORDS - EFM_EE_SECT_HDR_WORDS)
+
+/* Sector header words */
+#define EFM_EE_SECT_MAGIC               (0UL)
+#define EFM_EE_SECT_SEQ                 (1UL)
+#define EFM_EE_SECT_SEQ_INV             (2UL)
+#define EFM_EE_SECT_STATE               (3UL)
+
+#define EFM_EE_MAGIC                    (0x45454D31UL)
+#define EFM_EE_STATE_RELEASED           (0x00000000UL)
+#define EFM_EE_BLANK                    (0xFFFFFFFFUL)
+#define EFM_EE_IDX_NONE                 (0xFFFFU)
+
+/* Record: header, data words, CRC word. A zero length deletes the key. */
+#define EFM_EE_REC_WORDS(len)           ((((len) + 3UL) / 4UL) + 2UL)
+#define EFM_EE_HDR_CHK(key, len)        ((~((key) ^ ((key) >> 8U) ^ (len))) & 0xFFUL)
+#define EFM_EE_HDR(key, len)                                                   \
+(   (key) | ((len) << 16U) | (EFM_EE_HDR_CHK((key), (len)) << 24U))
+#define EFM_EE_HDR_KEY(hdr)             ((hdr) & 0xFFFFUL)
+#define EFM_EE_HDR_LEN(hdr)             (((hdr) >> 16U) & 0xFFUL)
+
+#define EFM_EE_CRC_INIT                 (0xFFFFU)
+#define EFM_EE_CRC_POLY                 (0x1021U)
+
+/* Record check result */
+#define EFM_EE_REC_OK                   (0UL)
+#define EFM_EE_REC_CRC                  (1UL)   /*!< Bad CRC, skipped */
+#define EFM_EE_REC_BLANK                (2UL)   /*!< Free space */
+#define EFM_EE_REC_CORRUPT              (3UL)   /*!< Bad header, the rest of the sector is unusable */
+
+/**
+ * @defgroup EFM_EE_Check_Parameters_Validity EFM_EE Check Parameters Validity
+ * @{
+ */
+#define IS_EFM_EE_SECTOR_NUM(x)                                                \
+(   ((x) >= 2UL)                                &&                             \
+    ((x) <= EFM_EE_SECTOR_NUM_MAX))
+
+#define IS_EFM_EE_AREA(addr, num)                                              \
+(   (((addr) & (EFM_EE_SECTOR_SIZE - 1UL)) == 0UL)   &&                        \
+    (((addr) + ((num) * EFM_EE_SECTOR_SIZE) - 1UL) <= EFM_END_ADDR))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup EFM_EE_Local_Functions
+ * @{
+ */
+static en_result_t EFM_EE_EfmErase(uint32_t u32Addr);
+static uint32_t EFM_EE_EfmRead(uint32_t u32Addr);
+static uint32_t EFM_EE_ReadWord(uint32_t u32Off);
+static en_result_t EFM_EE_ProgWord(uint32_t u32Off, uint32_t u32Data);
+static uint32_t EFM_EE_SectIdx(uint32_t u32Pos);
+static uint32_t EFM_EE_GetSectSeq(uint32_t u32Sect, uint32_t *pu32Seq);
+static uint32_t EFM_EE_IsBlank(uint32_t u32Off, uint32_t u32End);
+static en_result_t EFM_EE_SectErase(uint32_t u32Sect);
+static en_result_t EFM_EE_SectOpen(void);
+static uint16_t EFM_EE_Crc(uint16_t u16Crc, uint32_t u32Word, uint32_t u32Bytes);
+static uint32_t EFM_EE_RecCheck(uint32_t u32Off, uint32_t *pu32Words);
+static en_result_t EFM_EE_Append(uint32_t u32Hdr, const uint8_t au8Data[], uint32_t u32SrcOff,
+                                 uint32_t *pu32Off);
+static en_result_t EFM_EE_Reserve(uint32_t u32Words);
+static en_result_t EFM_EE_Put(uint32_t u32Hdr, const uint8_t au8Data[]);
+static en_result_t EFM_EE_CompactHead(void);
+static void EFM_EE_Apply(uint32_t u32Hdr, uint32_t u32Off);
+static void EFM_EE_Replay(void);
+static en_result_t EFM_EE_Mount(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_EE_Local_Variables EFM_EE Local Variables
+ * @{
+ */
+static const stc_efm_ee_flash_t m_stcEfmFlash =
+{
+    &EFM_Program32, &EFM_EE_EfmErase, &EFM_EE_EfmRead
+};
+
+static stc_efm_ee_flash_t m_stcFlash;
+static uint32_t m_u32StartAddr = 0UL;
+static uint32_t m_u32SectNum = 0UL;
+static uint16_t *m_pu16Index = NULL;
+static uint32_t m_u32KeyNum = 0UL;
+
+static uint32_t m_u32Head = 0UL;        /* Oldest sector of the log */
+static uint32_t m_u32Used = 0UL;        /* Sectors in the log */
+static uint32_t m_u32HeadSeq = 0UL;     /* Sequence number of the oldest sector */
+static uint32_t m_u32WrOff = 0UL;       /* Next free word in the newest sector */
+static uint32_t m_u32LiveWords = 0UL;
+static uint32_t m_u32KeyCount = 0UL;
+static uint32_t m_u32RecWordsMax = 0UL; /* Longest value record since the mount */
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_EE_Global_Functions EFM_EE Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_efm_ee_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_efm_ee_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ * @note   The default area is the last four sectors of the flash.
+ */
+en_result_t EFM_EE_StructInit(stc_efm_ee_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32StartAddr = (EFM_END_ADDR + 1UL) - (4UL * EFM_EE_SECTOR_SIZE);
+        pstcInit->u32SectorNum = 4UL;
+        pstcInit->pu16Index = NULL;
+        pstcInit->u32KeyNum = 0UL;
+        pstcInit->pstcFlash = NULL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the store and build the index from the flash.
+ * @param  [in] pstcInit                Pointer to a stc_efm_ee_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration
+ *   @arg  Error:                       Flash program or erase error
+ * @note   An area without a valid sector is formatted. Records of keys
+ *         above u32KeyNum - 1 are ignored and dropped by the compaction.
+ */
+en_result_t EFM_EE_Init(const stc_efm_ee_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcInit != NULL) && (pstcInit->pu16Index != NULL) &&
+        (pstcInit->u32KeyNum != 0UL) && (pstcInit->u32KeyNum <= EFM_EE_KEY_NUM_MAX) &&
+        IS_EFM_EE_SECTOR_NUM(pstcInit->u32SectorNum))
+    {
+        DDL_ASSERT(IS_EFM_EE_AREA(pstcInit->u32StartAddr, pstcInit->u32SectorNum));
+
+        if (pstcInit->pstcFlash != NULL)
+        {
+            m_stcFlash = *pstcInit->pstcFlash;
+        }
+        else
+        {
+            m_stcFlash = m_stcEfmFlash;
+        }
+        m_u32StartAddr = pstcInit->u32StartAddr;
+        m_u32SectNum = pstcInit->u32SectorNum;
+        m_pu16Index = pstcInit->pu16Index;
+        m_u32KeyNum = pstcInit->u32KeyNum;
+        m_u32HeadSeq = 0UL;
+        m_u32Used = 0UL;
+
+        enRet = EFM_EE_Mount();
+        if (enRet != Ok)
+        {
+            m_pu16Index = NULL;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the store. The flash is not changed.
+ * @param  None
+ * @retval None
+ */
+void EFM_EE_DeInit(void)
+{
+    m_pu16Index = NULL;
+}
+
+/**
+ * @brief  Erase the area and remove all keys.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorUninitialized:          EFM_EE_Init() not called
+ *   @arg  Error:                       Flash program or erase error
+ */
+en_result_t EFM_EE_Format(void)
+{
+    en_result_t enRet = ErrorUninitialized;
+    uint32_t i;
+
+    if (m_pu16Index != NULL)
+    {
+        enRet = Ok;
+        for (i = 0UL; i < m_u32SectNum; i++)
+        {
+            if (Ok != EFM_EE_SectErase(i))
+            {
+                enRet = Error;
+            }
+        }
+        for (i = 0UL; i < m_u32KeyNum; i++)
+        {
+            m_pu16Index[i] = EFM_EE_IDX_NONE;
+        }
+        /* The sequence continues, it counts the sector cycles */
+        m_u32HeadSeq += m_u32Used;
+        m_u32Head = 0UL;
+        m_u32Used = 0UL;
+        m_u32LiveWords = 0UL;
+        m_u32KeyCount = 0UL;
+        m_u32RecWordsMax = 0UL;
+        if (enRet == Ok)
+        {
+            enRet = EFM_EE_SectOpen();
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Read the value of a key.
+ * @param  [in] u16Key                  Key.
+ * @param  [out] au8Buf                 Buffer of the value.
+ * @param  [in] u32Size                 Size of au8Buf, a longer value is truncated.
+ * @param  [out] pu32Len                Length of the value, may be NULL.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid key or buffer
+ *   @arg  ErrorUninitialized:          EFM_EE_Init() not called
+ *   @arg  ErrorBufferEmpty:            The key has no value
+ */
+en_result_t EFM_EE_Read(uint16_t u16Key, uint8_t au8Buf[], uint32_t u32Size, uint32_t *pu32Len)
+{
+    en_result_t enRet = ErrorUninitialized;
+    uint32_t u32Off;
+    uint32_t u32Len;
+    uint32_t u32Word = 0UL;
+    uint32_t i;
+
+    if (m_pu16Index == NULL)
+    {
+        /* Not initialized */
+    }
+    else if ((u16Key >= m_u32KeyNum) || ((au8Buf == NULL) && (u32Size != 0UL)))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else if (m_pu16Index[u16Key] == EFM_EE_IDX_NONE)
+    {
+        enRet = ErrorBufferEmpty;
+    }
+    else
+    {
+        u32Off = m_pu16Index[u16Key];
+        u32Len = EFM_EE_HDR_LEN(EFM_EE_ReadWord(u32Off));
+        for (i = 0UL; (i < u32Len) && (i < u32Size); i++)
+        {
+            if ((i & 3UL) == 0UL)
+            {
+                u32Word = EFM_EE_ReadWord(u32Off + 1UL + (i / 4UL));
+            }
+            au8Buf[i] = (uint8_t)(u32Word >> ((i & 3UL) * 8UL));
+        }
+        if (pu32Len != NULL)
+        {
+            *pu32Len = u32Len;
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Write the value of a key.
+ * @param  [in] u16Key                  Key.
+ * @param  [in] au8Data                 Value.
+ * @param  [in] u32Len                  Length of the value, 1 ~ EFM_EE_DATA_MAX.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid key or value
+ *   @arg  ErrorUninitialized:          EFM_EE_Init() not called
+ *   @arg  ErrorBufferFull:             The values do not fit in the area
+ *   @arg  Error:                       Flash program or erase error
+ * @note   Writing the current value does not program the flash. A write can
+ *         compact the oldest sector, which takes a sector erase time.
+ * @note   The values must fit in all sectors but one, less the end of each
+ *         sector a record may leave unused: the longest record written since
+ *         EFM_EE_Init() minus one word.
+ */
+en_result_t EFM_EE_Write(uint16_t u16Key, const uint8_t au8Data[], uint32_t u32Len)
+{
+    en_result_t enRet = ErrorUninitialized;
+    uint32_t u32Off;
+    uint32_t u32OldWords = 0UL;
+    uint32_t u32Same = 0UL;
+    uint32_t u32Word = 0UL;
+    uint32_t u32RecMax;
+    uint32_t i;
+
+    if (m_pu16Index == NULL)
+    {
+        /* Not initialized */
+    }
+    else if ((u16Key >= m_u32KeyNum) || (au8Data == NULL) ||
+             (u32Len == 0UL) || (u32Len > EFM_EE_DATA_MAX))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        u32Off = m_pu16Index[u16Key];
+        if (u32Off != EFM_EE_IDX_NONE)
+        {
+            u32OldWords = EFM_EE_REC_WORDS(EFM_EE_HDR_LEN(EFM_EE_ReadWord(u32Off)));
+            if (u32OldWords == EFM_EE_REC_WORDS(u32Len))
+            {
+                u32Same = (EFM_EE_HDR_LEN(EFM_EE_ReadWord(u32Off)) == u32Len) ? 1UL : 0UL;
+                for (i = 0UL; (i < u32Len) && (u32Same != 0UL); i++)
+                {
+                    if ((i & 3UL) == 0UL)
+                    {
+                        u32Word = EFM_EE_ReadWord(u32Off + 1UL + (i / 4UL));
+                    }
+                    if (au8Data[i] != (uint8_t)(u32Word >> ((i & 3UL) * 8UL)))
+                    {
+                        u32Same = 0UL;
+                    }
+                }
+            }
+        }
+
+        /* A record which does not fit wastes the end of its sector */
+        u32RecMax = EFM_EE_REC_WORDS(u32Len);
+        if (u32RecMax < m_u32RecWordsMax)
+        {
+            u32RecMax = m_u32RecWordsMax;
+        }
+
+        if (u32Same != 0UL)
+        {
+            enRet = Ok;
+        }
+        else if (((m_u32LiveWords - u32OldWords) + EFM_EE_REC_WORDS(u32Len)) >
+                 ((m_u32SectNum - 1UL) * (EFM_EE_SECT_CAP - (u32RecMax - 1UL))))
+        {
+            enRet = ErrorBufferFull;
+        }
+        else
+        {
+            enRet = EFM_EE_Put(EFM_EE_HDR((uint32_t)u16Key, u32Len), au8Data);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Delete the value of a key.
+ * @param  [in] u16Key                  Key.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid key
+ *   @arg  ErrorUninitialized:          EFM_EE_Init() not called
+ *   @arg  Error:                       Flash program or erase error
+ */
+en_result_t EFM_EE_Delete(uint16_t u16Key)
+{
+    en_result_t enRet = ErrorUninitialized;
+
+    if (m_pu16Index == NULL)
+    {
+        /* Not initialized */
+    }
+    else if (u16Key >= m_u32KeyNum)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else if (m_pu16Index[u16Key] == EFM_EE_IDX_NONE)
+    {
+        enRet = Ok;
+    }
+    else
+    {
+        enRet = EFM_EE_Put(EFM_EE_HDR((uint32_t)u16Key, 0UL), NULL);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the length of the value of a key.
+ * @param  [in] u16Key                  Key.
+ * @retval Length in bytes, 0 if the key has no value.
+ */
+uint32_t EFM_EE_GetLen(uint16_t u16Key)
+{
+    uint32_t u32Len = 0UL;
+
+    if ((m_pu16Index != NULL) && (u16Key < m_u32KeyNum) && (m_pu16Index[u16Key] != EFM_EE_IDX_NONE))
+    {
+        u32Len = EFM_EE_HDR_LEN(EFM_EE_ReadWord(m_pu16Index[u16Key]));
+    }
+
+    return u32Len;
+}
+
+/**
+ * @brief  Compact the oldest sector now.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorUninitialized:          EFM_EE_Init() not called
+ *   @arg  ErrorBufferFull:             No sector to compact
+ *   @arg  Error:                       Flash program or erase error
+ * @note   Call it at a convenient time to move the sector erase out of a
+ *         later EFM_EE_Write().
+ */
+en_result_t EFM_EE_Compact(void)
+{
+    en_result_t enRet = ErrorUninitialized;
+
+    if (m_pu16Index != NULL)
+    {
+        if (m_u32Used < 2UL)
+        {
+            enRet = ErrorBufferFull;
+        }
+        else
+        {
+            enRet = EFM_EE_CompactHead();
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the status of the store.
+ * @param  [out] pstcStatus             Pointer to a stc_efm_ee_status_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcStatus == NULL
+ *   @arg  ErrorUninitialized:          EFM_EE_Init() not called
+ */
+en_result_t EFM_EE_GetStatus(stc_efm_ee_status_t *pstcStatus)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcStatus != NULL)
+    {
+        if (m_pu16Index == NULL)
+        {
+            enRet = ErrorUninitialized;
+        }
+        else
+        {
+            pstcStatus->u32KeyCount = m_u32KeyCount;
+            pstcStatus->u32LiveBytes = m_u32LiveWords * 4UL;
+            pstcStatus->u32FreeBytes = ((EFM_EE_SECT_WORDS - m_u32WrOff) +
+                                        ((m_u32SectNum - 1UL - m_u32Used) * EFM_EE_SECT_CAP)) * 4UL;
+            pstcStatus->u32SectorCycle = m_u32HeadSeq + m_u32Used;
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup EFM_EE_Local_Functions EFM_EE Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Erase an EFM sector and drop the cached data of the flash.
+ * @param  [in] u32Addr                 Address in the sector.
+ * @retval An en_result_t enumeration value of EFM_SectorErase().
+ */
+static en_result_t EFM_EE_EfmErase(uint32_t u32Addr)
+{
+    en_result_t enRet;
+
+    enRet = EFM_SectorErase(u32Addr);
+    EFM_CacheDataResetCmd(Enable);
+
+    return enRet;
+}
+
+/**
+ * @brief  Read a flash word.
+ * @param  [in] u32Addr                 Word address.
+ * @retval Word.
+ */
+static uint32_t EFM_EE_EfmRead(uint32_t u32Addr)
+{
+    return RW_MEM32(u32Addr);
+}
+
+/**
+ * @brief  Read a word of the area.
+ * @param  [in] u32Off                  Word offset from the start of the area.
+ * @retval Word.
+ */
+static uint32_t EFM_EE_ReadWord(uint32_t u32Off)
+{
+    return m_stcFlash.pfnRead(m_u32StartAddr + (u32Off * 4UL));
+}
+
+/**
+ * @brief  Program a word of the area.
+ * @param  [in] u32Off                  Word offset from the start of the area.
+ * @param  [in] u32Data                 Word.
+ * @retval An en_result_t enumeration value of the program function.
+ */
+static en_result_t EFM_EE_ProgWord(uint32_t u32Off, uint32_t u32Data)
+{
+    return m_stcFlash.pfnProgram(m_u32StartAddr + (u32Off * 4UL), u32Data);
+}
+
+/**
+ * @brief  Get the sector at a position of the log.
+ * @param  [in] u32Pos                  Position, 0 for the oldest sector.
+ * @retval Sector index in the area.
+ */
+static uint32_t EFM_EE_SectIdx(uint32_t u32Pos)
+{
+    return (m_u32Head + u32Pos) % m_u32SectNum;
+}
+
+/**
+ * @brief  Check a sector header.
+ * @param  [in] u32Sect                 Sector index.
+ * @param  [out] pu32Seq                Sequence number of a valid sector.
+ * @retval 1 if the sector belongs to the log, otherwise 0.
+ */
+static uint32_t EFM_EE_GetSectSeq(uint32_t u32Sect, uint32_t *pu32Seq)
+{
+    uint32_t u32Base = u32Sect * EFM_EE_SECT_WORDS;
+    uint32_t u32Valid = 0UL;
+
+    *pu32Seq = EFM_EE_ReadWord(u32Base + EFM_EE_SECT_SEQ);
+    if ((EFM_EE_ReadWord(u32Base + EFM_EE_SECT_MAGIC) == EFM_EE_MAGIC) &&
+        (EFM_EE_ReadWord(u32Base + EFM_EE_SECT_SEQ_INV) == ~(*pu32Seq)) &&
+        (EFM_EE_ReadWord(u32Base + EFM_EE_SECT_STATE) == EFM_EE_BLANK))
+    {
+        u32Valid = 1UL;
+    }
+
+    return u32Valid;
+}
+
+/**
+ * @brief  Check that words of the area are erased.
+ * @param  [in] u32Off                  First word offset.
+ * @param  [in] u32End                  Word offset after the last word.
+ * @retval 1 if all words are erased, otherwise 0.
+ */
+static uint32_t EFM_EE_IsBlank(uint32_t u32Off, uint32_t u32End)
+{
+    uint32_t u32Blank = 1UL;
+    uint32_t i;
+
+    for (i = u32Off; (i < u32End) && (u32Blank != 0UL); i++)
+    {
+        if (EFM_EE_ReadWord(i) != EFM_EE_BLANK)
+        {
+            u32Blank = 0UL;
+        }
+    }
+
+    return u32Blank;
+}
+
+/**
+ * @brief  Erase a sector unless it is erased already.
+ * @param  [in] u32Sect                 Sector index.
+ * @retval An en_result_t enumeration value of the erase function.
+ */
+static en_result_t EFM_EE_SectErase(uint32_t u32Sect)
+{
+    en_result_t enRet = Ok;
+    uint32_t u32Base = u32Sect * EFM_EE_SECT_WORDS;
+
+    if (0UL == EFM_EE_IsBlank(u32Base, u32Base + EFM_EE_SECT_WORDS))
+    {
+        enRet = m_stcFlash.pfnErase(m_u32StartAddr + (u32Base * 4UL));
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Take the sector after the newest one into the log.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  Error:                       Flash program or erase error
+ * @note   The magic is programmed last, an interrupted opening leaves a
+ *         sector which is not part of the log.
+ */
+static en_result_t EFM_EE_SectOpen(void)
+{
+    en_result_t enRet = Error;
+    uint32_t u32Base = EFM_EE_SectIdx(m_u32Used) * EFM_EE_SECT_WORDS;
+    uint32_t u32Seq = m_u32HeadSeq + m_u32Used;
+
+    if ((Ok == EFM_EE_SectErase(u32Base / EFM_EE_SECT_WORDS)) &&
+        (Ok == EFM_EE_ProgWord(u32Base + EFM_EE_SECT_SEQ, u32Seq)) &&
+        (Ok == EFM_EE_ProgWord(u32Base + EFM_EE_SECT_SEQ_INV, ~u32Seq)) &&
+        (Ok == EFM_EE_ProgWord(u32Base + EFM_EE_SECT_MAGIC, EFM_EE_MAGIC)))
+    {
+        m_u32Used++;
+        m_u32WrOff = EFM_EE_SECT_HDR_WORDS;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Update a CRC-16/CCITT with the bytes of a word, least significant first.
+ * @param  [in] u16Crc                  CRC.
+ * @param  [in] u32Word                 Word.
+ * @param  [in] u32Bytes                Number of bytes, 1 ~ 4.
+ * @retval CRC.
+ */
+static uint16_t EFM_EE_Crc(uint16_t u16Crc, uint32_t u32Word, uint32_t u32Bytes)
+{
+    uint32_t u32Crc = u16Crc;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0UL; i < u32Bytes; i++)
+    {
+        u32Crc ^= ((u32Word >> (i * 8UL)) & 0xFFUL) << 8U;
+        for (j = 0UL; j < 8UL; j++)
+        {
+            u32Crc = ((u32Crc & 0x8000UL) != 0UL) ? ((u32Crc << 1U) ^ EFM_EE_CRC_POLY) : (u32Crc << 1U);
+        }
+    }
+
+    return (uint16_t)u32Crc;
+}
+
+/**
+ * @brief  Check a record.
+ * @param  [in] u32Off                  Word offset of the record.
+ * @param  [out] pu32Words              Record length in words, for EFM_EE_REC_OK and EFM_EE_REC_CRC.
+ * @retval EFM_EE_REC_xxx.
+ */
+static uint32_t EFM_EE_RecCheck(uint32_t u32Off, uint32_t *pu32Words)
+{
+    uint32_t u32Ret = EFM_EE_REC_OK;
+    uint32_t u32End = ((u32Off / EFM_EE_SECT_WORDS) + 1UL) * EFM_EE_SECT_WORDS;
+    uint32_t u32Hdr = EFM_EE_ReadWord(u32Off);
+    uint32_t u32Len = EFM_EE_HDR_LEN(u32Hdr);
+    uint32_t u32Words = EFM_EE_REC_WORDS(u32Len);
+    uint32_t u32Crc;
+    uint16_t u16Crc;
+    uint32_t i;
+
+    if (u32Hdr == EFM_EE_BLANK)
+    {
+        u32Ret = EFM_EE_REC_BLANK;
+    }
+    else if ((u32Hdr != EFM_EE_HDR(EFM_EE_HDR_KEY(u32Hdr), u32Len)) || ((u32Off + u32Words) > u32End))
+    {
+        u32Ret = EFM_EE_REC_CORRUPT;
+    }
+    else
+    {
+        u16Crc = EFM_EE_Crc(EFM_EE_CRC_INIT, u32Hdr, 4UL);
+        for (i = 0UL; i < u32Len; i += 4UL)
+        {
+            u16Crc = EFM_EE_Crc(u16Crc, EFM_EE_ReadWord(u32Off + 1UL + (i / 4UL)),
+                                ((u32Len - i) > 4UL) ? 4UL : (u32Len - i));
+        }
+        u32Crc = EFM_EE_ReadWord(u32Off + u32Words - 1UL);
+        if (u32Crc != ((uint32_t)u16Crc | ((~(uint32_t)u16Crc) << 16U)))
+        {
+            u32Ret = EFM_EE_REC_CRC;
+        }
+        *pu32Words = u32Words;
+    }
+
+    return u32Ret;
+}
+
+/**
+ * @brief  Append a record to the newest sector, which has room for it.
+ * @param  [in] u32Hdr                  Record header.
+ * @param  [in] au8Data                 Data, NULL to copy the data of the record at u32SrcOff.
+ * @param  [in] u32SrcOff               Word offset of the copied record.
+ * @param  [out] pu32Off                Word offset of the new record.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  Error:                       Flash program error, the sector is closed
+ * @note   The header is programmed first: an interrupted append leaves a
+ *         record with a bad check byte or CRC.
+ */
+static en_result_t EFM_EE_Append(uint32_t u32Hdr, const uint8_t au8Data[], uint32_t u32SrcOff,
+                                 uint32_t *pu32Off)
+{
+    en_result_t enRet;
+    uint32_t u32Len = EFM_EE_HDR_LEN(u32Hdr);
+    uint32_t u32Off = (EFM_EE_SectIdx(m_u32Used - 1UL) * EFM_EE_SECT_WORDS) + m_u32WrOff;
+    uint32_t u32Word;
+    uint32_t u32Bytes;
+    uint16_t u16Crc;
+    uint32_t i;
+    uint32_t j;
+
+    enRet = EFM_EE_ProgWord(u32Off, u32Hdr);
+    u16Crc = EFM_EE_Crc(EFM_EE_CRC_INIT, u32Hdr, 4UL);
+    for (i = 0UL; (i < u32Len) && (enRet == Ok); i += 4UL)
+    {
+        u32Bytes = ((u32Len - i) > 4UL) ? 4UL : (u32Len - i);
+        if (au8Data == NULL)
+        {
+            u32Word = EFM_EE_ReadWord(u32SrcOff + 1UL + (i / 4UL));
+        }
+        else
+        {
+            u32Word = EFM_EE_BLANK;
+            for (j = 0UL; j < u32Bytes; j++)
+            {
+                u32Word &= ~(0xFFUL << (j * 8UL));
+                u32Word |= (uint32_t)au8Data[i + j] << (j * 8UL);
+            }
+        }
+        u16Crc = EFM_EE_Crc(u16Crc, u32Word, u32Bytes);
+        enRet = EFM_EE_ProgWord(u32Off + 1UL + (i / 4UL), u32Word);
+    }
+    if (enRet == Ok)
+    {
+        enRet = EFM_EE_ProgWord(u32Off + EFM_EE_REC_WORDS(u32Len) - 1UL,
+                                (uint32_t)u16Crc | ((~(uint32_t)u16Crc) << 16U));
+    }
+
+    if (enRet == Ok)
+    {
+        m_u32WrOff += EFM_EE_REC_WORDS(u32Len);
+        *pu32Off = u32Off;
+    }
+    else
+    {
+        m_u32WrOff = EFM_EE_SECT_WORDS;
+        enRet = Error;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Make room for a record in the newest sector.
+ * @param  [in] u32Words                Record length in words.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorBufferFull:             A turn of compactions freed no room
+ *   @arg  Error:                       Flash program or erase error
+ * @note   One turn compacts every sector of the log, after it the records are
+ *         packed and a further turn would only wear the flash.
+ */
+static en_result_t EFM_EE_Reserve(uint32_t u32Words)
+{
+    en_result_t enRet = ErrorBufferFull;
+    uint32_t u32CompactLeft = m_u32SectNum - 1UL;
+    uint32_t u32Stop = 0UL;
+
+    while ((enRet == ErrorBufferFull) && (u32Stop == 0UL))
+    {
+        if ((m_u32Used != 0UL) && ((m_u32WrOff + u32Words) <= EFM_EE_SECT_WORDS))
+        {
+            enRet = Ok;
+        }
+        else if ((m_u32Used + 1UL) < m_u32SectNum)
+        {
+            if (Ok != EFM_EE_SectOpen())
+            {
+                enRet = Error;
+            }
+        }
+        else if (u32CompactLeft != 0UL)
+        {
+            u32CompactLeft--;
+            if (Ok != EFM_EE_CompactHead())
+            {
+                enRet = Error;
+            }
+        }
+        else
+        {
+            u32Stop = 1UL;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Write a record and update the index.
+ * @param  [in] u32Hdr                  Record header.
+ * @param  [in] au8Data                 Data, NULL for a deletion.
+ * @retval An en_result_t enumeration value of EFM_EE_Reserve() or EFM_EE_Append().
+ * @note   A program error closes the sector, the record is written again once
+ *         in the next one.
+ */
+static en_result_t EFM_EE_Put(uint32_t u32Hdr, const uint8_t au8Data[])
+{
+    en_result_t enRet = Error;
+    uint32_t u32Words = EFM_EE_REC_WORDS(EFM_EE_HDR_LEN(u32Hdr));
+    uint32_t u32Off = 0UL;
+    uint32_t u32Try;
+
+    for (u32Try = 0UL; (u32Try < 2UL) && (enRet == Error); u32Try++)
+    {
+        enRet = EFM_EE_Reserve(u32Words);
+        if (enRet == Ok)
+        {
+            enRet = EFM_EE_Append(u32Hdr, au8Data, 0UL, &u32Off);
+        }
+    }
+    if (enRet == Ok)
+    {
+        EFM_EE_Apply(u32Hdr, u32Off);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Copy the current records of the oldest sector, then release and
+ *         erase it.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  Error:                       Flash program or erase error, or no room
+ * @note   Copies are appended after the original records, so an
+ *         interrupted compaction keeps the newest values.
+ */
+static en_result_t EFM_EE_CompactHead(void)
+{
+    en_result_t enRet = Ok;
+    uint32_t u32Base = m_u32Head * EFM_EE_SECT_WORDS;
+    uint32_t u32Off = u32Base + EFM_EE_SECT_HDR_WORDS;
+    uint32_t u32NewOff = 0UL;
+    uint32_t u32Words = 0UL;
+    uint32_t u32Check = EFM_EE_REC_OK;
+    uint32_t u32Hdr;
+    uint32_t u32Key;
+
+    /* The copies must not go to the sector being erased */
+    if (m_u32Used == 1UL)
+    {
+        enRet = EFM_EE_SectOpen();
+    }
+
+    while ((enRet == Ok) && (u32Off < (u32Base + EFM_EE_SECT_WORDS)) &&
+           ((u32Check == EFM_EE_REC_OK) || (u32Check == EFM_EE_REC_CRC)))
+    {
+        u32Check = EFM_EE_RecCheck(u32Off, &u32Words);
+        if (u32Check == EFM_EE_REC_OK)
+        {
+            u32Hdr = EFM_EE_ReadWord(u32Off);
+            u32Key = EFM_EE_HDR_KEY(u32Hdr);
+            if ((u32Key < m_u32KeyNum) && (m_pu16Index[u32Key] == u32Off) && (EFM_EE_HDR_LEN(u32Hdr) != 0UL))
+            {
+                if ((m_u32WrOff + u32Words) > EFM_EE_SECT_WORDS)
+                {
+                    enRet = (m_u32Used < m_u32SectNum) ? EFM_EE_SectOpen() : Error;
+                }
+                if (enRet == Ok)
+                {
+                    enRet = EFM_EE_Append(u32Hdr, NULL, u32Off, &u32NewOff);
+                }
+                if (enRet == Ok)
+                {
+                    m_pu16Index[u32Key] = (uint16_t)u32NewOff;
+                }
+            }
+        }
+        if ((u32Check == EFM_EE_REC_OK) || (u32Check == EFM_EE_REC_CRC))
+        {
+            u32Off += u32Words;
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        /* A released sector is out of the log even if the erase is interrupted */
+        (void)EFM_EE_ProgWord(u32Base + EFM_EE_SECT_STATE, EFM_EE_STATE_RELEASED);
+        enRet = m_stcFlash.pfnErase(m_u32StartAddr + (u32Base * 4UL));
+        m_u32Head = (m_u32Head + 1UL) % m_u32SectNum;
+        m_u32HeadSeq++;
+        m_u32Used--;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Update the index and the statistics with a new record.
+ * @param  [in] u32Hdr                  Record header.
+ * @param  [in] u32Off                  Word offset of the record.
+ * @retval None
+ */
+static void EFM_EE_Apply(uint32_t u32Hdr, uint32_t u32Off)
+{
+    uint32_t u32Key = EFM_EE_HDR_KEY(u32Hdr);
+    uint32_t u32Len = EFM_EE_HDR_LEN(u32Hdr);
+
+    if (u32Key < m_u32KeyNum)
+    {
+        if (m_pu16Index[u32Key] != EFM_EE_IDX_NONE)
+        {
+            m_u32LiveWords -= EFM_EE_REC_WORDS(EFM_EE_HDR_LEN(EFM_EE_ReadWord(m_pu16Index[u32Key])));
+            m_u32KeyCount--;
+        }
+        if (u32Len != 0UL)
+        {
+            m_pu16Index[u32Key] = (uint16_t)u32Off;
+            m_u32LiveWords += EFM_EE_REC_WORDS(u32Len);
+            m_u32KeyCount++;
+            if (m_u32RecWordsMax < EFM_EE_REC_WORDS(u32Len))
+            {
+                m_u32RecWordsMax = EFM_EE_REC_WORDS(u32Len);
+            }
+        }
+        else
+        {
+            m_pu16Index[u32Key] = EFM_EE_IDX_NONE;
+        }
+    }
+}
+
+/**
+ * @brief  Build the index from the records of the log.
+ * @param  None
+ * @retval None
+ * @note   Sets the write offset of the newest sector.
+ */
+static void EFM_EE_Replay(void)
+{
+    uint32_t u32Sect;
+    uint32_t u32Off;
+    uint32_t u32End;
+    uint32_t u32Words = 0UL;
+    uint32_t u32Check;
+    uint32_t i;
+
+    for (i = 0UL; i < m_u32KeyNum; i++)
+    {
+        m_pu16Index[i] = EFM_EE_IDX_NONE;
+    }
+    m_u32LiveWords = 0UL;
+    m_u32KeyCount = 0UL;
+    m_u32RecWordsMax = 0UL;
+
+    /* From the oldest to the newest record */
+    for (i = 0UL; i < m_u32Used; i++)
+    {
+        u32Sect = EFM_EE_SectIdx(i);
+        u32Off = (u32Sect * EFM_EE_SECT_WORDS) + EFM_EE_SECT_HDR_WORDS;
+        u32End = (u32Sect + 1UL) * EFM_EE_SECT_WORDS;
+        u32Check = EFM_EE_REC_OK;
+        while ((u32Off < u32End) && ((u32Check == EFM_EE_REC_OK) || (u32Check == EFM_EE_REC_CRC)))
+        {
+            u32Check = EFM_EE_RecCheck(u32Off, &u32Words);
+            if (u32Check == EFM_EE_REC_OK)
+            {
+                EFM_EE_Apply(EFM_EE_ReadWord(u32Off), u32Off);
+            }
+            if ((u32Check == EFM_EE_REC_OK) || (u32Check == EFM_EE_REC_CRC))
+            {
+                u32Off += u32Words;
+            }
+        }
+        /* Free space must be erased, a partial program closes the sector */
+        if ((u32Check == EFM_EE_REC_CORRUPT) ||
+            ((u32Check == EFM_EE_REC_BLANK) && (0UL == EFM_EE_IsBlank(u32Off, u32End))))
+        {
+            u32Off = u32End;
+        }
+        m_u32WrOff = u32Off - (u32Sect * EFM_EE_SECT_WORDS);
+    }
+}
+
+/**
+ * @brief  Find the log in the area and build the index.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  Error:                       Flash program or erase error
+ * @note   All sectors are in the log only after an interrupted compaction.
+ *         The sector it opened holds nothing but copies of the oldest one.
+ */
+static en_result_t EFM_EE_Mount(void)
+{
+    en_result_t enRet = Ok;
+    uint32_t u32Seq;
+    uint32_t u32PrevSeq;
+    uint32_t u32MinSeq = 0UL;
+    uint32_t u32Found = 0UL;
+    uint32_t u32HeadLive = 0UL;
+    uint32_t i;
+
+    /* The oldest sector is a valid one which does not follow its predecessor */
+    for (i = 0UL; i < m_u32SectNum; i++)
+    {
+        if ((0UL != EFM_EE_GetSectSeq(i, &u32Seq)) &&
+            ((0UL == EFM_EE_GetSectSeq((i + m_u32SectNum - 1UL) % m_u32SectNum, &u32PrevSeq)) ||
+             ((u32PrevSeq + 1UL) != u32Seq)) &&
+            ((u32Found == 0UL) || (u32Seq < u32MinSeq)))
+        {
+            u32Found = 1UL;
+            u32MinSeq = u32Seq;
+            m_u32Head = i;
+        }
+    }
+
+    if (u32Found == 0UL)
+    {
+        enRet = EFM_EE_Format();
+    }
+    else
+    {
+        m_u32HeadSeq = u32MinSeq;
+        m_u32Used = 1UL;
+        while ((m_u32Used < m_u32SectNum) &&
+               (0UL != EFM_EE_GetSectSeq(EFM_EE_SectIdx(m_u32Used), &u32Seq)) &&
+               (u32Seq == (m_u32HeadSeq + m_u32Used)))
+        {
+            m_u32Used++;
+        }
+
+        EFM_EE_Replay();
+
+        if (m_u32Used == m_u32SectNum)
+        {
+            for (i = 0UL; i < m_u32KeyNum; i++)
+            {
+                if ((m_pu16Index[i] != EFM_EE_IDX_NONE) &&
+                    ((m_pu16Index[i] / EFM_EE_SECT_WORDS) == m_u32Head))
+                {
+                    u32HeadLive = 1UL;
+                }
+            }
+
+            if (u32HeadLive != 0UL)
+            {
+                /* Copying was cut and the oldest sector is intact: drop the
+                   copies, the newest sector may be closed with no room left */
+                m_u32Used--;
+                enRet = m_stcFlash.pfnErase(m_u32StartAddr +
+                                            (EFM_EE_SectIdx(m_u32Used) * EFM_EE_SECTOR_SIZE));
+                EFM_EE_Replay();
+            }
+            else
+            {
+                /* Everything was copied: release the oldest sector */
+                enRet = EFM_EE_CompactHead();
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_EFM_EE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
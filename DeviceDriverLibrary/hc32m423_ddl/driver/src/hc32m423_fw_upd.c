@@ -0,0 +1,1131 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_fw_upd.c
+ * @brief This file provides firmware functions for the A/B firmware update
+ *        manager.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_fw_upd.h"
+#include "hc32m423_crc.h"
+#include "hc32m423_efm.h"
+#include "hc32m423_efm_async.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_FW_UPD FW_UPD
+ * @brief A/B Firmware Update Manager Driver Library
+ * @details The flash holds a bootloader, two sectors of boot records and two
+ *          image slots. The application receives a new image into the slot
+ *          that is not confirmed and the bootloader tries it once:
+ *          - FW_UPD_Begin(), FW_UPD_Write() and FW_UPD_Finish() stream the
+ *            image into the inactive slot. Each full chunk is erased and
+ *            programmed by an EFM_ASYNC job while the next chunk is received
+ *            into the other buffer, then checked with CRC_Calculate()
+ *            against the RAM copy. FW_UPD_Finish() checks the CRC32 of the
+ *            whole image and appends a trial record.
+ *          - FW_UPD_BootSelect() in the bootloader appends an attempt record
+ *            and selects the trial slot. If the trial image is booted again
+ *            without FW_UPD_Confirm(), or its CRC32 fails, a revert record
+ *            is appended and the confirmed slot is selected.
+ *          - FW_UPD_Confirm() in the new image appends a confirm record once
+ *            its self test passes.
+ *          A record is 5 words and its last word is the CRC32 of the others,
+ *          so a record torn by a reset is ignored. Records are appended to
+ *          one sector; when it is full, the state is copied to the other
+ *          sector first. The image CRC32 is CRC_Calculate(CRC_CRC32, image,
+ *          0xFFFFFFFF, words, CRC_DATA_WIDTH_32BIT) over the image padded
+ *          with 0xFF to a word.
+ *          Requires DDL_CRC_ENABLE and DDL_EFM_ASYNC_ENABLE. Call
+ *          EFM_Unlock() before use, and EFM_ASYNC_Init() before an update.
+ *          During an update the CRC unit is used from the EFM interrupt, and
+ *          to receive during a flash job the receive interrupt handler and
+ *          the vector table must be in RAM, see DDL_EFM_ASYNC and
+ *          DDL_RAMFUNC.
+ * @{
+ */
+
+#if (DDL_FW_UPD_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup FW_UPD_Local_Macros FW_UPD Local Macros
+ * @{
+ */
+/* Boot record: type and slot, sequence, image size, image CRC32, record CRC32 */
+#define FW_UPD_REC_WORDS                (5UL)
+#define FW_UPD_REC_SIZE                 (FW_UPD_REC_WORDS * 4UL)
+#define FW_UPD_REC_MAGIC                (0xB5A00000UL)
+#define FW_UPD_REC_MAGIC_MASK           (0xFFFF0000UL)
+#define FW_UPD_REC_WORD0(type, slot)    (FW_UPD_REC_MAGIC | ((type) << 8U) | (slot))
+
+/* Boot record type */
+#define FW_UPD_REC_TRIAL                (1UL)   /* New image to try once */
+#define FW_UPD_REC_ATTEMPT              (2UL)   /* Trial image booted */
+#define FW_UPD_REC_CONFIRM              (3UL)   /* Image accepted */
+#define FW_UPD_REC_REVERT               (4UL)   /* Trial image dropped */
+#define FW_UPD_REC_TRIAL_BOOTED         (5UL)   /* Copied state: trial image already booted */
+
+/* Chunk buffer state */
+#define FW_UPD_BUF_NUM                  (2UL)
+#define FW_UPD_BUF_NONE                 (0xFFUL)
+#define FW_UPD_BUF_FREE                 (0UL)
+#define FW_UPD_BUF_FILL                 (1UL)
+#define FW_UPD_BUF_QUEUED               (2UL)
+#define FW_UPD_BUF_BUSY                 (3UL)
+
+#define FW_UPD_CRC_INIT                 (0xFFFFFFFFUL)
+#define FW_UPD_BLANK                    (0xFFFFFFFFUL)
+
+/* Initial stack pointer range of an image */
+#define FW_UPD_RAM_START                (0x1FFFE000UL)
+#define FW_UPD_RAM_END                  (0x20002000UL)
+#define FW_UPD_NVIC_REG_NUM             (4UL)
+
+/**
+ * @defgroup FW_UPD_Check_Parameters_Validity FW_UPD Check Parameters Validity
+ * @{
+ */
+#define IS_FW_UPD_SECTOR_ALIGN(x)       (((x) & (FW_UPD_SECTOR_SIZE - 1UL)) == 0UL)
+
+#define IS_FW_UPD_AREA(addr, size)                                             \
+(   IS_FW_UPD_SECTOR_ALIGN(addr)                &&                             \
+    IS_FW_UPD_SECTOR_ALIGN(size)                &&                             \
+    ((size) != 0UL)                             &&                             \
+    ((addr) <= (EFM_END_ADDR + 1UL - (size))))
+
+#define IS_FW_UPD_DISJOINT(a, asize, b, bsize)                                 \
+(   (((a) + (asize)) <= (b))                    ||                             \
+    (((b) + (bsize)) <= (a)))
+
+#define IS_FW_UPD_SLOT(x)               ((x) <= FW_UPD_SLOT_B)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup FW_UPD_Local_Functions
+ * @{
+ */
+static uint32_t FW_UPD_Crc(uint32_t u32Addr, uint32_t u32Size);
+static en_flag_status_t FW_UPD_SlotValid(uint32_t u32Slot, uint32_t u32Size, uint32_t u32Crc);
+static en_flag_status_t FW_UPD_RecordValid(uint32_t u32Addr);
+static void FW_UPD_Apply(const uint32_t au32Rec[]);
+static void FW_UPD_Mount(void);
+static en_result_t FW_UPD_PutRecord(uint32_t u32Type, uint32_t u32Slot, uint32_t u32Size, uint32_t u32Crc);
+static en_result_t FW_UPD_Append(uint32_t u32Type, uint32_t u32Slot, uint32_t u32Size, uint32_t u32Crc);
+static void FW_UPD_Kick(void);
+static void FW_UPD_ChunkDone(en_result_t enResult);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup FW_UPD_Local_Variables FW_UPD Local Variables
+ * @{
+ */
+static stc_fw_upd_init_t m_stcLayout;
+static uint32_t m_u32Init = 0UL;
+
+/* Boot state replayed from the records */
+static uint32_t m_u32ConfSlot = FW_UPD_SLOT_NONE;
+static uint32_t m_u32ConfSize = 0UL;
+static uint32_t m_u32ConfCrc = 0UL;
+static uint32_t m_u32TrialSlot = FW_UPD_SLOT_NONE;
+static uint32_t m_u32TrialSize = 0UL;
+static uint32_t m_u32TrialCrc = 0UL;
+static uint32_t m_u32TrialBooted = 0UL;
+static uint32_t m_u32Seq = 0UL;
+static uint32_t m_u32MetaSector = 0UL;  /* Sector the records are appended to */
+static uint32_t m_u32MetaPos = 0UL;     /* Offset of the next record in the sector */
+
+/* Update stream */
+static uint32_t m_au32Buf[FW_UPD_BUF_NUM][FW_UPD_CHUNK_SIZE / 4UL];
+static uint32_t m_au32BufAddr[FW_UPD_BUF_NUM];
+static volatile uint32_t m_au32BufState[FW_UPD_BUF_NUM];
+static volatile uint32_t m_u32BusyBuf = FW_UPD_BUF_NONE;
+static uint32_t m_u32FillBuf = FW_UPD_BUF_NONE;
+static uint32_t m_u32FillPos = 0UL;
+static uint32_t m_u32UpdSlot = FW_UPD_SLOT_NONE;
+static uint32_t m_u32UpdSize = 0UL;
+static uint32_t m_u32Received = 0UL;
+static volatile uint32_t m_u32Aborting = 0UL;
+static volatile en_result_t m_enUpdResult = Ok;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup FW_UPD_Global_Functions FW_UPD Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_fw_upd_init_t variable with the default layout.
+ * @param  [out] pstcInit               Pointer to a stc_fw_upd_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t FW_UPD_StructInit(stc_fw_upd_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32MetaAddr = FW_UPD_DEFAULT_META_ADDR;
+        pstcInit->au32SlotAddr[FW_UPD_SLOT_A] = FW_UPD_DEFAULT_SLOT_A_ADDR;
+        pstcInit->au32SlotAddr[FW_UPD_SLOT_B] = FW_UPD_DEFAULT_SLOT_B_ADDR;
+        pstcInit->u32SlotSize = FW_UPD_DEFAULT_SLOT_SIZE;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the flash layout and read the boot records.
+ * @param  [in] pstcInit                Pointer to a stc_fw_upd_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL or invalid layout
+ *   @arg  ErrorOperationInProgress:    An update is running
+ */
+en_result_t FW_UPD_Init(const stc_fw_upd_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    const uint32_t u32MetaSize = 2UL * FW_UPD_SECTOR_SIZE;
+    uint32_t i;
+
+    if (m_u32UpdSlot != FW_UPD_SLOT_NONE)
+    {
+        enRet = ErrorOperationInProgress;
+    }
+    else if ((pstcInit != NULL) &&
+             IS_FW_UPD_AREA(pstcInit->u32MetaAddr, u32MetaSize) &&
+             IS_FW_UPD_AREA(pstcInit->au32SlotAddr[FW_UPD_SLOT_A], pstcInit->u32SlotSize) &&
+             IS_FW_UPD_AREA(pstcInit->au32SlotAddr[FW_UPD_SLOT_B], pstcInit->u32SlotSize) &&
+             IS_FW_UPD_DISJOINT(pstcInit->u32MetaAddr, u32MetaSize,
+                                pstcInit->au32SlotAddr[FW_UPD_SLOT_A], pstcInit->u32SlotSize) &&
+             IS_FW_UPD_DISJOINT(pstcInit->u32MetaAddr, u32MetaSize,
+                                pstcInit->au32SlotAddr[FW_UPD_SLOT_B], pstcInit->u32SlotSize) &&
+             IS_FW_UPD_DISJOINT(pstcInit->au32SlotAddr[FW_UPD_SLOT_A], pstcInit->u32SlotSize,
+                                pstcInit->au32SlotAddr[FW_UPD_SLOT_B], pstcInit->u32SlotSize))
+    {
+        m_stcLayout = *pstcInit;
+        for (i = 0UL; i < FW_UPD_BUF_NUM; i++)
+        {
+            m_au32BufState[i] = FW_UPD_BUF_FREE;
+        }
+        m_u32BusyBuf = FW_UPD_BUF_NONE;
+        m_u32FillBuf = FW_UPD_BUF_NONE;
+        FW_UPD_Mount();
+        m_u32Init = 1UL;
+        enRet = Ok;
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Select the slot to boot, called by the bootloader once per reset.
+ * @param  [out] pu32Slot               Slot to boot, @ref FW_UPD_Slot.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          A slot is selected
+ *   @arg  ErrorInvalidParameter:       pu32Slot == NULL
+ *   @arg  ErrorUninitialized:          FW_UPD_Init() has not been called
+ *   @arg  Error:                       The confirmed image fails its CRC32,
+ *                                      *pu32Slot is FW_UPD_SLOT_NONE
+ * @note   A trial image that has not been booted is selected once. Before
+ *         the first confirmed update, slot A holds the factory image and is
+ *         selected without a check.
+ */
+en_result_t FW_UPD_BootSelect(uint32_t *pu32Slot)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Slot = FW_UPD_SLOT_NONE;
+
+    if (m_u32Init == 0UL)
+    {
+        enRet = ErrorUninitialized;
+    }
+    else if (pu32Slot != NULL)
+    {
+        enRet = Ok;
+        if (m_u32TrialSlot != FW_UPD_SLOT_NONE)
+        {
+            if ((m_u32TrialBooted == 0UL) &&
+                (Set == FW_UPD_SlotValid(m_u32TrialSlot, m_u32TrialSize, m_u32TrialCrc)))
+            {
+                /* Without the attempt record there is no roll back, keep the confirmed image */
+                if (Ok == FW_UPD_Append(FW_UPD_REC_ATTEMPT, m_u32TrialSlot, m_u32TrialSize, m_u32TrialCrc))
+                {
+                    u32Slot = m_u32TrialSlot;
+                }
+            }
+            else
+            {
+                /* Booted without confirmation or corrupted, retried on the next reset if not written */
+                (void)FW_UPD_Append(FW_UPD_REC_REVERT, m_u32TrialSlot, 0UL, 0UL);
+            }
+        }
+
+        if (u32Slot == FW_UPD_SLOT_NONE)
+        {
+            if (m_u32ConfSlot == FW_UPD_SLOT_NONE)
+            {
+                u32Slot = FW_UPD_SLOT_A;
+            }
+            else if (Set == FW_UPD_SlotValid(m_u32ConfSlot, m_u32ConfSize, m_u32ConfCrc))
+            {
+                u32Slot = m_u32ConfSlot;
+            }
+            else
+            {
+                enRet = Error;
+            }
+        }
+        *pu32Slot = u32Slot;
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start the image of a slot.
+ * @param  [in] u32Slot                 Slot to start, @ref FW_UPD_Slot.
+ * @retval An en_result_t enumeration value:
+ *   @arg  ErrorInvalidParameter:       Invalid slot, or the slot holds no vector table
+ *   @arg  ErrorUninitialized:          FW_UPD_Init() has not been called
+ * @note   Does not return on success. All interrupts are disabled in the
+ *         NVIC, SysTick is stopped, and VTOR and MSP are set from the slot.
+ */
+en_result_t FW_UPD_Jump(uint32_t u32Slot)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Addr;
+    uint32_t u32Sp;
+    uint32_t u32Pc;
+    uint32_t i;
+    func_ptr_t pfnReset;
+
+    if (m_u32Init == 0UL)
+    {
+        enRet = ErrorUninitialized;
+    }
+    else if (IS_FW_UPD_SLOT(u32Slot))
+    {
+        u32Addr = m_stcLayout.au32SlotAddr[u32Slot];
+        u32Sp = RW_MEM32(u32Addr);
+        u32Pc = RW_MEM32(u32Addr + 4UL);
+        if ((u32Sp > FW_UPD_RAM_START) && (u32Sp <= FW_UPD_RAM_END) &&
+            ((u32Pc & 1UL) != 0UL) && (u32Pc > u32Addr) &&
+            (u32Pc < (u32Addr + m_stcLayout.u32SlotSize)))
+        {
+            __disable_irq();
+            SysTick->CTRL = 0UL;
+            for (i = 0UL; i < FW_UPD_NVIC_REG_NUM; i++)
+            {
+                NVIC->ICER[i] = 0xFFFFFFFFUL;
+                NVIC->ICPR[i] = 0xFFFFFFFFUL;
+            }
+            WRITE_REG32(SCB->VTOR, u32Addr);
+            __DSB();
+            __ISB();
+            __set_MSP(u32Sp);
+            __enable_irq();
+            pfnReset = (func_ptr_t)u32Pc;
+            pfnReset();
+        }
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Accept the trial image, called by the new image after its self test.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          Confirmed, or no trial image
+ *   @arg  ErrorUninitialized:          FW_UPD_Init() has not been called
+ *   @arg  ErrorInvalidMode:            The trial image has not been booted
+ *   @arg  ErrorOperationInProgress:    A flash job is running
+ *   @arg  Error:                       Flash error
+ */
+en_result_t FW_UPD_Confirm(void)
+{
+    en_result_t enRet = Ok;
+
+    if (m_u32Init == 0UL)
+    {
+        enRet = ErrorUninitialized;
+    }
+    else if (m_u32TrialSlot != FW_UPD_SLOT_NONE)
+    {
+        if (m_u32TrialBooted == 0UL)
+        {
+            enRet = ErrorInvalidMode;
+        }
+        else
+        {
+            enRet = FW_UPD_Append(FW_UPD_REC_CONFIRM, m_u32TrialSlot, m_u32TrialSize, m_u32TrialCrc);
+        }
+    }
+    else
+    {
+        /* Nothing to confirm */
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start receiving an image into the slot that is not confirmed.
+ * @param  [in] u32ImageSize            Image size in bytes, 1 ~ slot size.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid size
+ *   @arg  ErrorUninitialized:          FW_UPD_Init() has not been called
+ *   @arg  ErrorOperationInProgress:    An update or a flash job is running
+ *   @arg  ErrorInvalidMode:            The running trial image is not confirmed
+ *   @arg  Error:                       Flash error
+ * @note   A trial image that has not been booted is dropped.
+ */
+en_result_t FW_UPD_Begin(uint32_t u32ImageSize)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t i;
+
+    if (m_u32Init == 0UL)
+    {
+        enRet = ErrorUninitialized;
+    }
+    else if (m_u32UpdSlot != FW_UPD_SLOT_NONE)
+    {
+        enRet = ErrorOperationInProgress;
+    }
+    else if (m_u32TrialBooted != 0UL)
+    {
+        enRet = ErrorInvalidMode;
+    }
+    else if ((u32ImageSize != 0UL) && (u32ImageSize <= m_stcLayout.u32SlotSize))
+    {
+        enRet = Ok;
+        if (m_u32TrialSlot != FW_UPD_SLOT_NONE)
+        {
+            /* The slot is overwritten, so it must not be booted any more */
+            enRet = FW_UPD_Append(FW_UPD_REC_REVERT, m_u32TrialSlot, 0UL, 0UL);
+        }
+
+        if (enRet == Ok)
+        {
+            for (i = 0UL; i < FW_UPD_BUF_NUM; i++)
+            {
+                m_au32BufState[i] = FW_UPD_BUF_FREE;
+            }
+            m_u32BusyBuf = FW_UPD_BUF_NONE;
+            m_u32FillBuf = FW_UPD_BUF_NONE;
+            m_u32Received = 0UL;
+            m_u32UpdSize = u32ImageSize;
+            m_u32Aborting = 0UL;
+            m_enUpdResult = Ok;
+            /* Slot A holds the factory image before the first confirmed update */
+            m_u32UpdSlot = (m_u32ConfSlot == FW_UPD_SLOT_B) ? FW_UPD_SLOT_A : FW_UPD_SLOT_B;
+        }
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Write received image bytes.
+ * @param  [in] au8Data                 Received bytes.
+ * @param  [in] u32Len                  Number of bytes, up to FW_UPD_GetWriteSpace().
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          The bytes are buffered
+ *   @arg  ErrorInvalidParameter:       au8Data == NULL, u32Len == 0 or more bytes than the image
+ *   @arg  ErrorInvalidMode:            No update is running
+ *   @arg  ErrorBufferFull:             Not enough buffer space, nothing is written
+ *   @arg  Error:                       A chunk failed to program or to verify
+ * @note   Each full chunk is programmed in the background while the next
+ *         one is buffered, so u32Len can be as large as the chunk size
+ *         without waiting for the flash.
+ */
+en_result_t FW_UPD_Write(const uint8_t au8Data[], uint32_t u32Len)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint8_t *pu8Buf;
+    uint32_t u32Pos = 0UL;
+    uint32_t u32Num;
+    uint32_t i;
+
+    if (m_u32UpdSlot == FW_UPD_SLOT_NONE)
+    {
+        enRet = ErrorInvalidMode;
+    }
+    else if (m_enUpdResult != Ok)
+    {
+        enRet = m_enUpdResult;
+    }
+    else if ((au8Data != NULL) && (u32Len != 0UL) && (u32Len <= (m_u32UpdSize - m_u32Received)))
+    {
+        if (u32Len > FW_UPD_GetWriteSpace())
+        {
+            enRet = ErrorBufferFull;
+        }
+        else
+        {
+            while (u32Pos < u32Len)
+            {
+                if (m_u32FillBuf == FW_UPD_BUF_NONE)
+                {
+                    for (i = 0UL; i < FW_UPD_BUF_NUM; i++)
+                    {
+                        if (m_au32BufState[i] == FW_UPD_BUF_FREE)
+                        {
+                            break;
+                        }
+                    }
+                    m_au32BufState[i] = FW_UPD_BUF_FILL;
+                    m_au32BufAddr[i] = m_stcLayout.au32SlotAddr[m_u32UpdSlot] + m_u32Received;
+                    m_u32FillBuf = i;
+                    m_u32FillPos = 0UL;
+                }
+
+                u32Num = FW_UPD_CHUNK_SIZE - m_u32FillPos;
+                if (u32Num > (u32Len - u32Pos))
+                {
+                    u32Num = u32Len - u32Pos;
+                }
+                pu8Buf = (uint8_t *)&m_au32Buf[m_u32FillBuf][0U];
+                for (i = 0UL; i < u32Num; i++)
+                {
+                    pu8Buf[m_u32FillPos + i] = au8Data[u32Pos + i];
+                }
+                m_u32FillPos += u32Num;
+                m_u32Received += u32Num;
+                u32Pos += u32Num;
+
+                if (m_u32FillPos == FW_UPD_CHUNK_SIZE)
+                {
+                    m_au32BufState[m_u32FillBuf] = FW_UPD_BUF_QUEUED;
+                    m_u32FillBuf = FW_UPD_BUF_NONE;
+                    FW_UPD_Kick();
+                }
+            }
+            enRet = Ok;
+        }
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the number of bytes FW_UPD_Write() accepts now.
+ * @param  None
+ * @retval Free buffer space, limited to the rest of the image, 0 if no
+ *         update is running.
+ */
+uint32_t FW_UPD_GetWriteSpace(void)
+{
+    uint32_t u32Space = 0UL;
+    uint32_t i;
+
+    if (m_u32UpdSlot != FW_UPD_SLOT_NONE)
+    {
+        for (i = 0UL; i < FW_UPD_BUF_NUM; i++)
+        {
+            if (m_au32BufState[i] == FW_UPD_BUF_FREE)
+            {
+                u32Space += FW_UPD_CHUNK_SIZE;
+            }
+            else if (m_au32BufState[i] == FW_UPD_BUF_FILL)
+            {
+                u32Space += FW_UPD_CHUNK_SIZE - m_u32FillPos;
+            }
+            else
+            {
+                /* Queued or programming */
+            }
+        }
+        if (u32Space > (m_u32UpdSize - m_u32Received))
+        {
+            u32Space = m_u32UpdSize - m_u32Received;
+        }
+    }
+
+    return u32Space;
+}
+
+/**
+ * @brief  Program the last chunk, check the image and mark it for trial.
+ * @param  [in] u32ImageCrc             CRC32 of the image, see DDL_FW_UPD.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          The image boots on the next reset
+ *   @arg  ErrorInvalidParameter:       Not all bytes of the image were written,
+ *                                      the update keeps running
+ *   @arg  ErrorInvalidMode:            No update is running
+ *   @arg  Error:                       Flash error or CRC32 mismatch
+ *   @arg  ErrorOperationInProgress:    A flash job of another user is running
+ * @note   Waits for the flash jobs. The update ends unless the image is
+ *         incomplete.
+ */
+en_result_t FW_UPD_Finish(uint32_t u32ImageCrc)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint8_t *pu8Buf;
+    uint32_t u32Slot;
+    uint32_t i;
+
+    if (m_u32UpdSlot == FW_UPD_SLOT_NONE)
+    {
+        enRet = ErrorInvalidMode;
+    }
+    else if (m_u32Received == m_u32UpdSize)
+    {
+        if (m_u32FillBuf != FW_UPD_BUF_NONE)
+        {
+            pu8Buf = (uint8_t *)&m_au32Buf[m_u32FillBuf][0U];
+            for (i = m_u32FillPos; i < FW_UPD_CHUNK_SIZE; i++)
+            {
+                pu8Buf[i] = 0xFFU;
+            }
+            m_au32BufState[m_u32FillBuf] = FW_UPD_BUF_QUEUED;
+            m_u32FillBuf = FW_UPD_BUF_NONE;
+            FW_UPD_Kick();
+        }
+        for (i = 0UL; i < FW_UPD_BUF_NUM; i++)
+        {
+            while (m_au32BufState[i] != FW_UPD_BUF_FREE)
+            {
+                ;
+            }
+        }
+
+        u32Slot = m_u32UpdSlot;
+        m_u32UpdSlot = FW_UPD_SLOT_NONE;
+        enRet = m_enUpdResult;
+        if (enRet == Ok)
+        {
+            if (u32ImageCrc != FW_UPD_Crc(m_stcLayout.au32SlotAddr[u32Slot], m_u32UpdSize))
+            {
+                enRet = Error;
+            }
+            else
+            {
+                enRet = FW_UPD_Append(FW_UPD_REC_TRIAL, u32Slot, m_u32UpdSize, u32ImageCrc);
+            }
+        }
+    }
+    else
+    {
+        /* Image incomplete */
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the update after the running chunk.
+ * @param  None
+ * @retval None
+ * @note   The partly written slot is not referenced by any record.
+ */
+void FW_UPD_Abort(void)
+{
+    uint32_t i;
+
+    if (m_u32UpdSlot != FW_UPD_SLOT_NONE)
+    {
+        m_u32Aborting = 1UL;
+        if (m_u32BusyBuf != FW_UPD_BUF_NONE)
+        {
+            EFM_ASYNC_Abort();
+        }
+        while (m_u32BusyBuf != FW_UPD_BUF_NONE)
+        {
+            ;
+        }
+        for (i = 0UL; i < FW_UPD_BUF_NUM; i++)
+        {
+            m_au32BufState[i] = FW_UPD_BUF_FREE;
+        }
+        m_u32FillBuf = FW_UPD_BUF_NONE;
+        m_u32UpdSlot = FW_UPD_SLOT_NONE;
+    }
+}
+
+/**
+ * @brief  Get the boot and update state.
+ * @param  [out] pstcStatus             Pointer to a stc_fw_upd_status_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcStatus == NULL
+ *   @arg  ErrorUninitialized:          FW_UPD_Init() has not been called
+ */
+en_result_t FW_UPD_GetStatus(stc_fw_upd_status_t *pstcStatus)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (m_u32Init == 0UL)
+    {
+        enRet = ErrorUninitialized;
+    }
+    else if (pstcStatus != NULL)
+    {
+        pstcStatus->u32ConfirmedSlot = m_u32ConfSlot;
+        pstcStatus->u32TrialSlot = m_u32TrialSlot;
+        pstcStatus->u32TrialBooted = m_u32TrialBooted;
+        pstcStatus->u32UpdateSlot = m_u32UpdSlot;
+        pstcStatus->u32ImageSize = m_u32UpdSize;
+        pstcStatus->u32Received = m_u32Received;
+        enRet = Ok;
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup FW_UPD_Local_Functions FW_UPD Local Functions
+ * @{
+ */
+
+/**
+ * @brief  CRC32 of a flash or RAM area, padded with 0xFF to a word in flash.
+ * @param  [in] u32Addr                 Word aligned start address.
+ * @param  [in] u32Size                 Size in bytes.
+ * @retval CRC32
+ */
+static uint32_t FW_UPD_Crc(uint32_t u32Addr, uint32_t u32Size)
+{
+    return CRC_Calculate(CRC_CRC32, (const void *)u32Addr, FW_UPD_CRC_INIT,
+                         (u32Size + 3UL) / 4UL, CRC_DATA_WIDTH_32BIT);
+}
+
+/**
+ * @brief  Check the image of a slot against its record.
+ * @param  [in] u32Slot                 Slot.
+ * @param  [in] u32Size                 Image size from the record.
+ * @param  [in] u32Crc                  Image CRC32 from the record.
+ * @retval Set if the image is intact.
+ */
+static en_flag_status_t FW_UPD_SlotValid(uint32_t u32Slot, uint32_t u32Size, uint32_t u32Crc)
+{
+    en_flag_status_t enRet = Reset;
+
+    if ((u32Size != 0UL) && (u32Size <= m_stcLayout.u32SlotSize) &&
+        (u32Crc == FW_UPD_Crc(m_stcLayout.au32SlotAddr[u32Slot], u32Size)))
+    {
+        enRet = Set;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Check a boot record in flash.
+ * @param  [in] u32Addr                 Record address.
+ * @retval Set if the record is complete.
+ */
+static en_flag_status_t FW_UPD_RecordValid(uint32_t u32Addr)
+{
+    en_flag_status_t enRet = Reset;
+    const uint32_t u32Word0 = RW_MEM32(u32Addr);
+
+    if (((u32Word0 & FW_UPD_REC_MAGIC_MASK) == FW_UPD_REC_MAGIC) &&
+        IS_FW_UPD_SLOT(u32Word0 & 0xFFUL) &&
+        (RW_MEM32(u32Addr + FW_UPD_REC_SIZE - 4UL) == FW_UPD_Crc(u32Addr, FW_UPD_REC_SIZE - 4UL)))
+    {
+        enRet = Set;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Apply a boot record to the boot state.
+ * @param  [in] au32Rec                 Record words.
+ * @retval None
+ */
+static void FW_UPD_Apply(const uint32_t au32Rec[])
+{
+    const uint32_t u32Slot = au32Rec[0U] & 0xFFUL;
+
+    m_u32Seq = au32Rec[1U];
+    switch ((au32Rec[0U] >> 8U) & 0xFFUL)
+    {
+        case FW_UPD_REC_TRIAL:
+        case FW_UPD_REC_TRIAL_BOOTED:
+            m_u32TrialSlot = u32Slot;
+            m_u32TrialSize = au32Rec[2U];
+            m_u32TrialCrc = au32Rec[3U];
+            m_u32TrialBooted = (((au32Rec[0U] >> 8U) & 0xFFUL) == FW_UPD_REC_TRIAL_BOOTED) ? 1UL : 0UL;
+            break;
+        case FW_UPD_REC_ATTEMPT:
+            if (m_u32TrialSlot == u32Slot)
+            {
+                m_u32TrialBooted = 1UL;
+            }
+            break;
+        case FW_UPD_REC_CONFIRM:
+            m_u32ConfSlot = u32Slot;
+            m_u32ConfSize = au32Rec[2U];
+            m_u32ConfCrc = au32Rec[3U];
+            /* Only the trial it accepts, a copied state confirms the other slot */
+            if (m_u32TrialSlot == u32Slot)
+            {
+                m_u32TrialSlot = FW_UPD_SLOT_NONE;
+                m_u32TrialBooted = 0UL;
+            }
+            break;
+        case FW_UPD_REC_REVERT:
+            m_u32TrialSlot = FW_UPD_SLOT_NONE;
+            m_u32TrialBooted = 0UL;
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief  Replay the boot records of both sectors, the older sector first.
+ * @param  None
+ * @retval None
+ */
+static void FW_UPD_Mount(void)
+{
+    uint32_t au32First[2U] = {0UL, 0UL};
+    uint32_t au32Found[2U] = {0UL, 0UL};
+    uint32_t au32Rec[FW_UPD_REC_WORDS];
+    uint32_t u32Base;
+    uint32_t u32Addr;
+    uint32_t u32Sector;
+    uint32_t u32Newer;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+
+    m_u32ConfSlot = FW_UPD_SLOT_NONE;
+    m_u32TrialSlot = FW_UPD_SLOT_NONE;
+    m_u32TrialBooted = 0UL;
+    m_u32Seq = 0UL;
+
+    for (u32Sector = 0UL; u32Sector < 2UL; u32Sector++)
+    {
+        u32Base = m_stcLayout.u32MetaAddr + (u32Sector * FW_UPD_SECTOR_SIZE);
+        for (u32Addr = u32Base; (u32Addr + FW_UPD_REC_SIZE) <= (u32Base + FW_UPD_SECTOR_SIZE); u32Addr += FW_UPD_REC_SIZE)
+        {
+            if (Set == FW_UPD_RecordValid(u32Addr))
+            {
+                au32First[u32Sector] = RW_MEM32(u32Addr + 4UL);
+                au32Found[u32Sector] = 1UL;
+                break;
+            }
+        }
+    }
+
+    /* The newer sector starts with a copy of the state, replayed after the
+       older sector. A copy cut by a reset leaves the older state in force: the
+       copied CONFIRM is for the other slot than the trial and keeps it, and
+       the trial is copied with its boot state in one record */
+    u32Newer = ((au32Found[1U] != 0UL) && ((au32Found[0U] == 0UL) || (au32First[1U] > au32First[0U]))) ? 1UL : 0UL;
+    for (i = 0UL; i < 2UL; i++)
+    {
+        u32Sector = (i == 0UL) ? (1UL - u32Newer) : u32Newer;
+        if (au32Found[u32Sector] != 0UL)
+        {
+            u32Base = m_stcLayout.u32MetaAddr + (u32Sector * FW_UPD_SECTOR_SIZE);
+            for (u32Addr = u32Base; (u32Addr + FW_UPD_REC_SIZE) <= (u32Base + FW_UPD_SECTOR_SIZE); u32Addr += FW_UPD_REC_SIZE)
+            {
+                if (Set == FW_UPD_RecordValid(u32Addr))
+                {
+                    for (k = 0UL; k < FW_UPD_REC_WORDS; k++)
+                    {
+                        au32Rec[k] = RW_MEM32(u32Addr + (k * 4UL));
+                    }
+                    FW_UPD_Apply(au32Rec);
+                }
+            }
+        }
+    }
+
+    /* Append after the last written record, a torn one included */
+    m_u32MetaSector = u32Newer;
+    m_u32MetaPos = 0UL;
+    u32Base = m_stcLayout.u32MetaAddr + (u32Newer * FW_UPD_SECTOR_SIZE);
+    for (j = 0UL; (j + FW_UPD_REC_SIZE) <= FW_UPD_SECTOR_SIZE; j += FW_UPD_REC_SIZE)
+    {
+        for (k = 0UL; k < FW_UPD_REC_WORDS; k++)
+        {
+            if (RW_MEM32(u32Base + j + (k * 4UL)) != FW_UPD_BLANK)
+            {
+                m_u32MetaPos = j + FW_UPD_REC_SIZE;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Program a boot record at the append position and apply it.
+ * @param  [in] u32Type                 Record type.
+ * @param  [in] u32Slot                 Slot.
+ * @param  [in] u32Size                 Image size.
+ * @param  [in] u32Crc                  Image CRC32.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  Error:                       Flash error
+ */
+static en_result_t FW_UPD_PutRecord(uint32_t u32Type, uint32_t u32Slot, uint32_t u32Size, uint32_t u32Crc)
+{
+    en_result_t enRet = Ok;
+    uint32_t au32Rec[FW_UPD_REC_WORDS];
+    const uint32_t u32Addr = m_stcLayout.u32MetaAddr + (m_u32MetaSector * FW_UPD_SECTOR_SIZE) + m_u32MetaPos;
+    uint32_t i;
+
+    au32Rec[0U] = FW_UPD_REC_WORD0(u32Type, u32Slot);
+    au32Rec[1U] = m_u32Seq + 1UL;
+    au32Rec[2U] = u32Size;
+    au32Rec[3U] = u32Crc;
+    au32Rec[4U] = FW_UPD_Crc((uint32_t)&au32Rec[0U], FW_UPD_REC_SIZE - 4UL);
+
+    /* The position is used even if programming fails, a word is never programmed twice */
+    m_u32MetaPos += FW_UPD_REC_SIZE;
+    for (i = 0UL; i < FW_UPD_REC_WORDS; i++)
+    {
+        if (Ok != EFM_Program32(u32Addr + (i * 4UL), au32Rec[i]))
+        {
+            enRet = Error;
+            break;
+        }
+    }
+    if (enRet == Ok)
+    {
+        FW_UPD_Apply(au32Rec);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Append a boot record, copying the state to the other sector when
+ *         the current one is full.
+ * @param  [in] u32Type                 Record type.
+ * @param  [in] u32Slot                 Slot.
+ * @param  [in] u32Size                 Image size.
+ * @param  [in] u32Crc                  Image CRC32.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorOperationInProgress:    A flash job is running
+ *   @arg  Error:                       Flash error
+ */
+static en_result_t FW_UPD_Append(uint32_t u32Type, uint32_t u32Slot, uint32_t u32Size, uint32_t u32Crc)
+{
+    en_result_t enRet = Ok;
+    const uint32_t u32ConfSlot = m_u32ConfSlot;
+    const uint32_t u32ConfSize = m_u32ConfSize;
+    const uint32_t u32ConfCrc = m_u32ConfCrc;
+    const uint32_t u32TrialSlot = m_u32TrialSlot;
+    const uint32_t u32TrialSize = m_u32TrialSize;
+    const uint32_t u32TrialCrc = m_u32TrialCrc;
+    const uint32_t u32TrialBooted = m_u32TrialBooted;
+
+    if (Set == EFM_ASYNC_IsBusy())
+    {
+        enRet = ErrorOperationInProgress;
+    }
+    else
+    {
+        if ((m_u32MetaPos + FW_UPD_REC_SIZE) > FW_UPD_SECTOR_SIZE)
+        {
+            m_u32MetaSector = 1UL - m_u32MetaSector;
+            m_u32MetaPos = 0UL;
+            enRet = EFM_SectorErase(m_stcLayout.u32MetaAddr + (m_u32MetaSector * FW_UPD_SECTOR_SIZE));
+            if ((enRet == Ok) && (u32ConfSlot != FW_UPD_SLOT_NONE))
+            {
+                enRet = FW_UPD_PutRecord(FW_UPD_REC_CONFIRM, u32ConfSlot, u32ConfSize, u32ConfCrc);
+            }
+            /* One record for the trial and its boot state, a cut copy never resets the attempt */
+            if ((enRet == Ok) && (u32TrialSlot != FW_UPD_SLOT_NONE))
+            {
+                enRet = FW_UPD_PutRecord((u32TrialBooted != 0UL) ? FW_UPD_REC_TRIAL_BOOTED : FW_UPD_REC_TRIAL,
+                                         u32TrialSlot, u32TrialSize, u32TrialCrc);
+            }
+        }
+        if (enRet == Ok)
+        {
+            enRet = FW_UPD_PutRecord(u32Type, u32Slot, u32Size, u32Crc);
+        }
+        else
+        {
+            enRet = Error;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start the flash job of a queued chunk if the flash is idle.
+ * @param  None
+ * @retval None
+ * @note   Called from the application and from the EFM interrupt.
+ */
+static void FW_UPD_Kick(void)
+{
+    stc_efm_async_job_t stcJob;
+    en_result_t enRet;
+    uint32_t u32Primask;
+    uint32_t i;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if ((m_u32BusyBuf == FW_UPD_BUF_NONE) && (m_u32Aborting == 0UL))
+    {
+        for (i = 0UL; i < FW_UPD_BUF_NUM; i++)
+        {
+            if (m_au32BufState[i] == FW_UPD_BUF_QUEUED)
+            {
+                stcJob.u32Op = EFM_ASYNC_OP_UPDATE;
+                stcJob.u32Addr = m_au32BufAddr[i];
+                stcJob.u32Size = FW_UPD_CHUNK_SIZE;
+                stcJob.pu32Data = &m_au32Buf[i][0U];
+                stcJob.pfnProgress = NULL;
+                stcJob.pfnDone = &FW_UPD_ChunkDone;
+                enRet = EFM_ASYNC_Start(&stcJob);
+                if (enRet == Ok)
+                {
+                    m_au32BufState[i] = FW_UPD_BUF_BUSY;
+                    m_u32BusyBuf = i;
+                }
+                else
+                {
+                    m_au32BufState[i] = FW_UPD_BUF_FREE;
+                    m_enUpdResult = enRet;
+                }
+                break;
+            }
+        }
+    }
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @brief  Chunk job completion callback, called from the EFM interrupt.
+ * @param  [in] enResult                Job result.
+ * @retval None
+ * @note   The flash is readable here, the programmed chunk is checked
+ *         against its buffer and the next chunk is started.
+ */
+static void FW_UPD_ChunkDone(en_result_t enResult)
+{
+    const uint32_t u32Buf = m_u32BusyBuf;
+    en_result_t enRet = enResult;
+
+    if (u32Buf != FW_UPD_BUF_NONE)
+    {
+        if ((enRet == Ok) &&
+            (FW_UPD_Crc(m_au32BufAddr[u32Buf], FW_UPD_CHUNK_SIZE) !=
+             FW_UPD_Crc((uint32_t)&m_au32Buf[u32Buf][0U], FW_UPD_CHUNK_SIZE)))
+        {
+            enRet = Error;
+        }
+        if ((enRet != Ok) && (m_enUpdResult == Ok))
+        {
+            m_enUpdResult = enRet;
+        }
+        m_au32BufState[u32Buf] = FW_UPD_BUF_FREE;
+        m_u32BusyBuf = FW_UPD_BUF_NONE;
+        FW_UPD_Kick();
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_FW_UPD_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
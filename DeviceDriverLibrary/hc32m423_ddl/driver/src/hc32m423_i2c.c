@@ -8,6 +8,8 @@
    Date             Author          Notes
    2020-09-15       CDT             First version
    2020-11-16       CDT             Fix bug and optimize code for I2C driver and example
+   2026-10-18       CDT             Use time based timeout in microseconds
+   2026-10-18       CDT             Add SMBus PEC calculation and block read/write functions
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -179,10 +181,48 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+/**
+ * @addtogroup I2C_Local_Functions
+ * @{
+ */
+static en_result_t I2C_SmbusSendByte(CM_I2C_TypeDef* I2Cx, uint8_t u8Data, uint8_t *pu8Pec, uint32_t u32Timeout);
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/**
+ * @defgroup I2C_Local_Variables I2C Local Variables
+ * @{
+ */
+
+/* SMBus PEC lookup table, CRC-8 with polynomial 0x07. The CRC unit only
+   supports CRC16/CRC32, one table load per byte keeps up with the bus. */
+static const uint8_t m_au8SmbusPecTable[256U] =
+{
+    0x00U, 0x07U, 0x0EU, 0x09U, 0x1CU, 0x1BU, 0x12U, 0x15U, 0x38U, 0x3FU, 0x36U, 0x31U, 0x24U, 0x23U, 0x2AU, 0x2DU,
+    0x70U, 0x77U, 0x7EU, 0x79U, 0x6CU, 0x6BU, 0x62U, 0x65U, 0x48U, 0x4FU, 0x46U, 0x41U, 0x54U, 0x53U, 0x5AU, 0x5DU,
+    0xE0U, 0xE7U, 0xEEU, 0xE9U, 0xFCU, 0xFBU, 0xF2U, 0xF5U, 0xD8U, 0xDFU, 0xD6U, 0xD1U, 0xC4U, 0xC3U, 0xCAU, 0xCDU,
+    0x90U, 0x97U, 0x9EU, 0x99U, 0x8CU, 0x8BU, 0x82U, 0x85U, 0xA8U, 0xAFU, 0xA6U, 0xA1U, 0xB4U, 0xB3U, 0xBAU, 0xBDU,
+    0xC7U, 0xC0U, 0xC9U, 0xCEU, 0xDBU, 0xDCU, 0xD5U, 0xD2U, 0xFFU, 0xF8U, 0xF1U, 0xF6U, 0xE3U, 0xE4U, 0xEDU, 0xEAU,
+    0xB7U, 0xB0U, 0xB9U, 0xBEU, 0xABU, 0xACU, 0xA5U, 0xA2U, 0x8FU, 0x88U, 0x81U, 0x86U, 0x93U, 0x94U, 0x9DU, 0x9AU,
+    0x27U, 0x20U, 0x29U, 0x2EU, 0x3BU, 0x3CU, 0x35U, 0x32U, 0x1FU, 0x18U, 0x11U, 0x16U, 0x03U, 0x04U, 0x0DU, 0x0AU,
+    0x57U, 0x50U, 0x59U, 0x5EU, 0x4BU, 0x4CU, 0x45U, 0x42U, 0x6FU, 0x68U, 0x61U, 0x66U, 0x73U, 0x74U, 0x7DU, 0x7AU,
+    0x89U, 0x8EU, 0x87U, 0x80U, 0x95U, 0x92U, 0x9BU, 0x9CU, 0xB1U, 0xB6U, 0xBFU, 0xB8U, 0xADU, 0xAAU, 0xA3U, 0xA4U,
+    0xF9U, 0xFEU, 0xF7U, 0xF0U, 0xE5U, 0xE2U, 0xEBU, 0xECU, 0xC1U, 0xC6U, 0xCFU, 0xC8U, 0xDDU, 0xDAU, 0xD3U, 0xD4U,
+    0x69U, 0x6EU, 0x67U, 0x60U, 0x75U, 0x72U, 0x7BU, 0x7CU, 0x51U, 0x56U, 0x5FU, 0x58U, 0x4DU, 0x4AU, 0x43U, 0x44U,
+    0x19U, 0x1EU, 0x17U, 0x10U, 0x05U, 0x02U, 0x0BU, 0x0CU, 0x21U, 0x26U, 0x2FU, 0x28U, 0x3DU, 0x3AU, 0x33U, 0x34U,
+    0x4EU, 0x49U, 0x40U, 0x47U, 0x52U, 0x55U, 0x5CU, 0x5BU, 0x76U, 0x71U, 0x78U, 0x7FU, 0x6AU, 0x6DU, 0x64U, 0x63U,
+    0x3EU, 0x39U, 0x30U, 0x37U, 0x22U, 0x25U, 0x2CU, 0x2BU, 0x06U, 0x01U, 0x08U, 0x0FU, 0x1AU, 0x1DU, 0x14U, 0x13U,
+    0xAEU, 0xA9U, 0xA0U, 0xA7U, 0xB2U, 0xB5U, 0xBCU, 0xBBU, 0x96U, 0x91U, 0x98U, 0x9FU, 0x8AU, 0x8DU, 0x84U, 0x83U,
+    0xDEU, 0xD9U, 0xD0U, 0xD7U, 0xC2U, 0xC5U, 0xCCU, 0xCBU, 0xE6U, 0xE1U, 0xE8U, 0xEFU, 0xFAU, 0xFDU, 0xF4U, 0xF3U
+};
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -219,8 +259,7 @@
  * @param  [in] enStatus            Expected status
  *         @arg Set:                Wait flag set
  *         @arg Reset:              Wait flag reset
- * @param  [in] u32Timeout          Maximum count of trying to get a status of a
- *                                  flag in status register
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
  * @retval en_result_t              Enumeration value:
  *         @arg Ok:                 Successfully gotten the expected status of the specified flags
  *         @arg ErrorTimeout:       Failed to get expected status of specified flags
@@ -229,7 +268,9 @@ en_result_t I2C_WaitStatus(const CM_I2C_TypeDef *I2Cx, uint32_t u32Flag, en_flag
 {
     en_result_t enRet = ErrorTimeout;
     uint32_t u32RegStatusBit;
+    stc_ddl_deadline_t stcDeadline;
 
+    DDL_DeadlineStart(&stcDeadline, u32Timeout);
     for(;;)
     {
         u32RegStatusBit = (READ_REG32_BIT(I2Cx->SR, u32Flag));
@@ -239,14 +280,10 @@ en_result_t I2C_WaitStatus(const CM_I2C_TypeDef *I2Cx, uint32_t u32Flag, en_flag
             enRet = Ok;
         }
 
-        if((Ok == enRet) || (0UL == u32Timeout))
+        if((Ok == enRet) || (Set == DDL_DeadlineIsExpired(&stcDeadline)))
         {
             break;
         }
-        else
-        {
-            u32Timeout--;
-        }
     }
 
     return enRet;
@@ -879,8 +916,7 @@ void I2C_AckConfig(CM_I2C_TypeDef* I2Cx, uint32_t u32AckConfig)
  * @param  [in] I2Cx                Pointer to I2C instance register base.
  *                                  This parameter can be a value of the following:
  *         @arg CM_I2C:             I2C instance register base.
- * @param  [in] u32Timeout          Maximum count of trying to get a status of a
- *                                  flag in status register
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
  * @retval en_result_t              Enumeration value:
  *         @arg Ok:                 Start success
  *         @arg ErrorTimeout:       Start time out
@@ -909,8 +945,7 @@ en_result_t I2C_Start(CM_I2C_TypeDef* I2Cx, uint32_t u32Timeout)
  * @param  [in] I2Cx                Pointer to I2C instance register base.
  *                                  This parameter can be a value of the following:
  *         @arg CM_I2C:             I2C instance register base.
- * @param  [in] u32Timeout          Maximum count of trying to get a status of a
- *                                  flag in status register
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
  * @retval en_result_t              Enumeration value:
  *         @arg Ok:                 Restart successfully
  *         @arg ErrorTimeout:       Restart time out
@@ -941,8 +976,7 @@ en_result_t I2C_Restart(CM_I2C_TypeDef* I2Cx, uint32_t u32Timeout)
  *                                  one of the following values:
  *         @arg I2C_DIR_TX
  *         @arg I2C_DIR_RX
- * @param  [in] u32Timeout          Maximum count of trying to get a status of a
- *                                  flag in status register
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
  * @retval en_result_t              Enumeration value:
  *         @arg Ok:                 Send successfully
  *         @arg ErrorTimeout:       Send address time out
@@ -996,8 +1030,7 @@ en_result_t I2C_TransAddr(CM_I2C_TypeDef* I2Cx, uint16_t u16Addr, uint8_t u8Dir,
  *                                  one of the following values:
  *         @arg I2C_DIR_TX
  *         @arg I2C_DIR_RX
- * @param  [in] u32Timeout          Maximum count of trying to get a status of a
- *                                  flag in status register
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
  * @retval en_result_t              Enumeration value:
  *         @arg Ok:                 Send successfully
  *         @arg ErrorTimeout:       Send address time out
@@ -1078,8 +1111,7 @@ en_result_t I2C_Trans10BitAddr(CM_I2C_TypeDef* I2Cx, uint16_t u16Addr, uint8_t u
  *         @arg CM_I2C:             I2C instance register base.
  * @param  [in] au8TxData           The data array to be sent
  * @param  [in] u32Size             Number of data in array pau8TxData
- * @param  [in] u32Timeout          Maximum count of trying to get a status of a
- *                                  flag in status register
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
  * @retval en_result_t              Enumeration value:
  *         @arg Ok:                 Send successfully
  *         @arg ErrorTimeout:       Send data time out
@@ -1131,8 +1163,7 @@ en_result_t I2C_TransData(CM_I2C_TypeDef* I2Cx, uint8_t const au8TxData[], uint3
  *         @arg CM_I2C:             I2C instance register base.
  * @param  [out] au8RxData          Array to hold the received data
  * @param  [in] u32Size             Number of data to be received
- * @param  [in] u32Timeout          Maximum count of trying to get a status of a
- *                                  flag in status register
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
  * @retval en_result_t              Enumeration value:
  *         @arg Ok:                 Receive successfully
  *         @arg ErrorTimeout:       Receive data time out
@@ -1198,8 +1229,7 @@ en_result_t I2C_ReceiveData(CM_I2C_TypeDef* I2Cx, uint8_t au8RxData[], uint32_t
  *         @arg CM_I2C:             I2C instance register base.
  * @param  [out] au8RxData          Array to hold the received data
  * @param  [in] u32Size             Number of data to be received
- * @param  [in] u32Timeout          Maximum count of trying to get a status of a
- *                                  flag in status register
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
  * @retval en_result_t              Enumeration value:
  *         @arg Ok:                 Receive successfully
  *         @arg ErrorTimeout:       Receive data time out
@@ -1275,8 +1305,7 @@ en_result_t I2C_MasterReceiveDataAndStop(CM_I2C_TypeDef* I2Cx, uint8_t au8RxData
  * @param  [in] I2Cx                Pointer to I2C instance register base.
  *                                  This parameter can be a value of the following:
  *         @arg CM_I2C:             I2C instance register base.
- * @param  [in] u32Timeout          Maximum count of trying to get a status of a
- *                                  flag in status register
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
  * @retval en_result_t              Enumeration value:
  *         @arg Ok:                 Stop successfully
  *         @arg ErrorTimeout:       Stop time out
@@ -1284,14 +1313,19 @@ en_result_t I2C_MasterReceiveDataAndStop(CM_I2C_TypeDef* I2Cx, uint8_t au8RxData
 en_result_t I2C_Stop(CM_I2C_TypeDef* I2Cx, uint32_t u32Timeout)
 {
     en_result_t enRet;
+    stc_ddl_deadline_t stcDeadline;
 
     DDL_ASSERT(IS_I2C_UNIT(I2Cx));
 
     /* Clear stop flag */
-    while((Set == I2C_GetStatus(I2Cx, I2C_FLAG_STOP)) && (u32Timeout > 0UL))
+    DDL_DeadlineStart(&stcDeadline, u32Timeout);
+    while(Set == I2C_GetStatus(I2Cx, I2C_FLAG_STOP))
     {
         I2C_ClearStatus(I2Cx, I2C_FLAG_STOP);
-        u32Timeout--;
+        if(Set == DDL_DeadlineIsExpired(&stcDeadline))
+        {
+            break;
+        }
     }
     I2C_GenerateStop(I2Cx);
     /* Wait stop flag */
@@ -1323,6 +1357,315 @@ en_result_t I2C_StructInit(stc_i2c_init_t* pstcI2cInit)
     return enRet;
 }
 
+/**
+ * @brief  Calculate the SMBus packet error code incrementally.
+ * @param  [in] u8Pec               PEC of the preceding bytes, I2C_SMBUS_PEC_INIT for
+ *                                  the first call of a frame.
+ * @param  [in] au8Data             Bytes to add, including the address bytes.
+ * @param  [in] u32Len              Number of bytes.
+ * @retval PEC over the preceding bytes and au8Data
+ */
+uint8_t I2C_SmbusPecCalculate(uint8_t u8Pec, const uint8_t au8Data[], uint32_t u32Len)
+{
+    uint32_t i;
+
+    if (au8Data != NULL)
+    {
+        for (i = 0UL; i < u32Len; i++)
+        {
+            u8Pec = m_au8SmbusPecTable[u8Pec ^ au8Data[i]];
+        }
+    }
+
+    return u8Pec;
+}
+
+/**
+ * @brief  SMBus block write (for master).
+ *         Frame: S [Addr+W] [Cmd] [Count] [Data0] ... [DataN-1] ([PEC]) P
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C:             I2C instance register base.
+ * @param  [in] u16Addr             7-bit slave address
+ * @param  [in] u8Cmd               Command code
+ * @param  [in] au8Data             Data to be sent
+ * @param  [in] u8Len               Byte count
+ * @param  [in] enPec               Append the packet error code
+ *         @arg Enable:             Send PEC after the data
+ *         @arg Disable:            No PEC
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
+ * @retval en_result_t              Enumeration value:
+ *         @arg Ok:                 Send successfully
+ *         @arg ErrorTimeout:       Bus time out
+ *         @arg Error:              NACK received
+ *         @arg ErrorInvalidParameter: au8Data is NULL
+ * @note   The PEC of each byte is calculated while the byte is being shifted
+ *         out, so PEC adds no gap between bytes.
+ */
+en_result_t I2C_SmbusBlockWrite(CM_I2C_TypeDef* I2Cx, uint16_t u16Addr, uint8_t u8Cmd,
+                                const uint8_t au8Data[], uint8_t u8Len,
+                                en_functional_state_t enPec, uint32_t u32Timeout)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    en_result_t enStopRet;
+    uint8_t u8Pec;
+    uint8_t u8Addr;
+    uint32_t i;
+
+    DDL_ASSERT(IS_I2C_UNIT(I2Cx));
+    DDL_ASSERT(IS_I2C_7BIT_ADDR(u16Addr));
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enPec));
+
+    if ((au8Data != NULL) || (0U == u8Len))
+    {
+        u8Addr = (uint8_t)(u16Addr << 1U) | I2C_DIR_TX;
+        u8Pec = m_au8SmbusPecTable[I2C_SMBUS_PEC_INIT ^ u8Addr];
+
+        enRet = I2C_Start(I2Cx, u32Timeout);
+        if (Ok == enRet)
+        {
+            enRet = I2C_TransAddr(I2Cx, u16Addr, I2C_DIR_TX, u32Timeout);
+        }
+        if (Ok == enRet)
+        {
+            enRet = I2C_SmbusSendByte(I2Cx, u8Cmd, &u8Pec, u32Timeout);
+        }
+        if (Ok == enRet)
+        {
+            enRet = I2C_SmbusSendByte(I2Cx, u8Len, &u8Pec, u32Timeout);
+        }
+        for (i = 0UL; (i < (uint32_t)u8Len) && (Ok == enRet); i++)
+        {
+            enRet = I2C_SmbusSendByte(I2Cx, au8Data[i], &u8Pec, u32Timeout);
+        }
+        if ((Ok == enRet) && (Enable == enPec))
+        {
+            enRet = I2C_SmbusSendByte(I2Cx, u8Pec, NULL, u32Timeout);
+        }
+
+        enStopRet = I2C_Stop(I2Cx, u32Timeout);
+        if (Ok == enRet)
+        {
+            enRet = enStopRet;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  SMBus block read (for master).
+ *         Frame: S [Addr+W] [Cmd] Sr [Addr+R] [Count] [Data0] ... [DataN-1] ([PEC]) P
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C:             I2C instance register base.
+ * @param  [in] u16Addr             7-bit slave address
+ * @param  [in] u8Cmd               Command code
+ * @param  [out] au8Data            Buffer for the received data
+ * @param  [in] u8MaxLen            Size of au8Data
+ * @param  [out] pu8Len             Number of bytes stored in au8Data
+ * @param  [in] enPec               Read and verify the packet error code
+ *         @arg Enable:             The slave sends PEC after the data
+ *         @arg Disable:            No PEC
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
+ * @retval en_result_t              Enumeration value:
+ *         @arg Ok:                 Receive successfully and PEC matched
+ *         @arg ErrorTimeout:       Bus time out
+ *         @arg Error:              NACK received or PEC mismatch
+ *         @arg ErrorBufferFull:    Byte count larger than u8MaxLen, the
+ *                                  extra bytes are read and discarded
+ *         @arg ErrorInvalidParameter: au8Data or pu8Len is NULL
+ */
+en_result_t I2C_SmbusBlockRead(CM_I2C_TypeDef* I2Cx, uint16_t u16Addr, uint8_t u8Cmd,
+                               uint8_t au8Data[], uint8_t u8MaxLen, uint8_t *pu8Len,
+                               en_functional_state_t enPec, uint32_t u32Timeout)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint8_t u8Pec;
+    uint8_t u8RxPec = 0U;
+    uint8_t u8Data;
+    uint8_t au8Head[3U];
+    uint32_t u32FastAckDis;
+    /* Byte count plus at least one more byte, updated once the count is read */
+    uint32_t u32Size = 2UL;
+    uint32_t u32Count = 0UL;
+    uint32_t i;
+
+    DDL_ASSERT(IS_I2C_UNIT(I2Cx));
+    DDL_ASSERT(IS_I2C_7BIT_ADDR(u16Addr));
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enPec));
+
+    if ((au8Data != NULL) && (pu8Len != NULL))
+    {
+        *pu8Len = 0U;
+        au8Head[0U] = (uint8_t)(u16Addr << 1U) | I2C_DIR_TX;
+        au8Head[1U] = u8Cmd;
+        au8Head[2U] = (uint8_t)(u16Addr << 1U) | I2C_DIR_RX;
+        u8Pec = I2C_SmbusPecCalculate(I2C_SMBUS_PEC_INIT, au8Head, 3UL);
+
+        enRet = I2C_Start(I2Cx, u32Timeout);
+        if (Ok == enRet)
+        {
+            enRet = I2C_TransAddr(I2Cx, u16Addr, I2C_DIR_TX, u32Timeout);
+        }
+        if (Ok == enRet)
+        {
+            enRet = I2C_SmbusSendByte(I2Cx, u8Cmd, NULL, u32Timeout);
+        }
+        if (Ok == enRet)
+        {
+            enRet = I2C_Restart(I2Cx, u32Timeout);
+        }
+        if (Ok == enRet)
+        {
+            enRet = I2C_TransAddr(I2Cx, u16Addr, I2C_DIR_RX, u32Timeout);
+        }
+
+        if (Ok == enRet)
+        {
+            u32FastAckDis = READ_REG32_BIT(I2Cx->CR1, I2C_CR1_FACKEN);
+            I2C_AckConfig(I2Cx, I2C_ACK);
+
+            for (i = 0UL; i < u32Size; i++)
+            {
+                enRet = I2C_WaitStatus(I2Cx, I2C_FLAG_RX_FULL, Set, u32Timeout);
+                if (Ok != enRet)
+                {
+                    break;
+                }
+
+                if (0UL == i)
+                {
+                    /* Byte count, the frame length is known from here on */
+                    u8Data = I2C_ReadData(I2Cx);
+                    u32Count = (uint32_t)u8Data;
+                    u32Size = 1UL + u32Count + ((Enable == enPec) ? 1UL : 0UL);
+                    if (u32Size < 2UL)
+                    {
+                        /* Count 0 without PEC: one byte was already ACKed, read and discard it */
+                        u32Size = 2UL;
+                    }
+                    if ((0UL == u32FastAckDis) && (2UL == u32Size))
+                    {
+                        /* Still ahead of the ACK bit of the next byte */
+                        I2C_AckConfig(I2Cx, I2C_NACK);
+                    }
+                }
+                else
+                {
+                    if (0UL == u32FastAckDis)
+                    {
+                        if (i == (u32Size - 2UL))
+                        {
+                            I2C_AckConfig(I2Cx, I2C_NACK);
+                        }
+                    }
+                    else
+                    {
+                        if (i == (u32Size - 1UL))
+                        {
+                            I2C_AckConfig(I2Cx, I2C_NACK);
+                        }
+                    }
+
+                    /* Stop before read last data */
+                    if (i == (u32Size - 1UL))
+                    {
+                        I2C_ClearStatus(I2Cx, I2C_FLAG_STOP);
+                        I2C_GenerateStop(I2Cx);
+                    }
+                    u8Data = I2C_ReadData(I2Cx);
+                }
+
+                if (i <= u32Count)
+                {
+                    u8Pec = m_au8SmbusPecTable[u8Pec ^ u8Data];
+                    if ((0UL != i) && ((i - 1UL) < (uint32_t)u8MaxLen))
+                    {
+                        au8Data[i - 1UL] = u8Data;
+                    }
+                }
+                else
+                {
+                    u8RxPec = u8Data;
+                }
+            }
+            I2C_AckConfig(I2Cx, I2C_ACK);
+
+            if (Ok == enRet)
+            {
+                /* Wait stop flag after DRR read */
+                enRet = I2C_WaitStatus(I2Cx, I2C_FLAG_STOP, Set, u32Timeout);
+            }
+        }
+
+        if (Ok == enRet)
+        {
+            *pu8Len = (u32Count < (uint32_t)u8MaxLen) ? (uint8_t)u32Count : u8MaxLen;
+            if ((Enable == enPec) && (u8RxPec != u8Pec))
+            {
+                enRet = Error;
+            }
+            else if (u32Count > (uint32_t)u8MaxLen)
+            {
+                enRet = ErrorBufferFull;
+            }
+            else
+            {
+                /* Frame OK */
+            }
+        }
+        else
+        {
+            (void)I2C_Stop(I2Cx, u32Timeout);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2C_Local_Functions I2C Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Send one byte and update the PEC while it is shifted out.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ * @param  [in] u8Data              Byte to send
+ * @param  [in,out] pu8Pec          PEC to update, NULL for none
+ * @param  [in] u32Timeout          Timeout in microseconds for each status flag wait
+ * @retval en_result_t              Enumeration value:
+ *         @arg Ok:                 ACK received
+ *         @arg ErrorTimeout:       Send time out
+ *         @arg Error:              NACK received
+ */
+static en_result_t I2C_SmbusSendByte(CM_I2C_TypeDef* I2Cx, uint8_t u8Data, uint8_t *pu8Pec, uint32_t u32Timeout)
+{
+    en_result_t enRet;
+
+    enRet = I2C_WaitStatus(I2Cx, I2C_FLAG_TX_EMPTY, Set, u32Timeout);
+    if (Ok == enRet)
+    {
+        I2C_WriteData(I2Cx, u8Data);
+        if (pu8Pec != NULL)
+        {
+            *pu8Pec = m_au8SmbusPecTable[*pu8Pec ^ u8Data];
+        }
+        enRet = I2C_WaitStatus(I2Cx, I2C_FLAG_TX_CPLT, Set, u32Timeout);
+        if ((Ok == enRet) && (Set == I2C_GetStatus(I2Cx, I2C_FLAG_ACKR)))
+        {
+            enRet = Error;
+        }
+    }
+
+    return enRet;
+}
+
 /**
  * @}
  */
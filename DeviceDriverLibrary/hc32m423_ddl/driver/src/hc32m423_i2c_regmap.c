@@ -0,0 +1,667 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_i2c_regmap.c
+ * @brief This file provides firmware functions to run CM_I2C as a slave with
+ *        a memory mapped register file.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_i2c_regmap.h"
+#include "hc32m423_i2c.h"
+#include "hc32m423_dma.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_I2C_REGMAP I2C_REGMAP
+ * @brief I2C Slave Register Map Driver Library
+ * @details Protocol seen by the master:
+ *          - Write: [addr+W] [reg] [data0] [data1] ... sets the register pointer
+ *            to reg and writes the data with auto-increment.
+ *          - Read: [addr+R] [data0] [data1] ... reads from the register pointer
+ *            with auto-increment. Use a write of [reg] followed by a repeated
+ *            start to read from a given register.
+ *          The register pointer wraps to 0 after the last register.
+ *          Master reads of read-accessible registers are streamed by DMA on the
+ *          EVT_I2C_TXI event, so the CPU only handles address match, STOP/NACK
+ *          and the end of each readable block.
+ * @{
+ */
+
+#if (DDL_I2C_REGMAP_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_REGMAP_Local_Macros I2C_REGMAP Local Macros
+ * @{
+ */
+#define I2C_REGMAP_UNIT                 (CM_I2C)
+#define I2C_REGMAP_DMA_UNIT             (CM_DMA)
+
+/**
+ * @defgroup I2C_REGMAP_State I2C register map transaction state
+ * @{
+ */
+#define I2C_REGMAP_STATE_IDLE           (0U)
+#define I2C_REGMAP_STATE_WRITE_PTR      (1U)    /*!< Master write, waiting for the register pointer */
+#define I2C_REGMAP_STATE_WRITE_DATA     (2U)    /*!< Master write, register data */
+#define I2C_REGMAP_STATE_READ           (3U)    /*!< Master read */
+/**
+ * @}
+ */
+
+#define I2C_REGMAP_MASK_WORDS           (I2C_REGMAP_REG_NUM_MAX / 32UL)
+
+#define I2C_REGMAP_MASK_TEST(mask, reg) (0UL != ((mask)[(reg) >> 5U] & (1UL << ((reg) & 0x1FUL))))
+#define I2C_REGMAP_MASK_SET(mask, reg)  ((mask)[(reg) >> 5U] |= (1UL << ((reg) & 0x1FUL)))
+
+/**
+ * @defgroup I2C_REGMAP_Check_Parameters_Validity I2C_REGMAP Check Parameters Validity
+ * @{
+ */
+#define IS_I2C_REGMAP_ACCESS(x)                                                \
+(   ((x) == I2C_REGMAP_ACCESS_RW)               ||                             \
+    ((x) == I2C_REGMAP_ACCESS_RO)               ||                             \
+    ((x) == I2C_REGMAP_ACCESS_WO))
+
+#define IS_I2C_REGMAP_DMA_CH(x)                                                \
+(   ((x) <= DMA_CH3)                            ||                             \
+    ((x) == I2C_REGMAP_DMA_NONE))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup I2C_REGMAP_Local_Functions
+ * @{
+ */
+static uint32_t RegAdvance(uint32_t u32Reg, uint32_t u32Step);
+static uint32_t ReadableRun(uint32_t u32Reg);
+static void TxNextByte(void);
+static void ReadEnd(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_REGMAP_Local_Variables I2C_REGMAP Local Variables
+ * @{
+ */
+static uint8_t *m_pu8RegFile = NULL;
+static uint32_t m_u32RegNum = 0UL;
+static uint32_t m_u32DmaCh = I2C_REGMAP_DMA_NONE;
+static func_ptr_i2c_regmap_write_t m_pfnWriteCallback = NULL;
+
+/* Bit set: register is read-only / write-only */
+static uint32_t m_au32RoMask[I2C_REGMAP_MASK_WORDS];
+static uint32_t m_au32WoMask[I2C_REGMAP_MASK_WORDS];
+
+static __IO uint32_t m_u32State = I2C_REGMAP_STATE_IDLE;
+/* Register pointer, persists between transactions */
+static uint32_t m_u32RegPtr = 0UL;
+/* Master write: first register and number of data bytes */
+static uint32_t m_u32WriteStart = 0UL;
+static uint32_t m_u32WriteCount = 0UL;
+/* Master read: next register to load into DTR by the CPU */
+static uint32_t m_u32TxReg = 0UL;
+/* Master read: bytes loaded into DTR by the CPU and programmed into the DMA */
+static uint32_t m_u32TxCount = 0UL;
+static uint32_t m_u32DmaLen = 0UL;
+/* Master read: bytes really sent, fixed at NACK */
+static uint32_t m_u32TxSent = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_REGMAP_Global_Functions I2C_REGMAP Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_i2c_regmap_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_i2c_regmap_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t I2C_REGMAP_StructInit(stc_i2c_regmap_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32SlaveAddr = 0x50UL;
+        pstcInit->u32Baudrate = 400000UL;
+        pstcInit->u32ClockDiv = I2C_CLK_DIV4;
+        pstcInit->pu8RegFile = NULL;
+        pstcInit->u32RegNum = 0UL;
+        pstcInit->pstcRegion = NULL;
+        pstcInit->u32RegionNum = 0UL;
+        pstcInit->u32DmaCh = I2C_REGMAP_DMA_NONE;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI03;
+        pstcInit->pfnWriteCallback = NULL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize CM_I2C as a register map slave.
+ * @param  [in] pstcInit                Pointer to a stc_i2c_regmap_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration or I2C timing
+ * @note   The I2C, DMA and AOS function clocks must be enabled and the SCL/SDA
+ *         pins configured before calling this function.
+ * @note   The application forwards the interrupts:
+ *         I2C_Error_IrqHandler() -> I2C_REGMAP_EEI_IrqHandler(),
+ *         I2C_RxEnd_IrqHandler() -> I2C_REGMAP_RXI_IrqHandler(),
+ *         I2C_TxEnd_IrqHandler() -> I2C_REGMAP_TEI_IrqHandler(),
+ *         DMA_TCx_IrqHandler()   -> I2C_REGMAP_DmaTc_IrqHandler() (x = u32DmaCh).
+ */
+en_result_t I2C_REGMAP_Init(const stc_i2c_regmap_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_i2c_init_t stcI2cInit;
+    stc_dma_init_t stcDmaInit;
+    float32_t f32Error;
+    uint32_t i;
+    uint32_t u32Reg;
+    const stc_i2c_regmap_region_t *pstcRegion;
+
+    if ((pstcInit != NULL) && (pstcInit->pu8RegFile != NULL) &&
+        (pstcInit->u32RegNum != 0UL) && (pstcInit->u32RegNum <= I2C_REGMAP_REG_NUM_MAX) &&
+        (pstcInit->u32SlaveAddr <= 0x7FUL) &&
+        ((pstcInit->u32RegionNum == 0UL) || (pstcInit->pstcRegion != NULL)))
+    {
+        DDL_ASSERT(IS_I2C_REGMAP_DMA_CH(pstcInit->u32DmaCh));
+
+        enRet = Ok;
+        (void)memset(m_au32RoMask, 0, sizeof(m_au32RoMask));
+        (void)memset(m_au32WoMask, 0, sizeof(m_au32WoMask));
+        for (i = 0UL; i < pstcInit->u32RegionNum; i++)
+        {
+            pstcRegion = &pstcInit->pstcRegion[i];
+            DDL_ASSERT(IS_I2C_REGMAP_ACCESS(pstcRegion->u32Access));
+            if ((pstcRegion->u8StartReg > pstcRegion->u8EndReg) ||
+                ((uint32_t)pstcRegion->u8EndReg >= pstcInit->u32RegNum))
+            {
+                enRet = ErrorInvalidParameter;
+                break;
+            }
+            for (u32Reg = pstcRegion->u8StartReg; u32Reg <= pstcRegion->u8EndReg; u32Reg++)
+            {
+                if (pstcRegion->u32Access == I2C_REGMAP_ACCESS_RO)
+                {
+                    I2C_REGMAP_MASK_SET(m_au32RoMask, u32Reg);
+                }
+                else if (pstcRegion->u32Access == I2C_REGMAP_ACCESS_WO)
+                {
+                    I2C_REGMAP_MASK_SET(m_au32WoMask, u32Reg);
+                }
+                else
+                {
+                    /* Read/write: nothing to mark */
+                }
+            }
+        }
+
+        if (enRet == Ok)
+        {
+            I2C_DeInit(I2C_REGMAP_UNIT);
+            (void)I2C_StructInit(&stcI2cInit);
+            stcI2cInit.u32Baudrate = pstcInit->u32Baudrate;
+            stcI2cInit.u32ClockDiv = pstcInit->u32ClockDiv;
+            stcI2cInit.u32SclTime = 5UL;
+            enRet = I2C_Init(I2C_REGMAP_UNIT, &stcI2cInit, &f32Error);
+        }
+
+        if (enRet == Ok)
+        {
+            m_pu8RegFile = pstcInit->pu8RegFile;
+            m_u32RegNum = pstcInit->u32RegNum;
+            m_u32DmaCh = pstcInit->u32DmaCh;
+            m_pfnWriteCallback = pstcInit->pfnWriteCallback;
+            m_u32RegPtr = 0UL;
+            m_u32State = I2C_REGMAP_STATE_IDLE;
+
+            I2C_SlaveAddrConfig(I2C_REGMAP_UNIT, I2C_ADDR0, I2C_ADDR_7BIT, pstcInit->u32SlaveAddr);
+
+            if (m_u32DmaCh != I2C_REGMAP_DMA_NONE)
+            {
+                (void)DMA_StructInit(&stcDmaInit);
+                stcDmaInit.u32BlockSize = 1UL;
+                stcDmaInit.u32TransCount = 1UL;
+                stcDmaInit.u32DataWidth = DMA_DATA_WIDTH_8BIT;
+                stcDmaInit.u32SrcAddr = (uint32_t)m_pu8RegFile;
+                stcDmaInit.u32DestAddr = (uint32_t)(&I2C_REGMAP_UNIT->DTR);
+                stcDmaInit.u32SrcAddrMode = DMA_SRC_ADDR_MD_INC;
+                stcDmaInit.u32DestAddrMode = DMA_DEST_ADDR_MD_FIX;
+                (void)DMA_Init(I2C_REGMAP_DMA_UNIT, m_u32DmaCh, &stcDmaInit);
+                DMA_SetTriggerSrc(I2C_REGMAP_DMA_UNIT, m_u32DmaCh, EVT_I2C_TXI);
+                DMA_ClearTransIntStatus(I2C_REGMAP_DMA_UNIT, (DMA_INT_TC0 << m_u32DmaCh));
+                DMA_TransIntCmd(I2C_REGMAP_DMA_UNIT, (DMA_INT_TC0 << m_u32DmaCh), Enable);
+                DMA_Cmd(I2C_REGMAP_DMA_UNIT, Enable);
+
+                NVIC_ClearPendingIRQ((IRQn_Type)((uint32_t)DMA_TC0_IRQn + m_u32DmaCh));
+                NVIC_SetPriority((IRQn_Type)((uint32_t)DMA_TC0_IRQn + m_u32DmaCh), pstcInit->u32IrqPriority);
+                NVIC_EnableIRQ((IRQn_Type)((uint32_t)DMA_TC0_IRQn + m_u32DmaCh));
+            }
+
+            NVIC_ClearPendingIRQ(I2C_RXI_IRQn);
+            NVIC_SetPriority(I2C_RXI_IRQn, pstcInit->u32IrqPriority);
+            NVIC_EnableIRQ(I2C_RXI_IRQn);
+            NVIC_ClearPendingIRQ(I2C_TEI_IRQn);
+            NVIC_SetPriority(I2C_TEI_IRQn, pstcInit->u32IrqPriority);
+            NVIC_EnableIRQ(I2C_TEI_IRQn);
+            NVIC_ClearPendingIRQ(I2C_EEI_IRQn);
+            NVIC_SetPriority(I2C_EEI_IRQn, pstcInit->u32IrqPriority);
+            NVIC_EnableIRQ(I2C_EEI_IRQn);
+
+            I2C_Cmd(I2C_REGMAP_UNIT, Enable);
+            I2C_IntCmd(I2C_REGMAP_UNIT, I2C_INT_MATCH_ADDR0, Enable);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the register map slave and release CM_I2C.
+ * @param  None
+ * @retval None
+ */
+void I2C_REGMAP_DeInit(void)
+{
+    NVIC_DisableIRQ(I2C_RXI_IRQn);
+    NVIC_DisableIRQ(I2C_TEI_IRQn);
+    NVIC_DisableIRQ(I2C_EEI_IRQn);
+
+    if (m_u32DmaCh != I2C_REGMAP_DMA_NONE)
+    {
+        NVIC_DisableIRQ((IRQn_Type)((uint32_t)DMA_TC0_IRQn + m_u32DmaCh));
+        DMA_ChCmd(I2C_REGMAP_DMA_UNIT, m_u32DmaCh, Disable);
+        DMA_TransIntCmd(I2C_REGMAP_DMA_UNIT, (DMA_INT_TC0 << m_u32DmaCh), Disable);
+    }
+
+    I2C_DeInit(I2C_REGMAP_UNIT);
+    m_u32State = I2C_REGMAP_STATE_IDLE;
+    m_pu8RegFile = NULL;
+    m_u32RegNum = 0UL;
+}
+
+/**
+ * @brief  Update registers from the application side.
+ * @param  [in] u8Reg                   First register to update.
+ * @param  [in] au8Data                 New register values.
+ * @param  [in] u32Len                  Number of registers.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          Registers updated
+ *   @arg  ErrorInvalidParameter:       Range outside the register file
+ *   @arg  OperationInProgress:         A master read is running, retry later so
+ *                                      the master never sees a half updated value
+ * @note   Register access regions only restrict the master, not this function.
+ */
+en_result_t I2C_REGMAP_Update(uint8_t u8Reg, const uint8_t au8Data[], uint32_t u32Len)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((au8Data != NULL) && (m_pu8RegFile != NULL) &&
+        (((uint32_t)u8Reg + u32Len) <= m_u32RegNum))
+    {
+        /* Hold off address match while copying, the master is clock stretched */
+        NVIC_DisableIRQ(I2C_EEI_IRQn);
+        if (m_u32State == I2C_REGMAP_STATE_READ)
+        {
+            enRet = OperationInProgress;
+        }
+        else
+        {
+            (void)memcpy(&m_pu8RegFile[u8Reg], au8Data, u32Len);
+            enRet = Ok;
+        }
+        NVIC_EnableIRQ(I2C_EEI_IRQn);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the transaction status.
+ * @param  None
+ * @retval An en_flag_status_t enumeration value:
+ *   @arg  Set:                         A master transaction is in progress
+ *   @arg  Reset:                       Idle
+ */
+en_flag_status_t I2C_REGMAP_GetBusyStatus(void)
+{
+    return (m_u32State == I2C_REGMAP_STATE_IDLE) ? Reset : Set;
+}
+
+/**
+ * @brief  I2C EEI (address match, NACK, STOP) interrupt handler.
+ * @param  None
+ * @retval None
+ * @note   Call from I2C_Error_IrqHandler().
+ */
+void I2C_REGMAP_EEI_IrqHandler(void)
+{
+    uint32_t u32Run;
+
+    if (Set == I2C_GetStatus(I2C_REGMAP_UNIT, I2C_FLAG_MATCH_ADDR0))
+    {
+        I2C_ClearStatus(I2C_REGMAP_UNIT, I2C_FLAG_MATCH_ADDR0 | I2C_FLAG_NACKF);
+
+        if (Set == I2C_GetStatus(I2C_REGMAP_UNIT, I2C_FLAG_TRA))
+        {
+            /* Master read */
+            m_u32State = I2C_REGMAP_STATE_READ;
+            m_u32TxReg = m_u32RegPtr;
+            m_u32TxCount = 0UL;
+            m_u32DmaLen = 0UL;
+            m_u32TxSent = 0UL;
+            I2C_IntCmd(I2C_REGMAP_UNIT, I2C_INT_STOP | I2C_INT_NACK, Enable);
+
+            /* DTR is already empty: the first byte is loaded by the CPU */
+            TxNextByte();
+
+            u32Run = ReadableRun(m_u32TxReg);
+            if ((m_u32DmaCh != I2C_REGMAP_DMA_NONE) && (u32Run != 0UL))
+            {
+                m_u32DmaLen = u32Run;
+                DMA_SetSrcAddr(I2C_REGMAP_DMA_UNIT, m_u32DmaCh, (uint32_t)&m_pu8RegFile[m_u32TxReg]);
+                DMA_SetTransCount(I2C_REGMAP_DMA_UNIT, m_u32DmaCh, (uint16_t)u32Run);
+                DMA_ChCmd(I2C_REGMAP_DMA_UNIT, m_u32DmaCh, Enable);
+                m_u32TxReg = RegAdvance(m_u32TxReg, u32Run);
+            }
+            else
+            {
+                I2C_IntCmd(I2C_REGMAP_UNIT, I2C_INT_TX_CPLT, Enable);
+            }
+        }
+        else
+        {
+            /* Master write */
+            m_u32State = I2C_REGMAP_STATE_WRITE_PTR;
+            m_u32WriteCount = 0UL;
+            I2C_IntCmd(I2C_REGMAP_UNIT, I2C_INT_RX_FULL | I2C_INT_STOP | I2C_INT_NACK, Enable);
+        }
+    }
+
+    if (Set == I2C_GetStatus(I2C_REGMAP_UNIT, I2C_FLAG_NACKF))
+    {
+        I2C_ClearStatus(I2C_REGMAP_UNIT, I2C_FLAG_NACKF);
+        if (Set == I2C_GetStatus(I2C_REGMAP_UNIT, I2C_FLAG_TRA))
+        {
+            ReadEnd();
+            I2C_IntCmd(I2C_REGMAP_UNIT, I2C_INT_TX_CPLT, Disable);
+            I2C_ClearStatus(I2C_REGMAP_UNIT, I2C_FLAG_TX_CPLT);
+            /* Read DRR register to release SCL */
+            (void)I2C_ReadData(I2C_REGMAP_UNIT);
+        }
+        else
+        {
+            I2C_IntCmd(I2C_REGMAP_UNIT, I2C_INT_RX_FULL, Disable);
+        }
+    }
+
+    if (Set == I2C_GetStatus(I2C_REGMAP_UNIT, I2C_FLAG_STOP))
+    {
+        I2C_IntCmd(I2C_REGMAP_UNIT,
+                   I2C_INT_TX_CPLT | I2C_INT_RX_FULL | I2C_INT_STOP | I2C_INT_NACK,
+                   Disable);
+        I2C_ClearStatus(I2C_REGMAP_UNIT, I2C_FLAG_STOP);
+
+        if (m_u32State == I2C_REGMAP_STATE_READ)
+        {
+            if (m_u32TxSent == 0UL)
+            {
+                /* STOP without NACK */
+                ReadEnd();
+            }
+            m_u32RegPtr = RegAdvance(m_u32RegPtr, m_u32TxSent);
+        }
+        else if (m_u32State == I2C_REGMAP_STATE_WRITE_DATA)
+        {
+            if ((m_u32WriteCount != 0UL) && (m_pfnWriteCallback != NULL))
+            {
+                m_pfnWriteCallback((uint8_t)m_u32WriteStart,
+                                   (m_u32WriteCount < m_u32RegNum) ? m_u32WriteCount : m_u32RegNum);
+            }
+        }
+        else
+        {
+            /* Address only or pointer only transaction */
+        }
+        m_u32State = I2C_REGMAP_STATE_IDLE;
+    }
+}
+
+/**
+ * @brief  I2C RXI (receive buffer full) interrupt handler.
+ * @param  None
+ * @retval None
+ * @note   Call from I2C_RxEnd_IrqHandler().
+ */
+void I2C_REGMAP_RXI_IrqHandler(void)
+{
+    uint8_t u8Data;
+
+    if (Set == I2C_GetStatus(I2C_REGMAP_UNIT, I2C_FLAG_RX_FULL))
+    {
+        u8Data = I2C_ReadData(I2C_REGMAP_UNIT);
+
+        if (m_u32State == I2C_REGMAP_STATE_WRITE_PTR)
+        {
+            m_u32RegPtr = (uint32_t)u8Data;
+            m_u32WriteStart = m_u32RegPtr;
+            m_u32State = I2C_REGMAP_STATE_WRITE_DATA;
+        }
+        else if (m_u32State == I2C_REGMAP_STATE_WRITE_DATA)
+        {
+            if ((m_u32RegPtr < m_u32RegNum) && (!I2C_REGMAP_MASK_TEST(m_au32RoMask, m_u32RegPtr)))
+            {
+                m_pu8RegFile[m_u32RegPtr] = u8Data;
+            }
+            m_u32WriteCount++;
+            m_u32RegPtr = RegAdvance(m_u32RegPtr, 1UL);
+        }
+        else
+        {
+            /* Unexpected data, discard */
+        }
+    }
+}
+
+/**
+ * @brief  I2C TEI (transfer end) interrupt handler.
+ * @param  None
+ * @retval None
+ * @note   Call from I2C_TxEnd_IrqHandler(). Only enabled while the master reads
+ *         registers that are not served by the DMA.
+ */
+void I2C_REGMAP_TEI_IrqHandler(void)
+{
+    if (Reset == I2C_GetStatus(I2C_REGMAP_UNIT, I2C_FLAG_ACKR))
+    {
+        TxNextByte();
+    }
+}
+
+/**
+ * @brief  DMA transfer complete interrupt handler.
+ * @param  None
+ * @retval None
+ * @note   Call from DMA_TCx_IrqHandler() of the channel given by u32DmaCh.
+ *         The readable block is exhausted, the rest of the read is fed by the
+ *         TEI interrupt.
+ */
+void I2C_REGMAP_DmaTc_IrqHandler(void)
+{
+    if (m_u32DmaCh != I2C_REGMAP_DMA_NONE)
+    {
+        DMA_ClearTransIntStatus(I2C_REGMAP_DMA_UNIT, (DMA_INT_TC0 << m_u32DmaCh));
+        if ((m_u32State == I2C_REGMAP_STATE_READ) && (m_u32TxSent == 0UL))
+        {
+            I2C_IntCmd(I2C_REGMAP_UNIT, I2C_INT_TX_CPLT, Enable);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2C_REGMAP_Local_Functions I2C_REGMAP Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Advance a register pointer with wrap around.
+ * @param  [in] u32Reg                  Register pointer.
+ * @param  [in] u32Step                 Number of registers to advance.
+ * @retval New register pointer
+ */
+static uint32_t RegAdvance(uint32_t u32Reg, uint32_t u32Step)
+{
+    uint32_t u32Next;
+
+    if (u32Reg < m_u32RegNum)
+    {
+        u32Next = (u32Reg + u32Step) % m_u32RegNum;
+    }
+    else
+    {
+        /* Pointer set outside the register file by the master */
+        u32Next = (u32Reg + u32Step) & (I2C_REGMAP_REG_NUM_MAX - 1UL);
+    }
+
+    return u32Next;
+}
+
+/**
+ * @brief  Number of consecutive readable registers from u32Reg to the end of
+ *         the register file.
+ * @param  [in] u32Reg                  First register.
+ * @retval Number of registers
+ */
+static uint32_t ReadableRun(uint32_t u32Reg)
+{
+    uint32_t u32Run = 0UL;
+
+    while (((u32Reg + u32Run) < m_u32RegNum) &&
+           (!I2C_REGMAP_MASK_TEST(m_au32WoMask, u32Reg + u32Run)))
+    {
+        u32Run++;
+    }
+
+    return u32Run;
+}
+
+/**
+ * @brief  Load the next register into DTR.
+ * @param  None
+ * @retval None
+ */
+static void TxNextByte(void)
+{
+    uint8_t u8Data = I2C_REGMAP_READ_FILL;
+
+    if ((m_u32TxReg < m_u32RegNum) && (!I2C_REGMAP_MASK_TEST(m_au32WoMask, m_u32TxReg)))
+    {
+        u8Data = m_pu8RegFile[m_u32TxReg];
+    }
+    I2C_WriteData(I2C_REGMAP_UNIT, u8Data);
+    m_u32TxReg = RegAdvance(m_u32TxReg, 1UL);
+    m_u32TxCount++;
+}
+
+/**
+ * @brief  Stop feeding DTR and compute how many registers the master read.
+ * @param  None
+ * @retval None
+ */
+static void ReadEnd(void)
+{
+    uint32_t u32Loaded = m_u32TxCount;
+
+    if (m_u32DmaLen != 0UL)
+    {
+        DMA_ChCmd(I2C_REGMAP_DMA_UNIT, m_u32DmaCh, Disable);
+        u32Loaded += m_u32DmaLen - (uint32_t)DMA_GetTransCount(I2C_REGMAP_DMA_UNIT, m_u32DmaCh);
+    }
+
+    /* A byte still waiting in DTR was never shifted out */
+    if ((u32Loaded != 0UL) && (Reset == I2C_GetStatus(I2C_REGMAP_UNIT, I2C_FLAG_TX_EMPTY)))
+    {
+        u32Loaded--;
+    }
+
+    m_u32TxSent = u32Loaded;
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_I2C_REGMAP_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Add direct vector mode
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -24,6 +25,9 @@
  ******************************************************************************/
 #include "hc32m423_interrupts.h"
 #include "hc32m423_utility.h"
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+#include "hc32m423_ramfunc.h"
+#endif /* DDL_RAMFUNC_ENABLE */
 
 /**
  * @addtogroup HC32M423_DDL_Driver
@@ -54,6 +58,13 @@
  */
 #define IRQ_NUM_MAX             (8U)
 
+/**
+ * @brief Direct vector mode
+ */
+#define INTC_VECTOR_OFFSET      (16UL)
+#define INTC_VECTOR_REG_NUM     (4UL)
+#define INTC_BENCH_LOOP         (8UL)
+
 /**
  * @brief Wakeup event enable mask
  */
@@ -184,6 +195,11 @@
     ((trigger) == EXTINT_TRIG_FALLING)          ||                              \
     ((trigger) == EXTINT_TRIG_BOTH))
 
+/*  Parameter validity check for a fixed IRQ of the direct vector mode. */
+#define IS_INTC_VECTOR_IRQN(irqn)                                               \
+(   ((irqn) > INT007_IRQn)                      &&                              \
+    ((irqn) <= ADC_SEQCMP_IRQn))
+
 /*  Parameter validity check for EXTINT channel. */
 #define IS_EXTINT_CH(ch)     (((ch) & EXTINT_CH_MASK) != (uint8_t)0x00U)
 
@@ -208,10 +224,28 @@
  */
 static func_ptr_t m_apfnIrqHandler[IRQ_NUM_MAX] = {NULL};
 static func_ptr_t m_pfnNmiCallback;
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+static uint32_t m_u32DirectVector = 0UL;
+/* The direct vector mode relocated the vector table itself */
+static uint32_t m_u32DirectRelocated = 0UL;
+/* Fixed IRQs installed by INTC_VectorSignIn(), bit n for IRQ n */
+static uint32_t m_au32DirectFixed[INTC_VECTOR_REG_NUM];
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+static volatile uint32_t m_u32BenchEnd = 0UL;
+#endif /* DDL_UTILITY_ENABLE */
+#endif /* DDL_RAMFUNC_ENABLE */
 /**
  * @}
  */
 
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+static void INTC_VectorWrite(IRQn_Type enIRQn, func_ptr_t pfnHandler);
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+static uint32_t INTC_BenchMeasure(IRQn_Type enIRQn);
+static void INTC_BenchCallback(void);
+#endif /* DDL_UTILITY_ENABLE */
+#endif /* DDL_RAMFUNC_ENABLE */
+
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
@@ -229,6 +263,8 @@ static func_ptr_t m_pfnNmiCallback;
  *   @arg  enIntSrc: can be any value @ref en_int_src_t
  *   @arg  enIRQn: can be any value from Int000~Int007 @ref IRQn_Type
  *   @arg  pfnCallback: Callback function
+ * @note   In the direct vector mode the callback is installed in the vector
+ *         table and IRQ00x_Handler() is bypassed.
  * @retval An en_result_t enumeration value
  *         Ok: IRQ register successfully
  *         ErrorInvalidParameter: ErrorInvalidParameter: IRQ No. is out of range;
@@ -266,6 +302,12 @@ en_result_t INTC_IrqSignIn(const stc_irq_signin_config_t *pstcIrqSignConfig)
         {
             enRet = ErrorUninitialized;
         }
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+        if (Ok == enRet)
+        {
+            INTC_VectorWrite(pstcIrqSignConfig->enIRQn, pstcIrqSignConfig->pfnCallback);
+        }
+#endif /* DDL_RAMFUNC_ENABLE */
     }
     return enRet;
 }
@@ -291,6 +333,12 @@ en_result_t INTC_IrqSignOut(IRQn_Type enIRQn)
         INTC_SELx = (uint32_t *)((uint32_t)(&CM_INTC->SEL0) + (4UL * (uint32_t)enIRQn));
         WRITE_REG32(*INTC_SELx, 0x1FFUL);
         m_apfnIrqHandler[enIRQn] = NULL;
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+        if (0UL != m_u32DirectVector)
+        {
+            RAMFUNC_VectorResetEntry(INTC_VECTOR_OFFSET + (uint32_t)enIRQn);
+        }
+#endif /* DDL_RAMFUNC_ENABLE */
     }
     return enRet;
 }
@@ -454,6 +502,270 @@ void INTC_SWIntCmd(uint32_t u32SWInt, en_functional_state_t enNewState)
     }
 }
 
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+/**
+ * @brief  Direct vector mode function
+ * @param  [in] enNewState
+ *   @arg  Enable: Relocate the vector table to RAM and install the callbacks
+ *                 of Int000~Int007 as vectors
+ *   @arg  Disable: The installed vectors point to IRQ0xx_Handler() again.
+ *                  VTOR is switched back only if the enable relocated the
+ *                  table; a table relocated by the application stays in RAM
+ * @retval None
+ * @note   An interrupt is dispatched as IRQ0xx_Handler() -> callback or weak
+ *         *_IrqHandler(). In the direct vector mode the vector points to the
+ *         handler registered by INTC_IrqSignIn() or INTC_VectorSignIn(), so
+ *         the intermediate call and the callback table read are removed. The
+ *         vector table is shared with DDL_RAMFUNC.
+ */
+void INTC_DirectVectorCmd(en_functional_state_t enNewState)
+{
+    uint32_t i;
+
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+
+    if (Enable == enNewState)
+    {
+        if (0UL == m_u32DirectVector)
+        {
+            m_u32DirectRelocated = (NULL == RAMFUNC_GetVectorTable()) ? 1UL : 0UL;
+            for (i = 0UL; i < INTC_VECTOR_REG_NUM; i++)
+            {
+                m_au32DirectFixed[i] = 0UL;
+            }
+        }
+        RAMFUNC_VectorRelocate();
+        m_u32DirectVector = 1UL;
+        for (i = 0UL; i < IRQ_NUM_MAX; i++)
+        {
+            if (NULL != m_apfnIrqHandler[i])
+            {
+                INTC_VectorWrite((IRQn_Type)i, m_apfnIrqHandler[i]);
+            }
+        }
+    }
+    else if (0UL != m_u32DirectVector)
+    {
+        if (0UL != m_u32DirectRelocated)
+        {
+            RAMFUNC_VectorRestore();
+        }
+        else
+        {
+            /* The table was relocated by the application, only undo the installed vectors */
+            for (i = 0UL; i < IRQ_NUM_MAX; i++)
+            {
+                if (NULL != m_apfnIrqHandler[i])
+                {
+                    RAMFUNC_VectorResetEntry(INTC_VECTOR_OFFSET + i);
+                }
+            }
+            for (i = 0UL; i < (INTC_VECTOR_REG_NUM * 32UL); i++)
+            {
+                if (0UL != (m_au32DirectFixed[i / 32UL] & (1UL << (i % 32UL))))
+                {
+                    RAMFUNC_VectorResetEntry(INTC_VECTOR_OFFSET + i);
+                }
+            }
+        }
+        m_u32DirectVector = 0UL;
+        m_u32DirectRelocated = 0UL;
+    }
+    else
+    {
+        /* Already disabled */
+    }
+}
+
+/**
+ * @brief  Install a handler in the vector of a fixed IRQ
+ * @param  [in] enIRQn can be any value from Int008~Int100 @ref IRQn_Type
+ * @param  [in] pfnHandler Handler, it clears the interrupt flags as the
+ *                         corresponding weak *_IrqHandler() does
+ * @retval An en_result_t enumeration value
+ *         Ok: Handler installed
+ *         ErrorInvalidParameter: IRQ No. is out of range; NULL pointer
+ *         ErrorInvalidMode: The direct vector mode is disabled
+ * @note   Int000~Int007 are registered by INTC_IrqSignIn(), which selects
+ *         the interrupt source too.
+ */
+en_result_t INTC_VectorSignIn(IRQn_Type enIRQn, func_ptr_t pfnHandler)
+{
+    en_result_t enRet = Ok;
+
+    if ((!IS_INTC_VECTOR_IRQN(enIRQn)) || (NULL == pfnHandler))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else if (0UL == m_u32DirectVector)
+    {
+        enRet = ErrorInvalidMode;
+    }
+    else
+    {
+        INTC_VectorWrite(enIRQn, pfnHandler);
+        m_au32DirectFixed[(uint32_t)enIRQn / 32UL] |= (1UL << ((uint32_t)enIRQn % 32UL));
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Restore the vector of a fixed IRQ
+ * @param  [in] enIRQn can be any value from Int008~Int100 @ref IRQn_Type
+ * @retval An en_result_t enumeration value
+ *         Ok: The vector points to IRQ0xx_Handler() again
+ *         ErrorInvalidParameter: IRQ No. is out of range
+ *         ErrorInvalidMode: The direct vector mode is disabled
+ */
+en_result_t INTC_VectorSignOut(IRQn_Type enIRQn)
+{
+    en_result_t enRet = Ok;
+
+    if (!IS_INTC_VECTOR_IRQN(enIRQn))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else if (0UL == m_u32DirectVector)
+    {
+        enRet = ErrorInvalidMode;
+    }
+    else
+    {
+        RAMFUNC_VectorResetEntry(INTC_VECTOR_OFFSET + (uint32_t)enIRQn);
+        m_au32DirectFixed[(uint32_t)enIRQn / 32UL] &= ~(1UL << ((uint32_t)enIRQn % 32UL));
+    }
+    return enRet;
+}
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+/**
+ * @brief  Measure the interrupt latency of the two vector modes
+ * @param  [in] enIRQn A free IRQ from Int000~Int007 @ref IRQn_Type, it is
+ *                     pended by software
+ * @param  [out] pstcBench Pointer to a stc_intc_vector_bench_t structure
+ * @retval An en_result_t enumeration value
+ *         Ok: Measured
+ *         ErrorInvalidParameter: IRQ No. is out of range or signed in; NULL pointer
+ *         ErrorInvalidMode: The direct vector mode is disabled
+ * @note   Cycles from pending the interrupt to the first access of the
+ *         callback, the minimum of INTC_BENCH_LOOP runs. Both modes use the
+ *         RAM vector table, so the difference is the IRQ00x_Handler()
+ *         dispatch. Call it with interrupts enabled, the IRQ is set to
+ *         priority 0 during the measurement and restored afterwards.
+ */
+en_result_t INTC_DirectVectorBenchmark(IRQn_Type enIRQn, stc_intc_vector_bench_t *pstcBench)
+{
+    __IO uint32_t *INTC_SELx;
+    en_result_t enRet = Ok;
+    uint32_t u32Prio;
+    uint32_t u32Enabled;
+
+    if ((NULL == pstcBench) || (enIRQn < INT000_IRQn) || (enIRQn > INT007_IRQn))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else if (0UL == m_u32DirectVector)
+    {
+        enRet = ErrorInvalidMode;
+    }
+    else
+    {
+        INTC_SELx = (uint32_t *)((uint32_t)(&CM_INTC->SEL0) + (4UL * (uint32_t)enIRQn));
+        if ((NULL != m_apfnIrqHandler[enIRQn]) || (0x1FFUL != ((*INTC_SELx) & 0x1FFUL)))
+        {
+            enRet = ErrorInvalidParameter;
+        }
+        else
+        {
+            u32Prio = NVIC_GetPriority(enIRQn);
+            u32Enabled = NVIC_GetEnableIRQ(enIRQn);
+            NVIC_ClearPendingIRQ(enIRQn);
+            NVIC_SetPriority(enIRQn, DDL_IRQ_PRI00);
+            NVIC_EnableIRQ(enIRQn);
+
+            /* IRQ00x_Handler() -> m_apfnIrqHandler[] -> callback */
+            m_apfnIrqHandler[enIRQn] = &INTC_BenchCallback;
+            RAMFUNC_VectorResetEntry(INTC_VECTOR_OFFSET + (uint32_t)enIRQn);
+            pstcBench->u32Dispatch = INTC_BenchMeasure(enIRQn);
+
+            /* Vector -> callback */
+            INTC_VectorWrite(enIRQn, &INTC_BenchCallback);
+            pstcBench->u32Direct = INTC_BenchMeasure(enIRQn);
+
+            NVIC_DisableIRQ(enIRQn);
+            NVIC_ClearPendingIRQ(enIRQn);
+            NVIC_SetPriority(enIRQn, u32Prio);
+            if (0UL != u32Enabled)
+            {
+                NVIC_EnableIRQ(enIRQn);
+            }
+            m_apfnIrqHandler[enIRQn] = NULL;
+            RAMFUNC_VectorResetEntry(INTC_VECTOR_OFFSET + (uint32_t)enIRQn);
+        }
+    }
+    return enRet;
+}
+#endif /* DDL_UTILITY_ENABLE */
+
+/**
+ * @brief  Write a vector of the RAM vector table in the direct vector mode
+ * @param  [in] enIRQn IRQ No. @ref IRQn_Type
+ * @param  [in] pfnHandler Handler
+ * @retval None
+ */
+static void INTC_VectorWrite(IRQn_Type enIRQn, func_ptr_t pfnHandler)
+{
+    uint32_t *pu32Vector;
+
+    if (0UL != m_u32DirectVector)
+    {
+        pu32Vector = RAMFUNC_GetVectorTable();
+        if (NULL != pu32Vector)
+        {
+            pu32Vector[INTC_VECTOR_OFFSET + (uint32_t)enIRQn] = (uint32_t)pfnHandler;
+            __DSB();
+        }
+    }
+}
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+/**
+ * @brief  Pend an IRQ and get the minimum cycles to the benchmark callback
+ * @param  [in] enIRQn IRQ No. @ref IRQn_Type
+ * @retval Cycles
+ */
+static uint32_t INTC_BenchMeasure(IRQn_Type enIRQn)
+{
+    uint32_t u32Min = 0xFFFFFFFFUL;
+    uint32_t u32Start;
+    uint32_t i;
+
+    for (i = 0UL; i < INTC_BENCH_LOOP; i++)
+    {
+        u32Start = DDL_GetCycleCount();
+        NVIC_SetPendingIRQ(enIRQn);
+        __DSB();
+        __ISB();
+        if ((m_u32BenchEnd - u32Start) < u32Min)
+        {
+            u32Min = m_u32BenchEnd - u32Start;
+        }
+    }
+    return u32Min;
+}
+
+/**
+ * @brief  Benchmark callback
+ * @param  None
+ * @retval None
+ */
+static void INTC_BenchCallback(void)
+{
+    m_u32BenchEnd = READ_REG32(DWT->CYCCNT);
+}
+#endif /* DDL_UTILITY_ENABLE */
+#endif /* DDL_RAMFUNC_ENABLE */
+
 /**
  * @brief  Initialize NMI. Fill each pstcNmiInit with default value
  * @param  [in] pstcNmiInit Pointer to a stc_nmi_init_t structure that
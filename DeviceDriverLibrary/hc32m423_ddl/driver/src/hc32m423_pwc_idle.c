@@ -0,0 +1,569 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_pwc_idle.c
+ * @brief This file provides firmware functions to idle in sleep or stop mode
+ *        with the SysTick interrupt suspended.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_pwc_idle.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_pwc.h"
+#include "hc32m423_swdt.h"
+#include "hc32m423_tmr0.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_PWC_IDLE PWC_IDLE
+ * @brief Tickless Idle Driver Library
+ * @details PWC_IDLE_Enter() is called from the idle loop. It asks the
+ *          application for the next deadline and picks the deepest mode
+ *          whose wake latency is within the limit set by
+ *          PWC_IDLE_SetLatencyLimit():
+ *          - Short idle: sleep mode with SysTick running.
+ *          - Idle of at least u32MinIdleTick periods: the SysTick interrupt
+ *            is suspended and a TMR0 channel, which keeps counting in sleep
+ *            mode, wakes the CPU just before the deadline.
+ *          - Idle longer than the SWDT period: stop mode. PCLK stops, so the
+ *            SWDT, counting on its own LRC, is the wake timer. Its period is
+ *            fixed by ICG, so stop mode is only used when the deadline is
+ *            at least one SWDT period away.
+ *          Any other enabled interrupt ends the idle early. On wake the
+ *          elapsed time is read back from the wake timer and added to the
+ *          tick count with SysTick_AddTick(). The SysTick counter keeps
+ *          running in sleep mode and is frozen in stop mode, so its phase
+ *          is kept and the tick count does not drift.
+ *          The application must unlock the PWC registers, enable the TMR0
+ *          and SWDT function clocks, and configure ICG for the SWDT to
+ *          interrupt, keep counting in stop mode and accept a refresh at
+ *          any time (ICG_SWDT_RANGE_0TO100PCT).
+ * @{
+ */
+
+#if (DDL_PWC_IDLE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Local_Macros PWC_IDLE Local Macros
+ * @{
+ */
+#define PWC_IDLE_TMR0_CNT_MAX           (0x10000UL)
+#define PWC_IDLE_TMR0_CNT_PER_TICK_MIN  (8UL)
+#define PWC_IDLE_TMR0_CLK_DIV_NUM       (11UL)
+#define PWC_IDLE_US_PER_SEC             (1000000UL)
+
+/**
+ * @defgroup PWC_IDLE_Check_Parameters_Validity PWC_IDLE Check Parameters Validity
+ * @{
+ */
+#define IS_PWC_IDLE_TMR0_UNIT(x)                                               \
+(   ((x) == CM_TMR0_1)                          ||                             \
+    ((x) == CM_TMR0_2))
+
+#define IS_PWC_IDLE_TMR0_CH(x)                                                 \
+(   ((x) == TMR0_CH_A)                          ||                             \
+    ((x) == TMR0_CH_B))
+
+#define IS_PWC_IDLE_SWDT_PERIOD(x)                                             \
+(   ((x) == 256UL)                              ||                             \
+    ((x) == 4096UL)                             ||                             \
+    ((x) == 16384UL)                            ||                             \
+    ((x) == 65536UL))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup PWC_IDLE_Local_Functions
+ * @{
+ */
+static uint32_t PWC_IDLE_SelectMode(uint32_t u32Deadline);
+static void PWC_IDLE_SleepTickless(uint32_t u32Deadline);
+static void PWC_IDLE_Stop(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Local_Variables PWC_IDLE Local Variables
+ * @{
+ */
+static stc_pwc_idle_init_t m_stcCfg;
+static IRQn_Type m_enTmr0IRQn;
+/* Wake timer frequency, 0 while not initialized */
+static uint32_t m_u32Tmr0Freq = 0UL;
+static uint32_t m_u32SleepLatencyCnt = 0UL;
+/* Shortest deadline that allows stop mode, in ticks */
+static uint32_t m_u32StopMinTick = 0UL;
+/* Fraction of a tick left over from stop mode, in 1 / u32SwdtClkFreq ticks */
+static uint32_t m_u32StopRemain = 0UL;
+static uint32_t m_u32LatencyLimit = PWC_IDLE_NO_LIMIT;
+static stc_pwc_idle_stat_t m_stcStat;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Global_Functions PWC_IDLE Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_pwc_idle_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_pwc_idle_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ * @note   Stop mode is disabled by default.
+ */
+en_result_t PWC_IDLE_StructInit(stc_pwc_idle_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32TickFreq = 1000UL;
+        pstcInit->pstcTmr0 = CM_TMR0_2;
+        pstcInit->u32Tmr0Ch = TMR0_CH_A;
+        pstcInit->u32SleepLatency = 1UL;
+        pstcInit->u32StopLatency = 100UL;
+        pstcInit->u32SwdtClkFreq = 0UL;
+        pstcInit->u32SwdtPeriod = 256UL;
+        pstcInit->u32MinIdleTick = 2UL;
+        pstcInit->pfnGetDeadline = NULL;
+        pstcInit->pfnStopEnter = NULL;
+        pstcInit->pfnStopExit = NULL;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI03;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the wake timers.
+ * @param  [in] pstcInit                Pointer to a stc_pwc_idle_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid parameter, or PCLK1 too slow
+ *                                      for 8 TMR0 counts per tick
+ */
+en_result_t PWC_IDLE_Init(const stc_pwc_idle_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_clock_freq_t stcClkFreq;
+    stc_tmr0_init_t stcTmr0Init;
+    uint32_t u32Div;
+    uint32_t u32Freq = 0UL;
+
+    if ((pstcInit != NULL) && (pstcInit->u32TickFreq != 0UL) && (pstcInit->u32MinIdleTick >= 2UL))
+    {
+        DDL_ASSERT(IS_PWC_IDLE_TMR0_UNIT(pstcInit->pstcTmr0));
+        DDL_ASSERT(IS_PWC_IDLE_TMR0_CH(pstcInit->u32Tmr0Ch));
+        DDL_ASSERT((pstcInit->u32SwdtClkFreq == 0UL) || IS_PWC_IDLE_SWDT_PERIOD(pstcInit->u32SwdtPeriod));
+
+        /* Slowest clock that still resolves a tick: longest sleep per wake */
+        (void)CLK_GetClockFreq(&stcClkFreq);
+        for (u32Div = PWC_IDLE_TMR0_CLK_DIV_NUM; u32Div > 0UL; u32Div--)
+        {
+            u32Freq = stcClkFreq.u32Pclk1Freq >> (u32Div - 1UL);
+            if ((u32Freq / pstcInit->u32TickFreq) >= PWC_IDLE_TMR0_CNT_PER_TICK_MIN)
+            {
+                enRet = Ok;
+                break;
+            }
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        m_stcCfg = *pstcInit;
+        m_u32Tmr0Freq = u32Freq;
+        m_u32SleepLatencyCnt = (uint32_t)(((uint64_t)m_stcCfg.u32SleepLatency * u32Freq) / PWC_IDLE_US_PER_SEC);
+        m_u32StopMinTick = PWC_IDLE_NO_DEADLINE;
+        if (m_stcCfg.u32SwdtClkFreq != 0UL)
+        {
+            m_u32StopMinTick = (uint32_t)(((((uint64_t)m_stcCfg.u32SwdtPeriod * m_stcCfg.u32TickFreq) +
+                                            m_stcCfg.u32SwdtClkFreq) - 1UL) / m_stcCfg.u32SwdtClkFreq);
+            m_u32StopMinTick += (uint32_t)(((((uint64_t)m_stcCfg.u32StopLatency * m_stcCfg.u32TickFreq) +
+                                             PWC_IDLE_US_PER_SEC) - 1UL) / PWC_IDLE_US_PER_SEC);
+        }
+        m_u32StopRemain = 0UL;
+        m_u32LatencyLimit = PWC_IDLE_NO_LIMIT;
+        m_stcStat.u32SleepNum = 0UL;
+        m_stcStat.u32TicklessNum = 0UL;
+        m_stcStat.u32StopNum = 0UL;
+        m_stcStat.u32TickSkipped = 0UL;
+
+        (void)TMR0_StructInit(&stcTmr0Init);
+        stcTmr0Init.u32ClockSrc = TMR0_SYNC_CLK_PCLK;
+        stcTmr0Init.u32ClockDiv = (u32Div - 1UL) << TMR0_BCONR_CKDIVA_POS;
+        stcTmr0Init.u16PeriodValue = 0xFFFFU;
+        TMR0_Stop(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+        (void)TMR0_Init(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch, &stcTmr0Init);
+        TMR0_ClearStatus(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+        TMR0_IntCmd(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch, Enable);
+
+        m_enTmr0IRQn = (IRQn_Type)((uint32_t)TMR0_1_GCMA_IRQn + m_stcCfg.u32Tmr0Ch +
+                                   ((m_stcCfg.pstcTmr0 == CM_TMR0_2) ? 2UL : 0UL));
+        NVIC_ClearPendingIRQ(m_enTmr0IRQn);
+        NVIC_SetPriority(m_enTmr0IRQn, m_stcCfg.u32IrqPriority);
+        NVIC_EnableIRQ(m_enTmr0IRQn);
+
+        if (m_stcCfg.u32SwdtClkFreq != 0UL)
+        {
+            INTC_WakeupSrcCmd(INTC_WUPEN_SWDTWUEN, Enable);
+            NVIC_ClearPendingIRQ(SWDT_IRQn);
+            NVIC_SetPriority(SWDT_IRQn, m_stcCfg.u32IrqPriority);
+            NVIC_EnableIRQ(SWDT_IRQn);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Release the wake timers.
+ * @param  None
+ * @retval None
+ */
+void PWC_IDLE_DeInit(void)
+{
+    if (m_u32Tmr0Freq != 0UL)
+    {
+        TMR0_Stop(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+        TMR0_IntCmd(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch, Disable);
+        TMR0_ClearStatus(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+        NVIC_DisableIRQ(m_enTmr0IRQn);
+        if (m_stcCfg.u32SwdtClkFreq != 0UL)
+        {
+            INTC_WakeupSrcCmd(INTC_WUPEN_SWDTWUEN, Disable);
+            NVIC_DisableIRQ(SWDT_IRQn);
+        }
+        m_u32Tmr0Freq = 0UL;
+    }
+}
+
+/**
+ * @brief  Limit the wake latency, e.g. while a peripheral needs a fast
+ *         response or its clock kept running.
+ * @param  [in] u32Latency              Longest acceptable wake latency in us,
+ *                                      PWC_IDLE_NO_LIMIT for none.
+ * @retval None
+ * @note   A limit below u32SleepLatency keeps the CPU running.
+ */
+void PWC_IDLE_SetLatencyLimit(uint32_t u32Latency)
+{
+    m_u32LatencyLimit = u32Latency;
+}
+
+/**
+ * @brief  Idle until the next deadline or interrupt.
+ * @param  None
+ * @retval Mode entered, @ref PWC_IDLE_Mode
+ * @note   Call from the idle loop. Interrupts that end the idle are taken
+ *         when this function returns, after the tick count is updated.
+ */
+uint32_t PWC_IDLE_Enter(void)
+{
+    uint32_t u32Mode = PWC_IDLE_MD_RUN;
+    uint32_t u32Deadline;
+    uint32_t u32Primask;
+
+    if (m_u32Tmr0Freq != 0UL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+
+        u32Deadline = PWC_IDLE_NO_DEADLINE;
+        if (m_stcCfg.pfnGetDeadline != NULL)
+        {
+            u32Deadline = m_stcCfg.pfnGetDeadline();
+        }
+
+        /* A pending tick would end the idle at once */
+        if ((u32Deadline != 0UL) && (0UL == (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)))
+        {
+            u32Mode = PWC_IDLE_SelectMode(u32Deadline);
+        }
+
+        switch (u32Mode)
+        {
+            case PWC_IDLE_MD_SLEEP:
+                PWC_EnterSleepMode();
+                m_stcStat.u32SleepNum++;
+                break;
+            case PWC_IDLE_MD_SLEEP_TICKLESS:
+                PWC_IDLE_SleepTickless(u32Deadline);
+                m_stcStat.u32TicklessNum++;
+                break;
+            case PWC_IDLE_MD_STOP:
+                PWC_IDLE_Stop();
+                m_stcStat.u32StopNum++;
+                break;
+            default:
+                break;
+        }
+
+        __set_PRIMASK(u32Primask);
+    }
+
+    return u32Mode;
+}
+
+/**
+ * @brief  Get the idle statistics.
+ * @param  [out] pstcStat               Pointer to a stc_pwc_idle_stat_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcStat == NULL
+ */
+en_result_t PWC_IDLE_GetStatistics(stc_pwc_idle_stat_t *pstcStat)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Primask;
+
+    if (pstcStat != NULL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        *pstcStat = m_stcStat;
+        __set_PRIMASK(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  TMR0 compare interrupt handler of the sleep mode wake timer.
+ * @param  None
+ * @retval None
+ * @note   PWC_IDLE_Enter() normally consumes the wake up itself, the
+ *         handler only clears a late flag.
+ */
+void PWC_IDLE_TMR0_IrqHandler(void)
+{
+    if (m_u32Tmr0Freq != 0UL)
+    {
+        TMR0_ClearStatus(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+    }
+}
+
+/**
+ * @brief  SWDT underflow interrupt handler of the stop mode wake timer.
+ * @param  None
+ * @retval None
+ */
+void PWC_IDLE_SWDT_IrqHandler(void)
+{
+    if (Set == SWDT_GetStatus(SWDT_FLAG_UDF))
+    {
+        (void)SWDT_ClearStatus(SWDT_FLAG_UDF);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWC_IDLE_Local_Functions PWC_IDLE Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Deepest mode allowed by the deadline and the latency limit.
+ * @param  [in] u32Deadline             Ticks until the next deadline, not 0.
+ * @retval Mode, @ref PWC_IDLE_Mode
+ */
+static uint32_t PWC_IDLE_SelectMode(uint32_t u32Deadline)
+{
+    uint32_t u32Mode = PWC_IDLE_MD_RUN;
+
+    if (m_stcCfg.u32SleepLatency <= m_u32LatencyLimit)
+    {
+        u32Mode = PWC_IDLE_MD_SLEEP;
+        if (u32Deadline >= m_stcCfg.u32MinIdleTick)
+        {
+            u32Mode = PWC_IDLE_MD_SLEEP_TICKLESS;
+        }
+        if ((m_stcCfg.u32SwdtClkFreq != 0UL) && (m_stcCfg.u32StopLatency <= m_u32LatencyLimit) &&
+            (u32Deadline >= m_u32StopMinTick))
+        {
+            u32Mode = PWC_IDLE_MD_STOP;
+        }
+    }
+
+    return u32Mode;
+}
+
+/**
+ * @brief  Sleep with the SysTick interrupt suspended, woken by TMR0.
+ * @param  [in] u32Deadline             Ticks until the next deadline.
+ * @retval None
+ */
+static void PWC_IDLE_SleepTickless(uint32_t u32Deadline)
+{
+    const uint32_t u32Load = SysTick->LOAD + 1UL;
+    uint64_t u64Wake;
+    uint32_t u32Phase;
+    uint32_t u32Cnt;
+    uint32_t u32Tick;
+
+    SysTick_Suspend();
+
+    /* TMR0 counts since the last tick, the deadline is a tick boundary */
+    u32Phase = (uint32_t)(((uint64_t)(u32Load - 1UL - SysTick->VAL) * m_u32Tmr0Freq) /
+                          ((uint64_t)u32Load * m_stcCfg.u32TickFreq));
+    u64Wake = ((uint64_t)u32Deadline * m_u32Tmr0Freq) / m_stcCfg.u32TickFreq;
+    if (u64Wake > ((uint64_t)u32Phase + m_u32SleepLatencyCnt + 1UL))
+    {
+        u64Wake -= (uint64_t)u32Phase + m_u32SleepLatencyCnt;
+    }
+    else
+    {
+        u64Wake = 1UL;
+    }
+    if (u64Wake > PWC_IDLE_TMR0_CNT_MAX)
+    {
+        u64Wake = PWC_IDLE_TMR0_CNT_MAX;
+    }
+
+    TMR0_SetCountValue(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch, 0U);
+    TMR0_SetCompareValue(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch, (uint16_t)(u64Wake - 1UL));
+    TMR0_ClearStatus(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+    TMR0_Start(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+
+    PWC_EnterSleepMode();
+
+    TMR0_Stop(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+    u32Cnt = TMR0_GetCountValue(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+    if (Set == TMR0_GetStatus(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch))
+    {
+        /* The counter cleared on the match */
+        u32Cnt += (uint32_t)u64Wake;
+        TMR0_ClearStatus(m_stcCfg.pstcTmr0, m_stcCfg.u32Tmr0Ch);
+    }
+    NVIC_ClearPendingIRQ(m_enTmr0IRQn);
+
+    /* SysTick kept counting, add the periods it completed */
+    u32Tick = (uint32_t)(((uint64_t)(u32Phase + u32Cnt) * m_stcCfg.u32TickFreq) / m_u32Tmr0Freq);
+    SysTick_AddTick(u32Tick);
+    m_stcStat.u32TickSkipped += u32Tick;
+
+    SysTick_Resume();
+}
+
+/**
+ * @brief  Stop mode with the SysTick interrupt suspended, woken by SWDT.
+ * @param  None
+ * @retval None
+ */
+static void PWC_IDLE_Stop(void)
+{
+    uint64_t u64Elapsed;
+    uint32_t u32Cnt;
+    uint32_t u32Tick;
+
+    if (m_stcCfg.pfnStopEnter != NULL)
+    {
+        m_stcCfg.pfnStopEnter();
+    }
+    SysTick_Suspend();
+
+    (void)SWDT_ClearStatus(SWDT_FLAG_UDF);
+    SWDT_Feed();
+
+    PWC_EnterStopMode();
+
+    if (m_stcCfg.pfnStopExit != NULL)
+    {
+        m_stcCfg.pfnStopExit();
+    }
+
+    u32Cnt = m_stcCfg.u32SwdtPeriod;
+    if (Reset == SWDT_GetStatus(SWDT_FLAG_UDF))
+    {
+        /* Woken early by another source */
+        u32Cnt -= SWDT_GetCountValue();
+    }
+    else
+    {
+        (void)SWDT_ClearStatus(SWDT_FLAG_UDF);
+    }
+    NVIC_ClearPendingIRQ(SWDT_IRQn);
+
+    /* SysTick was frozen, add the elapsed time and keep the fraction */
+    u64Elapsed = ((uint64_t)u32Cnt * m_stcCfg.u32TickFreq) + m_u32StopRemain;
+    u32Tick = (uint32_t)(u64Elapsed / m_stcCfg.u32SwdtClkFreq);
+    m_u32StopRemain = (uint32_t)(u64Elapsed % m_stcCfg.u32SwdtClkFreq);
+    SysTick_AddTick(u32Tick);
+    m_stcStat.u32TickSkipped += u32Tick;
+
+    SysTick_Resume();
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_PWC_IDLE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,881 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_pwm_frame.c
+ * @brief This file provides firmware functions for atomic multi-channel
+ *        PWM updates on TMRB and TMRA.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_pwm_frame.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_dma.h"
+#include "hc32m423_tmra.h"
+#include "hc32m423_tmrb.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_PWM_FRAME PWM_FRAME
+ * @brief Atomic Multi-channel PWM Frame Driver Library
+ * @details The period, the duties and the polarities of all channels of a
+ *          timer are staged with PWM_FRAME_SetPeriod(), PWM_FRAME_SetDuty()
+ *          and PWM_FRAME_SetPolarity() and committed together by
+ *          PWM_FRAME_Commit(). A frame is an image of the PERAR, CMPARn
+ *          and PCONRn registers in RAM. On every overflow a DMA linked list
+ *          of three descriptors writes the image of the current frame to
+ *          the registers within PWM_FRAME_GetMinDuty() counts, so all
+ *          channels change at the same period boundary and a commit cannot
+ *          straddle one. Two frames are kept and a commit relinks the last
+ *          descriptor of the current frame to the new one with a single
+ *          word write, the new frame is applied from the second overflow
+ *          after the commit at the latest.
+ *          PWM_FRAME_PlayStart() plays per period compare tables on several
+ *          channels instead, one DMA channel per table, all started at the
+ *          same overflow.
+ *          The counter counts up in sawtooth mode. The application enables
+ *          the timer, AOS and DMA function clocks and sets the PWM pin
+ *          functions.
+ * @{
+ */
+
+#if (DDL_PWM_FRAME_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_FRAME_Local_Types PWM_FRAME Local Types
+ * @{
+ */
+
+/**
+ * @brief Register image of one frame, in the order of the DMA list
+ */
+typedef struct
+{
+    uint16_t u16Period;                             /*!< PERAR */
+    uint16_t au16Compare[PWM_FRAME_CH_NUM_MAX];     /*!< CMPAR1 ~ CMPARn */
+    uint16_t au16Pconr[PWM_FRAME_CH_NUM_MAX];       /*!< PCONR1 ~ PCONRn */
+} stc_pwm_frame_data_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_FRAME_Local_Macros PWM_FRAME Local Macros
+ * @{
+ */
+#define PWM_FRAME_DMA_UNIT              (CM_DMA)
+#define PWM_FRAME_TMRB_UNIT             (CM_TMRB)
+
+#define PWM_FRAME_FRAME_NUM             (2UL)
+#define PWM_FRAME_DESC_PER              (0UL)
+#define PWM_FRAME_DESC_CMP              (1UL)
+#define PWM_FRAME_DESC_PCONR            (2UL)
+#define PWM_FRAME_DESC_NUM              (3UL)
+
+#define PWM_FRAME_TMRA_UNIT_STEP        (3UL)
+
+/* CMPARn and PCONRn are 4 bytes apart: one half word, then skip one */
+#define PWM_FRAME_REG_STEP              (4UL)
+#define PWM_FRAME_NONSEQ_OFFSET         (2UL)
+
+/* HCLK cycles from the overflow to the last PCONRn write, no other DMA channel active */
+#define PWM_FRAME_LATENCY_CYCLES(n)     (48UL + (16UL * (n)))
+
+#define PWM_FRAME_LLP_POS               (DMA_CH0CTL0_LLP_POS - 4U)
+
+#define PWM_FRAME_DESC_CTL0(blk, cnt, next, run)                               \
+(   (blk)                                               |                      \
+    ((cnt) << DMA_CH0CTL0_CNT_POS)                      |                      \
+    (((uint32_t)(next) << PWM_FRAME_LLP_POS) & DMA_CH0CTL0_LLP) |              \
+    DMA_LLP_ENABLE                                      |                      \
+    (run)                                               |                      \
+    DMA_DATA_WIDTH_16BIT)
+
+#define PWM_FRAME_DESC_CTL1_FIX                                                \
+(   DMA_SRC_ADDR_MD_FIX                                 |                      \
+    DMA_DEST_ADDR_MD_FIX                                |                      \
+    DMA_LLP_ADDR_RAM)
+
+#define PWM_FRAME_DESC_CTL1_SEQ                                                \
+(   DMA_SRC_ADDR_MD_INC                                 |                      \
+    DMA_DEST_ADDR_MD_INC                                |                      \
+    DMA_NONSEQ_ENABLE                                   |                      \
+    DMA_DEST_NONSEQ                                     |                      \
+    (1UL << DMA_CH0CTL1_RPTNSCNT_POS)                   |                      \
+    (PWM_FRAME_NONSEQ_OFFSET << DMA_CH0CTL1_OFFSET_POS) |                      \
+    DMA_LLP_ADDR_RAM)
+
+#define PWM_FRAME_DESC_CTL1_TABLE                                              \
+(   DMA_SRC_ADDR_MD_INC                                 |                      \
+    DMA_DEST_ADDR_MD_FIX                                |                      \
+    DMA_LLP_ADDR_RAM)
+
+/* TMRA and TMRB share the PCONR layout */
+#define PWM_FRAME_PCONR(sta, stp, cmp, per)                                    \
+(   (uint16_t)(TMRB_PCONR_OUTEN                         |                      \
+    ((uint32_t)(sta) << TMRB_PCONR_STAC_POS)            |                      \
+    ((uint32_t)(stp) << TMRB_PCONR_STPC_POS)            |                      \
+    ((uint32_t)(cmp) << TMRB_PCONR_CMPC_POS)            |                      \
+    ((uint32_t)(per) << TMRB_PCONR_PERC_POS)))
+
+/**
+ * @defgroup PWM_FRAME_Check_Parameters_Validity PWM_FRAME Check Parameters Validity
+ * @{
+ */
+#define IS_PWM_FRAME_UNIT(x)            ((x) <= PWM_FRAME_UNIT_TMRA_4)
+
+#define IS_PWM_FRAME_POL(x)                                                    \
+(   ((x) == PWM_FRAME_POL_HIGH)                 ||                             \
+    ((x) == PWM_FRAME_POL_LOW))
+
+#define IS_PWM_FRAME_PLAY_MD(x)                                                \
+(   ((x) == PWM_FRAME_PLAY_ONCE)                ||                             \
+    ((x) == PWM_FRAME_PLAY_LOOP))
+
+#define IS_PWM_FRAME_DMA_CH(x)          ((x) <= DMA_CH3)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup PWM_FRAME_Local_Functions
+ * @{
+ */
+static void PWM_FRAME_TimerCmd(en_functional_state_t enNewState);
+static void PWM_FRAME_Build(uint32_t u32Frame);
+static void PWM_FRAME_WriteReg(uint32_t u32Frame);
+static void PWM_FRAME_Rewind(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_FRAME_Local_Variables PWM_FRAME Local Variables
+ * @{
+ */
+#if defined (__ICCARM__)
+_Pragma("data_alignment=16")
+static stc_dma_llp_descriptor_t m_astcLlpDesc[PWM_FRAME_FRAME_NUM][PWM_FRAME_DESC_NUM];
+_Pragma("data_alignment=16")
+static stc_dma_llp_descriptor_t m_astcPlayDesc[PWM_FRAME_CH_NUM_MAX];
+#else
+static stc_dma_llp_descriptor_t m_astcLlpDesc[PWM_FRAME_FRAME_NUM][PWM_FRAME_DESC_NUM] __ALIGNED(16);
+static stc_dma_llp_descriptor_t m_astcPlayDesc[PWM_FRAME_CH_NUM_MAX] __ALIGNED(16);
+#endif
+
+static stc_pwm_frame_data_t m_astcFrame[PWM_FRAME_FRAME_NUM];
+
+static uint32_t m_u32Unit = PWM_FRAME_UNIT_TMRB;
+static CM_TMRA_TypeDef *m_pstcTmra = NULL;
+static uint32_t m_u32ChNum = 0UL;
+static uint32_t m_u32DmaCh = DMA_CH0;
+static uint32_t m_u32PerarAddr = 0UL;
+static uint32_t m_u32CmparAddr = 0UL;
+static uint32_t m_u32PconrAddr = 0UL;
+static en_event_src_t m_enOvfEvent = EVT_TMRB_OVF;
+static uint16_t m_u16MinDuty = 1U;
+
+/* Staged values, copied to a frame by PWM_FRAME_Commit() */
+static uint16_t m_u16StagePeriod = 0U;
+static uint16_t m_au16StageDuty[PWM_FRAME_CH_NUM_MAX];
+static uint32_t m_au32StagePol[PWM_FRAME_CH_NUM_MAX];
+
+static uint32_t m_u32Committed = 0UL;
+static uint32_t m_u32Running = 0UL;
+static uint32_t m_u32PlayMxCh = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_FRAME_Global_Functions PWM_FRAME Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_pwm_frame_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_pwm_frame_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t PWM_FRAME_StructInit(stc_pwm_frame_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32Unit = PWM_FRAME_UNIT_TMRB;
+        pstcInit->u32ChNum = 4UL;
+        pstcInit->u16ClockDiv = TMRB_CLK_DIV1;
+        pstcInit->u16Period = 0xFFFFU;
+        pstcInit->u32DmaCh = DMA_CH0;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the timer and the frame DMA list.
+ * @param  [in] pstcInit                Pointer to a stc_pwm_frame_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration
+ * @note   The first frame has the given period, all duties 0 and active
+ *         high outputs. PWM outputs begin with PWM_FRAME_Start().
+ */
+en_result_t PWM_FRAME_Init(const stc_pwm_frame_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_clock_freq_t stcClkFreq;
+    stc_tmrb_init_t stcTmrbInit;
+    stc_tmra_init_t stcTmraInit;
+    uint32_t u32ChMax = 0UL;
+    uint32_t u32Clk;
+    uint32_t u32Min;
+    uint32_t i;
+
+    if (pstcInit != NULL)
+    {
+        DDL_ASSERT(IS_PWM_FRAME_UNIT(pstcInit->u32Unit));
+        DDL_ASSERT(IS_PWM_FRAME_DMA_CH(pstcInit->u32DmaCh));
+
+        if (pstcInit->u32Unit == PWM_FRAME_UNIT_TMRB)
+        {
+            u32ChMax = 4UL;
+        }
+        else if ((pstcInit->u32Unit == PWM_FRAME_UNIT_TMRA_3) || (pstcInit->u32Unit == PWM_FRAME_UNIT_TMRA_4))
+        {
+            u32ChMax = 2UL;
+        }
+        else
+        {
+            u32ChMax = 1UL;
+        }
+
+        if ((pstcInit->u32ChNum != 0UL) && (pstcInit->u32ChNum <= u32ChMax) && (pstcInit->u16Period != 0U))
+        {
+            enRet = Ok;
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        PWM_FRAME_DeInit();
+
+        m_u32Unit = pstcInit->u32Unit;
+        m_u32ChNum = pstcInit->u32ChNum;
+        m_u32DmaCh = pstcInit->u32DmaCh;
+
+        (void)CLK_GetClockFreq(&stcClkFreq);
+        if (m_u32Unit == PWM_FRAME_UNIT_TMRB)
+        {
+            u32Clk = stcClkFreq.u32Pclk1Freq >> ((uint32_t)pstcInit->u16ClockDiv >> TMRB_BCSTR_CKDIV_POS);
+            m_u32PerarAddr = (uint32_t)&PWM_FRAME_TMRB_UNIT->PERAR;
+            m_u32CmparAddr = (uint32_t)&PWM_FRAME_TMRB_UNIT->CMPAR1;
+            m_u32PconrAddr = (uint32_t)&PWM_FRAME_TMRB_UNIT->PCONR1;
+            m_enOvfEvent = EVT_TMRB_OVF;
+
+            (void)TMRB_StructInit(&stcTmrbInit);
+            stcTmrbInit.u16ClockDiv = pstcInit->u16ClockDiv;
+            stcTmrbInit.u16CountMode = TMRB_MD_SAWTOOTH;
+            stcTmrbInit.u16CountDir = TMRB_DIR_UP;
+            stcTmrbInit.u16PeriodValue = pstcInit->u16Period;
+            (void)TMRB_Init(PWM_FRAME_TMRB_UNIT, &stcTmrbInit);
+            for (i = 0UL; i < m_u32ChNum; i++)
+            {
+                TMRB_SetFunc(PWM_FRAME_TMRB_UNIT, i, TMRB_FUNC_CMP);
+            }
+        }
+        else
+        {
+            if (m_u32Unit == PWM_FRAME_UNIT_TMRA_1)
+            {
+                m_pstcTmra = CM_TMRA_1;
+            }
+            else if (m_u32Unit == PWM_FRAME_UNIT_TMRA_2)
+            {
+                m_pstcTmra = CM_TMRA_2;
+            }
+            else if (m_u32Unit == PWM_FRAME_UNIT_TMRA_3)
+            {
+                m_pstcTmra = CM_TMRA_3;
+            }
+            else
+            {
+                m_pstcTmra = CM_TMRA_4;
+            }
+            u32Clk = stcClkFreq.u32Pclk1Freq >> ((uint32_t)pstcInit->u16ClockDiv >> TMRA_BCSTR_CKDIV_POS);
+            m_u32PerarAddr = (uint32_t)&m_pstcTmra->PERAR;
+            m_u32CmparAddr = (uint32_t)&m_pstcTmra->CMPAR1;
+            m_u32PconrAddr = (uint32_t)&m_pstcTmra->PCONR1;
+            m_enOvfEvent = (en_event_src_t)((uint32_t)EVT_TMRA_1_OVF +
+                                            ((m_u32Unit - PWM_FRAME_UNIT_TMRA_1) * PWM_FRAME_TMRA_UNIT_STEP));
+
+            (void)TMRA_StructInit(&stcTmraInit);
+            stcTmraInit.u16ClockDiv = pstcInit->u16ClockDiv;
+            stcTmraInit.u16CountMode = TMRA_MD_SAWTOOTH;
+            stcTmraInit.u16CountDir = TMRA_DIR_UP;
+            stcTmraInit.u16PeriodValue = pstcInit->u16Period;
+            (void)TMRA_Init(m_pstcTmra, &stcTmraInit);
+            for (i = 0UL; i < m_u32ChNum; i++)
+            {
+                TMRA_SetFunc(m_pstcTmra, i, TMRA_FUNC_CMP);
+            }
+        }
+
+        /* A compare value the DMA list has not written yet when it is reached is missed */
+        u32Min = (uint32_t)((((uint64_t)PWM_FRAME_LATENCY_CYCLES(m_u32ChNum) * u32Clk) +
+                             stcClkFreq.u32HclkFreq - 1ULL) / stcClkFreq.u32HclkFreq) + 1UL;
+        m_u16MinDuty = (u32Min < (uint32_t)pstcInit->u16Period) ? (uint16_t)u32Min : pstcInit->u16Period;
+
+        m_u16StagePeriod = pstcInit->u16Period;
+        for (i = 0UL; i < PWM_FRAME_CH_NUM_MAX; i++)
+        {
+            m_au16StageDuty[i] = 0U;
+            m_au32StagePol[i] = PWM_FRAME_POL_HIGH;
+        }
+
+        /* Each frame is PERAR, then CMPARn and PCONRn, then back to PERAR waiting for the overflow */
+        for (i = 0UL; i < PWM_FRAME_FRAME_NUM; i++)
+        {
+            m_astcLlpDesc[i][PWM_FRAME_DESC_PER].SARx = (uint32_t)&m_astcFrame[i].u16Period;
+            m_astcLlpDesc[i][PWM_FRAME_DESC_PER].DARx = m_u32PerarAddr;
+            m_astcLlpDesc[i][PWM_FRAME_DESC_PER].CHxCTL0 =
+                PWM_FRAME_DESC_CTL0(1UL, 1UL, &m_astcLlpDesc[i][PWM_FRAME_DESC_CMP], DMA_LLP_RUN);
+            m_astcLlpDesc[i][PWM_FRAME_DESC_PER].CHxCTL1 = PWM_FRAME_DESC_CTL1_FIX;
+
+            m_astcLlpDesc[i][PWM_FRAME_DESC_CMP].SARx = (uint32_t)&m_astcFrame[i].au16Compare[0U];
+            m_astcLlpDesc[i][PWM_FRAME_DESC_CMP].DARx = m_u32CmparAddr;
+            m_astcLlpDesc[i][PWM_FRAME_DESC_CMP].CHxCTL0 =
+                PWM_FRAME_DESC_CTL0(m_u32ChNum, 1UL, &m_astcLlpDesc[i][PWM_FRAME_DESC_PCONR], DMA_LLP_RUN);
+            m_astcLlpDesc[i][PWM_FRAME_DESC_CMP].CHxCTL1 = PWM_FRAME_DESC_CTL1_SEQ;
+
+            m_astcLlpDesc[i][PWM_FRAME_DESC_PCONR].SARx = (uint32_t)&m_astcFrame[i].au16Pconr[0U];
+            m_astcLlpDesc[i][PWM_FRAME_DESC_PCONR].DARx = m_u32PconrAddr;
+            m_astcLlpDesc[i][PWM_FRAME_DESC_PCONR].CHxCTL0 =
+                PWM_FRAME_DESC_CTL0(m_u32ChNum, 1UL, &m_astcLlpDesc[i][PWM_FRAME_DESC_PER], DMA_LLP_WAIT);
+            m_astcLlpDesc[i][PWM_FRAME_DESC_PCONR].CHxCTL1 = PWM_FRAME_DESC_CTL1_SEQ;
+        }
+
+        m_u32Committed = 0UL;
+        PWM_FRAME_Build(m_u32Committed);
+        PWM_FRAME_WriteReg(m_u32Committed);
+
+        DMA_ChCmd(PWM_FRAME_DMA_UNIT, m_u32DmaCh, Disable);
+        PWM_FRAME_Rewind();
+        DMA_SetTriggerSrc(PWM_FRAME_DMA_UNIT, m_u32DmaCh, m_enOvfEvent);
+        DMA_Cmd(PWM_FRAME_DMA_UNIT, Enable);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the PWM frame engine and disable the outputs.
+ * @param  None
+ * @retval None
+ */
+void PWM_FRAME_DeInit(void)
+{
+    uint32_t i;
+
+    if (m_u32ChNum != 0UL)
+    {
+        PWM_FRAME_Stop();
+        for (i = 0UL; i < m_u32ChNum; i++)
+        {
+            WRITE_REG16(*(__IO uint16_t *)(m_u32PconrAddr + (i * PWM_FRAME_REG_STEP)), 0U);
+        }
+        m_pstcTmra = NULL;
+        m_u32ChNum = 0UL;
+    }
+}
+
+/**
+ * @brief  Start the counter with the last committed frame.
+ * @param  None
+ * @retval None
+ */
+void PWM_FRAME_Start(void)
+{
+    if (m_u32ChNum != 0UL)
+    {
+        PWM_FRAME_Stop();
+        PWM_FRAME_WriteReg(m_u32Committed);
+        PWM_FRAME_Rewind();
+        DMA_ChCmd(PWM_FRAME_DMA_UNIT, m_u32DmaCh, Enable);
+        m_u32Running = 1UL;
+        PWM_FRAME_TimerCmd(Enable);
+    }
+}
+
+/**
+ * @brief  Stop the counter and the frame and table DMA channels.
+ * @param  None
+ * @retval None
+ */
+void PWM_FRAME_Stop(void)
+{
+    if (m_u32ChNum != 0UL)
+    {
+        PWM_FRAME_TimerCmd(Disable);
+        DMA_ChCmd(PWM_FRAME_DMA_UNIT, m_u32DmaCh, Disable);
+        if (m_u32PlayMxCh != 0UL)
+        {
+            DMA_MxChCmd(PWM_FRAME_DMA_UNIT, m_u32PlayMxCh, Disable);
+            m_u32PlayMxCh = 0UL;
+        }
+        m_u32Running = 0UL;
+    }
+}
+
+/**
+ * @brief  Stage the period of the next frame.
+ * @param  [in] u16Period               Period value, the period is u16Period + 1 counts.
+ * @retval None
+ */
+void PWM_FRAME_SetPeriod(uint16_t u16Period)
+{
+    DDL_ASSERT(u16Period != 0U);
+
+    m_u16StagePeriod = u16Period;
+}
+
+/**
+ * @brief  Stage the duty of a channel in the next frame.
+ * @param  [in] u32Ch                   Channel, TMRB_CH1 ~ TMRB_CH4 or TMRA_CH1 ~ TMRA_CH2.
+ * @param  [in] u16Duty                 Active time in counts. 0 is always inactive, more
+ *                                      than the period value is always active, other
+ *                                      values below PWM_FRAME_GetMinDuty() are raised to it.
+ * @retval None
+ * @note   The first period of a frame with duty 0 still starts active, for
+ *         PWM_FRAME_GetMinDuty() counts.
+ */
+void PWM_FRAME_SetDuty(uint32_t u32Ch, uint16_t u16Duty)
+{
+    DDL_ASSERT(u32Ch < m_u32ChNum);
+
+    m_au16StageDuty[u32Ch] = u16Duty;
+}
+
+/**
+ * @brief  Stage the polarity of a channel in the next frame.
+ * @param  [in] u32Ch                   Channel, TMRB_CH1 ~ TMRB_CH4 or TMRA_CH1 ~ TMRA_CH2.
+ * @param  [in] u32Polarity             Active level, @ref PWM_FRAME_Polarity
+ * @retval None
+ * @note   The level at the start of a period is set at the end of the previous
+ *         one, so a frame changing the polarity is fully in force one period
+ *         after its duties.
+ */
+void PWM_FRAME_SetPolarity(uint32_t u32Ch, uint32_t u32Polarity)
+{
+    DDL_ASSERT(u32Ch < m_u32ChNum);
+    DDL_ASSERT(IS_PWM_FRAME_POL(u32Polarity));
+
+    m_au32StagePol[u32Ch] = u32Polarity;
+}
+
+/**
+ * @brief  Commit the staged period, duties and polarities as one frame.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          The frame is applied at the first or second overflow
+ *   @arg  ErrorNotReady:               Not initialized, or the previous frame is still pending
+ * @note   The staged values are kept, so a commit may change a single value.
+ */
+en_result_t PWM_FRAME_Commit(void)
+{
+    en_result_t enRet = ErrorNotReady;
+    uint32_t u32Next;
+
+    if ((m_u32ChNum != 0UL) && (Reset == PWM_FRAME_GetPendingStatus()))
+    {
+        u32Next = m_u32Committed ^ 1UL;
+        PWM_FRAME_Build(u32Next);
+        m_astcLlpDesc[u32Next][PWM_FRAME_DESC_PCONR].CHxCTL0 =
+            PWM_FRAME_DESC_CTL0(m_u32ChNum, 1UL, &m_astcLlpDesc[u32Next][PWM_FRAME_DESC_PER], DMA_LLP_WAIT);
+        /* Single word write: the list of the current frame continues with the new one */
+        m_astcLlpDesc[m_u32Committed][PWM_FRAME_DESC_PCONR].CHxCTL0 =
+            PWM_FRAME_DESC_CTL0(m_u32ChNum, 1UL, &m_astcLlpDesc[u32Next][PWM_FRAME_DESC_PER], DMA_LLP_WAIT);
+        m_u32Committed = u32Next;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the status of the last commit.
+ * @param  None
+ * @retval An en_flag_status_t enumeration value:
+ *   @arg  Set:                         The DMA list still runs the previous frame
+ *   @arg  Reset:                       The DMA list has moved to the committed frame,
+ *                                      it is written at the next overflow at the latest
+ */
+en_flag_status_t PWM_FRAME_GetPendingStatus(void)
+{
+    en_flag_status_t enStatus = Reset;
+    uint32_t u32Src;
+    uint32_t u32Start;
+
+    if ((m_u32Running != 0UL) && (m_u32PlayMxCh == 0UL))
+    {
+        u32Src = DMA_GetSrcAddr(PWM_FRAME_DMA_UNIT, m_u32DmaCh);
+        u32Start = (uint32_t)&m_astcFrame[m_u32Committed];
+        if ((u32Src < u32Start) || (u32Src >= (u32Start + sizeof(stc_pwm_frame_data_t))))
+        {
+            enStatus = Set;
+        }
+    }
+
+    return enStatus;
+}
+
+/**
+ * @brief  Get the shortest active time that is not raised.
+ * @param  None
+ * @retval Counts the DMA list needs after the overflow to write a frame.
+ */
+uint16_t PWM_FRAME_GetMinDuty(void)
+{
+    return m_u16MinDuty;
+}
+
+/**
+ * @brief  Convert an active time to a compare value for PWM_FRAME_PlayStart().
+ * @param  [in] u16Duty                 Active time in counts, raised to PWM_FRAME_GetMinDuty().
+ * @retval Compare value, 0xFFFF (always active unless the period value is 0xFFFF)
+ *         when u16Duty is more than the committed period value.
+ */
+uint16_t PWM_FRAME_DutyToCompare(uint16_t u16Duty)
+{
+    uint16_t u16Cmp = 0xFFFFU;
+
+    if (u16Duty <= m_astcFrame[m_u32Committed].u16Period)
+    {
+        u16Cmp = ((u16Duty > m_u16MinDuty) ? u16Duty : m_u16MinDuty) - 1U;
+    }
+
+    return u16Cmp;
+}
+
+/**
+ * @brief  Play per period compare tables.
+ * @param  [in] astcPlay                Tables, one per channel.
+ * @param  [in] u32Num                  Number of tables, 1 ~ number of free DMA channels.
+ * @param  [in] u32Mode                 @ref PWM_FRAME_Play_Mode
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorNotReady:               Not started, already playing or a frame is pending
+ *   @arg  ErrorInvalidParameter:       Invalid table
+ * @note   Frames are suspended until PWM_FRAME_PlayStop(), the channels keep
+ *         the period and polarities of the last frame. All tables start at
+ *         the same overflow. The tables must stay valid while playing.
+ */
+en_result_t PWM_FRAME_PlayStart(const stc_pwm_frame_play_t astcPlay[], uint32_t u32Num, uint32_t u32Mode)
+{
+    en_result_t enRet = ErrorNotReady;
+    stc_dma_init_t stcDmaInit;
+    stc_dma_nonseq_init_t stcNonSeqInit;
+    stc_dma_llp_init_t stcLlpInit;
+    uint32_t u32MxCh = 0UL;
+    uint32_t u32DmaCh;
+    uint32_t i;
+
+    DDL_ASSERT(IS_PWM_FRAME_PLAY_MD(u32Mode));
+
+    if ((m_u32Running != 0UL) && (m_u32PlayMxCh == 0UL) && (Reset == PWM_FRAME_GetPendingStatus()))
+    {
+        enRet = ErrorInvalidParameter;
+        if ((astcPlay != NULL) && (u32Num != 0UL) && (u32Num <= PWM_FRAME_CH_NUM_MAX))
+        {
+            enRet = Ok;
+            for (i = 0UL; i < u32Num; i++)
+            {
+                u32DmaCh = astcPlay[i].u32DmaCh;
+                if ((astcPlay[i].u32Ch >= m_u32ChNum) || (astcPlay[i].pu16Compare == NULL) ||
+                    (astcPlay[i].u32Len == 0UL) || (astcPlay[i].u32Len > PWM_FRAME_PLAY_LEN_MAX) ||
+                    (!IS_PWM_FRAME_DMA_CH(u32DmaCh)) || (u32DmaCh == m_u32DmaCh) ||
+                    ((u32MxCh & (DMA_MX_CH0 << u32DmaCh)) != 0UL))
+                {
+                    enRet = ErrorInvalidParameter;
+                    break;
+                }
+                u32MxCh |= DMA_MX_CH0 << u32DmaCh;
+            }
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        DMA_ChCmd(PWM_FRAME_DMA_UNIT, m_u32DmaCh, Disable);
+
+        for (i = 0UL; i < u32Num; i++)
+        {
+            u32DmaCh = astcPlay[i].u32DmaCh;
+            DMA_ChCmd(PWM_FRAME_DMA_UNIT, u32DmaCh, Disable);
+
+            (void)DMA_StructInit(&stcDmaInit);
+            stcDmaInit.u32SrcAddr = (uint32_t)astcPlay[i].pu16Compare;
+            stcDmaInit.u32DestAddr = m_u32CmparAddr + (astcPlay[i].u32Ch * PWM_FRAME_REG_STEP);
+            stcDmaInit.u32DataWidth = DMA_DATA_WIDTH_16BIT;
+            stcDmaInit.u32BlockSize = 1UL;
+            stcDmaInit.u32TransCount = astcPlay[i].u32Len;
+            stcDmaInit.u32SrcAddrMode = DMA_SRC_ADDR_MD_INC;
+            stcDmaInit.u32DestAddrMode = DMA_DEST_ADDR_MD_FIX;
+            (void)DMA_Init(PWM_FRAME_DMA_UNIT, u32DmaCh, &stcDmaInit);
+
+            (void)DMA_NonSeqStructInit(&stcNonSeqInit);
+            (void)DMA_NonSeqInit(PWM_FRAME_DMA_UNIT, u32DmaCh, &stcNonSeqInit);
+
+            if (u32Mode == PWM_FRAME_PLAY_LOOP)
+            {
+                m_astcPlayDesc[i].SARx = stcDmaInit.u32SrcAddr;
+                m_astcPlayDesc[i].DARx = stcDmaInit.u32DestAddr;
+                m_astcPlayDesc[i].CHxCTL0 =
+                    PWM_FRAME_DESC_CTL0(1UL, astcPlay[i].u32Len, &m_astcPlayDesc[i], DMA_LLP_WAIT);
+                m_astcPlayDesc[i].CHxCTL1 = PWM_FRAME_DESC_CTL1_TABLE;
+
+                (void)DMA_LlpStructInit(&stcLlpInit);
+                stcLlpInit.u32Llp = DMA_LLP_ENABLE;
+                stcLlpInit.u32LlpMode = DMA_LLP_WAIT;
+                stcLlpInit.u32LlpAddr = (uint32_t)&m_astcPlayDesc[i];
+                stcLlpInit.u32LlpAddrMode = DMA_LLP_ADDR_RAM;
+                (void)DMA_LlpInit(PWM_FRAME_DMA_UNIT, u32DmaCh, &stcLlpInit);
+            }
+            else
+            {
+                DMA_LlpCmd(PWM_FRAME_DMA_UNIT, u32DmaCh, Disable);
+            }
+            DMA_SetTriggerSrc(PWM_FRAME_DMA_UNIT, u32DmaCh, m_enOvfEvent);
+        }
+
+        /* One write enables all table channels before the same overflow */
+        m_u32PlayMxCh = u32MxCh;
+        DMA_MxChCmd(PWM_FRAME_DMA_UNIT, u32MxCh, Enable);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the tables and resume the frames.
+ * @param  None
+ * @retval None
+ * @note   The committed frame is written again from the next overflow.
+ */
+void PWM_FRAME_PlayStop(void)
+{
+    if (m_u32PlayMxCh != 0UL)
+    {
+        DMA_MxChCmd(PWM_FRAME_DMA_UNIT, m_u32PlayMxCh, Disable);
+        m_u32PlayMxCh = 0UL;
+        PWM_FRAME_Rewind();
+        DMA_ChCmd(PWM_FRAME_DMA_UNIT, m_u32DmaCh, Enable);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWM_FRAME_Local_Functions PWM_FRAME Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Start or stop the counter.
+ * @param  [in] enNewState              An en_functional_state_t enumeration value.
+ * @retval None
+ */
+static void PWM_FRAME_TimerCmd(en_functional_state_t enNewState)
+{
+    if (m_u32Unit == PWM_FRAME_UNIT_TMRB)
+    {
+        if (enNewState == Enable)
+        {
+            TMRB_SetCountValue(PWM_FRAME_TMRB_UNIT, 0U);
+            TMRB_Start(PWM_FRAME_TMRB_UNIT);
+        }
+        else
+        {
+            TMRB_Stop(PWM_FRAME_TMRB_UNIT);
+        }
+    }
+    else
+    {
+        if (enNewState == Enable)
+        {
+            TMRA_SetCountValue(m_pstcTmra, 0U);
+            TMRA_Start(m_pstcTmra);
+        }
+        else
+        {
+            TMRA_Stop(m_pstcTmra);
+        }
+    }
+}
+
+/**
+ * @brief  Build the register image of the staged values.
+ * @param  [in] u32Frame                Frame index, not the one the DMA list runs.
+ * @retval None
+ */
+static void PWM_FRAME_Build(uint32_t u32Frame)
+{
+    stc_pwm_frame_data_t *pstcFrame = &m_astcFrame[u32Frame];
+    uint32_t u32Act;
+    uint32_t u32Inact;
+    uint32_t u32Duty;
+    uint32_t i;
+
+    pstcFrame->u16Period = m_u16StagePeriod;
+    for (i = 0UL; i < m_u32ChNum; i++)
+    {
+        u32Act = (m_au32StagePol[i] == PWM_FRAME_POL_HIGH) ? 1UL : 0UL;
+        u32Inact = u32Act ^ 1UL;
+        u32Duty = m_au16StageDuty[i];
+
+        if (u32Duty == 0UL)
+        {
+            /* Inactive from the earliest compare that is written in time */
+            pstcFrame->au16Compare[i] = (uint16_t)(m_u16MinDuty - 1U);
+            pstcFrame->au16Pconr[i] = PWM_FRAME_PCONR(u32Inact, u32Inact, u32Inact, u32Inact);
+        }
+        else if (u32Duty > m_u16StagePeriod)
+        {
+            pstcFrame->au16Compare[i] = m_u16StagePeriod;
+            pstcFrame->au16Pconr[i] = PWM_FRAME_PCONR(u32Act, u32Inact, u32Act, u32Act);
+        }
+        else
+        {
+            /* Active from the period match to the compare match */
+            if (u32Duty < m_u16MinDuty)
+            {
+                u32Duty = m_u16MinDuty;
+            }
+            pstcFrame->au16Compare[i] = (uint16_t)(u32Duty - 1UL);
+            pstcFrame->au16Pconr[i] = PWM_FRAME_PCONR(u32Act, u32Inact, u32Inact, u32Act);
+        }
+    }
+}
+
+/**
+ * @brief  Write a frame to the registers, the counter is stopped.
+ * @param  [in] u32Frame                Frame index.
+ * @retval None
+ */
+static void PWM_FRAME_WriteReg(uint32_t u32Frame)
+{
+    const stc_pwm_frame_data_t *pstcFrame = &m_astcFrame[u32Frame];
+    uint32_t i;
+
+    WRITE_REG16(*(__IO uint16_t *)m_u32PerarAddr, pstcFrame->u16Period);
+    for (i = 0UL; i < m_u32ChNum; i++)
+    {
+        WRITE_REG16(*(__IO uint16_t *)(m_u32CmparAddr + (i * PWM_FRAME_REG_STEP)), pstcFrame->au16Compare[i]);
+        WRITE_REG16(*(__IO uint16_t *)(m_u32PconrAddr + (i * PWM_FRAME_REG_STEP)), pstcFrame->au16Pconr[i]);
+    }
+}
+
+/**
+ * @brief  Load the first descriptor of the committed frame into the DMA channel.
+ * @param  None
+ * @retval None
+ */
+static void PWM_FRAME_Rewind(void)
+{
+    stc_dma_init_t stcDmaInit;
+    stc_dma_nonseq_init_t stcNonSeqInit;
+    stc_dma_llp_init_t stcLlpInit;
+    const stc_dma_llp_descriptor_t *pstcDesc = &m_astcLlpDesc[m_u32Committed][PWM_FRAME_DESC_PER];
+
+    /* The committed frame links to itself */
+    m_astcLlpDesc[m_u32Committed][PWM_FRAME_DESC_PCONR].CHxCTL0 =
+        PWM_FRAME_DESC_CTL0(m_u32ChNum, 1UL, pstcDesc, DMA_LLP_WAIT);
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32SrcAddr = pstcDesc->SARx;
+    stcDmaInit.u32DestAddr = pstcDesc->DARx;
+    stcDmaInit.u32DataWidth = DMA_DATA_WIDTH_16BIT;
+    stcDmaInit.u32BlockSize = 1UL;
+    stcDmaInit.u32TransCount = 1UL;
+    stcDmaInit.u32SrcAddrMode = DMA_SRC_ADDR_MD_FIX;
+    stcDmaInit.u32DestAddrMode = DMA_DEST_ADDR_MD_FIX;
+    (void)DMA_Init(PWM_FRAME_DMA_UNIT, m_u32DmaCh, &stcDmaInit);
+
+    (void)DMA_NonSeqStructInit(&stcNonSeqInit);
+    (void)DMA_NonSeqInit(PWM_FRAME_DMA_UNIT, m_u32DmaCh, &stcNonSeqInit);
+
+    (void)DMA_LlpStructInit(&stcLlpInit);
+    stcLlpInit.u32Llp = DMA_LLP_ENABLE;
+    stcLlpInit.u32LlpMode = DMA_LLP_RUN;
+    stcLlpInit.u32LlpAddr = (uint32_t)&m_astcLlpDesc[m_u32Committed][PWM_FRAME_DESC_CMP];
+    stcLlpInit.u32LlpAddrMode = DMA_LLP_ADDR_RAM;
+    (void)DMA_LlpInit(PWM_FRAME_DMA_UNIT, m_u32DmaCh, &stcLlpInit);
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_PWM_FRAME_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
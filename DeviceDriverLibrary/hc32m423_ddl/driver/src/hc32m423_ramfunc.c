@@ -0,0 +1,414 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_ramfunc.c
+ * @brief This file provides firmware functions for the RAM vector table and
+ *        the RAM function benchmark.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_ramfunc.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_RAMFUNC RAMFUNC
+ * @brief RAM Vector Table and RAM Function Driver Library
+ * @details Hot paths are placed in RAM, which has no wait cycles, with the
+ *          __RAM_FUNC attribute of hc32_common.h: the GCC linker script
+ *          copies the .ramfunc sections with .data, EWARM copies __ramfunc
+ *          code with the readwrite sections, and the MDK scatter file
+ *          mcu/MDK/config/hc32m423_flash.sct places .ramfunc in RAM.
+ *          RAMFUNC_VectorRelocate() copies the active vector table to a RAM
+ *          table aligned for VTOR and switches VTOR to it, so the vector
+ *          fetch of an interrupt does not read the flash either, and entries
+ *          can be changed at run time.
+ *          RAMFUNC_Benchmark() pends an interrupt whose vector points to the
+ *          same handler body placed in flash, then in RAM, and measures it
+ *          with the DWT cycle counter for each legal wait cycle setting.
+ * @{
+ */
+
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup RAMFUNC_Local_Macros RAMFUNC Local Macros
+ * @{
+ */
+#define RAMFUNC_IRQ_OFFSET              (16UL)
+
+/* Benchmark: handler body length and measurements per setting, the minimum is kept */
+#define RAMFUNC_BENCH_WORK              (32UL)
+#define RAMFUNC_BENCH_LOOP              (8UL)
+
+/**
+ * @defgroup RAMFUNC_Check_Parameters_Validity RAMFUNC Check Parameters Validity
+ * @{
+ */
+#define IS_RAMFUNC_IRQN(x)              (((uint32_t)(x) + RAMFUNC_IRQ_OFFSET) < RAMFUNC_VECTOR_NUM)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+/**
+ * @addtogroup RAMFUNC_Local_Functions
+ * @{
+ */
+static void RAMFUNC_BenchFlash_IrqHandler(void);
+static void __RAM_FUNC RAMFUNC_BenchRam_IrqHandler(void);
+static void RAMFUNC_SetWaitCycle(uint32_t u32WaitCycle);
+/**
+ * @}
+ */
+#endif /* DDL_UTILITY_ENABLE */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup RAMFUNC_Local_Variables RAMFUNC Local Variables
+ * @{
+ */
+#if defined (__ICCARM__)
+#pragma data_alignment = 512
+static uint32_t m_au32Vector[RAMFUNC_VECTOR_NUM];
+#else
+static uint32_t m_au32Vector[RAMFUNC_VECTOR_NUM] __attribute__((aligned(512)));
+#endif
+
+static uint32_t m_u32FlashVtor = 0UL;
+static uint32_t m_u32Relocated = 0UL;
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+static uint32_t m_au32BenchData[RAMFUNC_BENCH_WORK];
+static volatile uint32_t m_u32BenchAcc = 0UL;
+static volatile uint32_t m_u32BenchEnd = 0UL;
+#endif /* DDL_UTILITY_ENABLE */
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup RAMFUNC_Global_Functions RAMFUNC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Copy the active vector table to RAM and switch VTOR to the copy.
+ * @param  None
+ * @retval None
+ * @note   Nothing is done if the table is already in RAM.
+ */
+void RAMFUNC_VectorRelocate(void)
+{
+    uint32_t u32Primask;
+    const uint32_t *pu32Src;
+    uint32_t i;
+
+    if (m_u32Relocated == 0UL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        m_u32FlashVtor = READ_REG32(SCB->VTOR);
+        pu32Src = (const uint32_t *)m_u32FlashVtor;
+        for (i = 0UL; i < RAMFUNC_VECTOR_NUM; i++)
+        {
+            m_au32Vector[i] = pu32Src[i];
+        }
+        __DSB();
+        WRITE_REG32(SCB->VTOR, (uint32_t)m_au32Vector);
+        __DSB();
+        __ISB();
+        m_u32Relocated = 1UL;
+        __set_PRIMASK(u32Primask);
+    }
+}
+
+/**
+ * @brief  Switch VTOR back to the table active before RAMFUNC_VectorRelocate().
+ * @param  None
+ * @retval None
+ */
+void RAMFUNC_VectorRestore(void)
+{
+    if (m_u32Relocated != 0UL)
+    {
+        __DSB();
+        WRITE_REG32(SCB->VTOR, m_u32FlashVtor);
+        __DSB();
+        __ISB();
+        m_u32Relocated = 0UL;
+    }
+}
+
+/**
+ * @brief  Reset an entry of the RAM vector table from the table active
+ *         before RAMFUNC_VectorRelocate().
+ * @param  [in] u32Index                Entry index, 16 + IRQn for an interrupt.
+ * @retval None
+ */
+void RAMFUNC_VectorResetEntry(uint32_t u32Index)
+{
+    if ((m_u32Relocated != 0UL) && (u32Index < RAMFUNC_VECTOR_NUM))
+    {
+        m_au32Vector[u32Index] = RW_MEM32(m_u32FlashVtor + (u32Index * 4UL));
+        __DSB();
+    }
+}
+
+/**
+ * @brief  Get the RAM vector table.
+ * @param  None
+ * @retval RAMFUNC_VECTOR_NUM entries, index 16 + IRQn for an interrupt,
+ *         NULL if the table is not relocated.
+ */
+uint32_t *RAMFUNC_GetVectorTable(void)
+{
+    return (m_u32Relocated != 0UL) ? m_au32Vector : NULL;
+}
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+/**
+ * @brief  Measure the interrupt latency of a flash and a RAM handler for
+ *         each legal flash wait cycle setting.
+ * @param  [in] enIRQn                  An interrupt whose source is not used, it is
+ *                                      pended by software.
+ * @param  [in] enCache                 Flash caches during the measurement, Enable or Disable.
+ * @param  [out] pstcBench              Pointer to a stc_ramfunc_bench_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid interrupt or pstcBench == NULL
+ *   @arg  ErrorAccessRights:           EFM registers are locked
+ * @note   The vector table is relocated if needed. The wait cycles, the
+ *         caches, the vector entry and the interrupt setting are restored.
+ *         Call it with interrupts enabled (PRIMASK and BASEPRI cleared), the
+ *         interrupt is set to priority 0 during the measurement.
+ */
+en_result_t RAMFUNC_Benchmark(IRQn_Type enIRQn, en_functional_state_t enCache, stc_ramfunc_bench_t *pstcBench)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    const uint32_t u32Relocated = m_u32Relocated;
+    uint32_t u32Frmc;
+    uint32_t u32Vector;
+    uint32_t u32Prio;
+    uint32_t u32Enabled;
+    uint32_t u32Start;
+    uint32_t u32Cycle;
+    uint32_t u32Wait;
+    uint32_t u32Loc;
+    uint32_t i;
+    stc_clock_freq_t stcFreq;
+
+    if ((pstcBench != NULL) && ((int32_t)enIRQn >= 0) && IS_RAMFUNC_IRQN(enIRQn))
+    {
+        if (1UL != READ_REG32(CM_EFM->FAPRT))
+        {
+            enRet = ErrorAccessRights;
+        }
+        else
+        {
+            (void)CLK_GetClockFreq(&stcFreq);
+            pstcBench->u32MinWaitCycle = CLK_GetFlashWaitCycle(stcFreq.u32HclkFreq);
+            for (i = 0UL; i < RAMFUNC_BENCH_WORK; i++)
+            {
+                m_au32BenchData[i] = i * 0x9E3779B9UL;
+            }
+
+            RAMFUNC_VectorRelocate();
+            u32Frmc = READ_REG32(CM_EFM->FRMC);
+            u32Vector = m_au32Vector[RAMFUNC_IRQ_OFFSET + (uint32_t)enIRQn];
+            u32Prio = NVIC_GetPriority(enIRQn);
+            u32Enabled = NVIC_GetEnableIRQ(enIRQn);
+
+            if (enCache == Enable)
+            {
+                SET_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_ICHE | EFM_FRMC_DCHE);
+            }
+            else
+            {
+                CLEAR_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_ICHE | EFM_FRMC_DCHE);
+            }
+            NVIC_ClearPendingIRQ(enIRQn);
+            NVIC_SetPriority(enIRQn, DDL_IRQ_PRI00);
+            NVIC_EnableIRQ(enIRQn);
+
+            for (u32Wait = 0UL; u32Wait < RAMFUNC_WAIT_CYCLE_NUM; u32Wait++)
+            {
+                pstcBench->au32FlashCycle[u32Wait] = 0UL;
+                pstcBench->au32RamCycle[u32Wait] = 0UL;
+                if (u32Wait >= pstcBench->u32MinWaitCycle)
+                {
+                    RAMFUNC_SetWaitCycle(u32Wait);
+                    for (u32Loc = 0UL; u32Loc < 2UL; u32Loc++)
+                    {
+                        m_au32Vector[RAMFUNC_IRQ_OFFSET + (uint32_t)enIRQn] = (u32Loc == 0UL) ?
+                            (uint32_t)&RAMFUNC_BenchFlash_IrqHandler : (uint32_t)&RAMFUNC_BenchRam_IrqHandler;
+                        __DSB();
+                        u32Cycle = 0xFFFFFFFFUL;
+                        for (i = 0UL; i < RAMFUNC_BENCH_LOOP; i++)
+                        {
+                            u32Start = DDL_GetCycleCount();
+                            NVIC_SetPendingIRQ(enIRQn);
+                            __DSB();
+                            __ISB();
+                            if ((m_u32BenchEnd - u32Start) < u32Cycle)
+                            {
+                                u32Cycle = m_u32BenchEnd - u32Start;
+                            }
+                        }
+                        if (u32Loc == 0UL)
+                        {
+                            pstcBench->au32FlashCycle[u32Wait] = u32Cycle;
+                        }
+                        else
+                        {
+                            pstcBench->au32RamCycle[u32Wait] = u32Cycle;
+                        }
+                    }
+                }
+            }
+
+            /* Restore, the wait cycles stay legal since they never went below the original */
+            NVIC_DisableIRQ(enIRQn);
+            NVIC_ClearPendingIRQ(enIRQn);
+            NVIC_SetPriority(enIRQn, u32Prio);
+            if (u32Enabled != 0UL)
+            {
+                NVIC_EnableIRQ(enIRQn);
+            }
+            m_au32Vector[RAMFUNC_IRQ_OFFSET + (uint32_t)enIRQn] = u32Vector;
+            RAMFUNC_SetWaitCycle(u32Frmc & EFM_FRMC_FLWT);
+            MODIFY_REG32(CM_EFM->FRMC, EFM_FRMC_ICHE | EFM_FRMC_DCHE, u32Frmc);
+            if (u32Relocated == 0UL)
+            {
+                RAMFUNC_VectorRestore();
+            }
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+#endif /* DDL_UTILITY_ENABLE */
+
+/**
+ * @}
+ */
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+/**
+ * @defgroup RAMFUNC_Local_Functions RAMFUNC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Benchmark handler placed in flash.
+ * @param  None
+ * @retval None
+ */
+static void RAMFUNC_BenchFlash_IrqHandler(void)
+{
+    uint32_t u32Acc = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < RAMFUNC_BENCH_WORK; i++)
+    {
+        u32Acc = (u32Acc << 1U) ^ m_au32BenchData[i];
+    }
+    m_u32BenchAcc = u32Acc;
+    m_u32BenchEnd = READ_REG32(DWT->CYCCNT);
+}
+
+/**
+ * @brief  Benchmark handler placed in RAM, same body as the flash one.
+ * @param  None
+ * @retval None
+ */
+static void __RAM_FUNC RAMFUNC_BenchRam_IrqHandler(void)
+{
+    uint32_t u32Acc = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < RAMFUNC_BENCH_WORK; i++)
+    {
+        u32Acc = (u32Acc << 1U) ^ m_au32BenchData[i];
+    }
+    m_u32BenchAcc = u32Acc;
+    m_u32BenchEnd = READ_REG32(DWT->CYCCNT);
+}
+
+/**
+ * @brief  Set the flash read wait cycles and wait until they are applied.
+ * @param  [in] u32WaitCycle            Wait cycles, 0 ~ 7.
+ * @retval None
+ */
+static void RAMFUNC_SetWaitCycle(uint32_t u32WaitCycle)
+{
+    MODIFY_REG32(CM_EFM->FRMC, EFM_FRMC_FLWT, u32WaitCycle);
+    while (u32WaitCycle != READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT))
+    {
+        ;
+    }
+}
+
+/**
+ * @}
+ */
+#endif /* DDL_UTILITY_ENABLE */
+
+#endif /* DDL_RAMFUNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
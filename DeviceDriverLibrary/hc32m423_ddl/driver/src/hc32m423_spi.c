@@ -8,6 +8,7 @@
    Date             Author          Notes
    2020-09-15       CDT             First version
    2020-12-04       CDT             Corrected comments of SPI unit.
+   2026-10-18       CDT             Use time based timeout in microseconds
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -364,7 +365,7 @@ void SPI_ModeFaultDetectCmd(CM_SPI_TypeDef *SPIx, en_functional_state_t enNewSta
  *   @arg  CM_SPI:                      SPI unit instance register base.
  * @param  [in]  pvBuf                  The pointer to the buffer which contains the data to be sent.
  * @param  [in]  u32Len                 The length of the data to be sent.
- * @param  [in]  u32Timeout             Timeout value.
+ * @param  [in]  u32Timeout             Timeout value in microseconds.
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                          No errors occurred
  *   @arg  ErrorTimeout:                SPI transmit timeout.
@@ -405,7 +406,7 @@ en_result_t SPI_Trans(CM_SPI_TypeDef *SPIx, const void *pvBuf, \
  *   @arg  CM_SPI:                      SPI unit instance register base.
  * @param  [in]  pvBuf                  The pointer to the buffer which the received data to be stored.
  * @param  [in]  u32Len                 The length of the data to be received.
- * @param  [in]  u32Timeout             Timeout value.
+ * @param  [in]  u32Timeout             Timeout value in microseconds.
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                          No errors occurred
  *   @arg  ErrorTimeout:                SPI receive timeout.
@@ -440,7 +441,7 @@ en_result_t SPI_Receive(CM_SPI_TypeDef *SPIx, void *pvBuf, \
  * @param  [out] pvRxBuf                The pointer to the buffer which the received data will be stored.
  *                                      This for full duplex transfer.
  * @param  [in]  u32Len                 The length of the data(in byte or half word) to be sent and received.
- * @param  [in]  u32Timeout             Timeout value.
+ * @param  [in]  u32Timeout             Timeout value in microseconds.
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                          No errors occurred
  *   @arg  ErrorTimeout:                SPI transmit and receive timeout.
@@ -593,7 +594,7 @@ void SPI_ParitySelfDiagnosisCmd(CM_SPI_TypeDef *SPIx, en_functional_state_t enNe
  * @param  [in]  pvTxBuf                The pointer to the buffer which contains the data to be sent.
  * @param  [out] pvRxBuf                The pointer to the buffer which the received data will be stored.
  * @param  [in]  u32Len                 The length of the data in byte or half word.
- * @param  [in]  u32Timeout             Timeout value.
+ * @param  [in]  u32Timeout             Timeout value in microseconds.
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                          No errors occurred
  *   @arg  ErrorTimeout:                SPI transmit and receive timeout.
@@ -673,7 +674,7 @@ static en_result_t SPI_TxRx(CM_SPI_TypeDef *SPIx, const void *pvTxBuf, void *pvR
  *   @arg  CM_SPI:                      SPI unit instance register base.
  * @param  [in]  pvBuf                  The pointer to the buffer which contains the data to be sent.
  * @param  [in]  u32Len                 The length of the data in byte or half word.
- * @param  [in]  u32Timeout             Timeout value.
+ * @param  [in]  u32Timeout             Timeout value in microseconds.
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                          No errors occurred.
  *   @arg  ErrorTimeout:                SPI transmit timeout.
@@ -722,7 +723,7 @@ static en_result_t SPI_Tx(CM_SPI_TypeDef *SPIx, const void *pvBuf, \
  *   @arg  CM_SPI:                      SPI unit instance register base.
  * @param  [in]  u32FlagMask            Bit mask of status flag.
  * @param  [in]  u32Value               Valid value of the status.
- * @param  [in]  u32Timeout             Timeout value.
+ * @param  [in]  u32Timeout             Timeout value in microseconds.
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                          No errors occurred.
  *   @arg  ErrorTimeout:                Check status timeout.
@@ -731,15 +732,16 @@ static en_result_t SPI_WaitStatus(const CM_SPI_TypeDef *SPIx, uint32_t u32FlagMa
                                   uint32_t u32Value, uint32_t u32Timeout)
 {
     en_result_t enRet = Ok;
+    stc_ddl_deadline_t stcDeadline;
 
+    DDL_DeadlineStart(&stcDeadline, u32Timeout);
     while (READ_REG32_BIT(SPIx->SR, u32FlagMask) != u32Value)
     {
-        if (u32Timeout == 0UL)
+        if (Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
         }
-        u32Timeout--;
     }
 
     return enRet;
@@ -0,0 +1,757 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmr0_wheel.c
+ * @brief This file provides firmware functions to multiplex many software
+ *        timers on one TMR0 compare channel.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_tmr0_wheel.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_tmr0.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_TMR0_WHEEL TMR0_WHEEL
+ * @brief Software Timer Wheel Driver Library
+ * @details Timers are filed in a hierarchical wheel: level L holds the timers
+ *          due in 2^(L*SLOT_BITS) ~ 2^((L+1)*SLOT_BITS) - 1 ticks, in the slot
+ *          given by the matching bits of the expiry tick. Start and stop are
+ *          O(1) list operations. A bitmap of the non-empty slots of each level
+ *          gives the next tick that needs work (an expiry, or the moment a
+ *          higher level slot must be re-filed) with a few bit operations.
+ *          The TMR0 channel does not tick periodically: its compare value is
+ *          set to that next tick, limited to the 16-bit counter range, so an
+ *          idle wheel interrupts once per counter period at most.
+ *          The compare match clears the counter, so each interrupt adds
+ *          exactly the programmed number of ticks and the time base does not
+ *          drift. The application enables the TMR0 function clock and calls
+ *          TMR0_WHEEL_IrqHandler() from the compare handler of the channel.
+ * @{
+ */
+
+#if (DDL_TMR0_WHEEL_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Local_Macros TMR0_WHEEL Local Macros
+ * @{
+ */
+#if ((TMR0_WHEEL_SLOT_BITS > 5UL) || ((TMR0_WHEEL_LEVEL_NUM * TMR0_WHEEL_SLOT_BITS) > 30UL))
+#error "TMR0_WHEEL geometry out of range"
+#endif
+
+#define TMR0_WHEEL_SLOT_NUM             (1UL << TMR0_WHEEL_SLOT_BITS)
+#define TMR0_WHEEL_SLOT_MASK            (TMR0_WHEEL_SLOT_NUM - 1UL)
+#define TMR0_WHEEL_RANGE                ((1UL << (TMR0_WHEEL_LEVEL_NUM * TMR0_WHEEL_SLOT_BITS)) - 1UL)
+
+#define TMR0_WHEEL_CNT_MAX              (0x10000UL)
+#define TMR0_WHEEL_CNT_PER_TICK_MIN     (8UL)
+/* Counts between reading the counter and the compare write taking effect */
+#define TMR0_WHEEL_GUARD_CNT            (2UL)
+#define TMR0_WHEEL_CLK_DIV_NUM          (11UL)
+
+/* Index of the lowest set bit */
+#define TMR0_WHEEL_CTZ(x)               (__CLZ(__RBIT(x)))
+
+/**
+ * @defgroup TMR0_WHEEL_Check_Parameters_Validity TMR0_WHEEL Check Parameters Validity
+ * @{
+ */
+#define IS_TMR0_WHEEL_UNIT(x)                                                  \
+(   ((x) == CM_TMR0_1)                          ||                             \
+    ((x) == CM_TMR0_2))
+
+#define IS_TMR0_WHEEL_CH(x)                                                    \
+(   ((x) == TMR0_CH_A)                          ||                             \
+    ((x) == TMR0_CH_B))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup TMR0_WHEEL_Local_Functions
+ * @{
+ */
+static void TMR0_WHEEL_Insert(stc_tmr0_wheel_timer_t *pstcTimer);
+static void TMR0_WHEEL_Remove(stc_tmr0_wheel_timer_t *pstcTimer);
+static uint32_t TMR0_WHEEL_NextEvent(void);
+static void TMR0_WHEEL_ProcessTick(void);
+static void TMR0_WHEEL_Advance(uint32_t u32Target);
+static uint32_t TMR0_WHEEL_Elapsed(en_flag_status_t *penPending);
+static void TMR0_WHEEL_Program(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Local_Variables TMR0_WHEEL Local Variables
+ * @{
+ */
+static stc_tmr0_wheel_timer_t *m_apstcSlot[TMR0_WHEEL_LEVEL_NUM * TMR0_WHEEL_SLOT_NUM];
+static uint32_t m_au32Occupied[TMR0_WHEEL_LEVEL_NUM];
+
+static CM_TMR0_TypeDef *m_pstcTmr0 = NULL;
+static uint32_t m_u32Ch = TMR0_CH_A;
+static uint32_t m_u32CntPerTick = 0UL;
+static uint32_t m_u32MaxHwTicks = 0UL;
+
+/* Tick the wheel has been processed up to, the counter counts from there */
+static uint32_t m_u32Now = 0UL;
+/* Ticks of the running counter period */
+static uint32_t m_u32HwTicks = 0UL;
+static uint32_t m_u32InIsr = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Global_Functions TMR0_WHEEL Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_tmr0_wheel_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_tmr0_wheel_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t TMR0_WHEEL_StructInit(stc_tmr0_wheel_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->pstcTmr0 = CM_TMR0_1;
+        pstcInit->u32Ch = TMR0_CH_A;
+        pstcInit->u32TickFreq = 1000UL;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI03;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the timer channel and start the wheel with no timer.
+ * @param  [in] pstcInit                Pointer to a stc_tmr0_wheel_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       No clock division gives a whole number
+ *                                      of at least 8 counts per tick
+ * @note   The largest division that fits is used, which gives the longest
+ *         time between interrupts while idle.
+ */
+en_result_t TMR0_WHEEL_Init(const stc_tmr0_wheel_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_clock_freq_t stcClkFreq;
+    stc_tmr0_init_t stcTmr0Init;
+    IRQn_Type enIRQn;
+    uint32_t u32Div;
+    uint32_t u32Freq;
+    uint32_t u32Cnt = 0UL;
+    uint32_t i;
+
+    if ((pstcInit != NULL) && (pstcInit->u32TickFreq != 0UL))
+    {
+        DDL_ASSERT(IS_TMR0_WHEEL_UNIT(pstcInit->pstcTmr0));
+        DDL_ASSERT(IS_TMR0_WHEEL_CH(pstcInit->u32Ch));
+
+        (void)CLK_GetClockFreq(&stcClkFreq);
+        for (u32Div = TMR0_WHEEL_CLK_DIV_NUM; u32Div > 0UL; u32Div--)
+        {
+            u32Freq = stcClkFreq.u32Pclk1Freq >> (u32Div - 1UL);
+            u32Cnt = u32Freq / pstcInit->u32TickFreq;
+            if (((u32Freq << (u32Div - 1UL)) == stcClkFreq.u32Pclk1Freq) &&
+                ((u32Cnt * pstcInit->u32TickFreq) == u32Freq) &&
+                (u32Cnt >= TMR0_WHEEL_CNT_PER_TICK_MIN) && (u32Cnt < TMR0_WHEEL_CNT_MAX))
+            {
+                enRet = Ok;
+                break;
+            }
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        m_pstcTmr0 = pstcInit->pstcTmr0;
+        m_u32Ch = pstcInit->u32Ch;
+        m_u32CntPerTick = u32Cnt;
+        m_u32MaxHwTicks = TMR0_WHEEL_CNT_MAX / u32Cnt;
+
+        for (i = 0UL; i < (TMR0_WHEEL_LEVEL_NUM * TMR0_WHEEL_SLOT_NUM); i++)
+        {
+            m_apstcSlot[i] = NULL;
+        }
+        for (i = 0UL; i < TMR0_WHEEL_LEVEL_NUM; i++)
+        {
+            m_au32Occupied[i] = 0UL;
+        }
+        m_u32Now = 0UL;
+        m_u32HwTicks = m_u32MaxHwTicks;
+        m_u32InIsr = 0UL;
+
+        (void)TMR0_StructInit(&stcTmr0Init);
+        stcTmr0Init.u32ClockSrc = TMR0_SYNC_CLK_PCLK;
+        stcTmr0Init.u32ClockDiv = (u32Div - 1UL) << TMR0_BCONR_CKDIVA_POS;
+        stcTmr0Init.u16PeriodValue = (uint16_t)((m_u32HwTicks * m_u32CntPerTick) - 1UL);
+        TMR0_Stop(m_pstcTmr0, m_u32Ch);
+        (void)TMR0_Init(m_pstcTmr0, m_u32Ch, &stcTmr0Init);
+        TMR0_SetCountValue(m_pstcTmr0, m_u32Ch, 0U);
+        TMR0_ClearStatus(m_pstcTmr0, m_u32Ch);
+        TMR0_IntCmd(m_pstcTmr0, m_u32Ch, Enable);
+
+        enIRQn = (IRQn_Type)((uint32_t)TMR0_1_GCMA_IRQn + m_u32Ch +
+                             ((m_pstcTmr0 == CM_TMR0_2) ? 2UL : 0UL));
+        NVIC_ClearPendingIRQ(enIRQn);
+        NVIC_SetPriority(enIRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(enIRQn);
+
+        TMR0_Start(m_pstcTmr0, m_u32Ch);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the wheel. Running timers are abandoned.
+ * @param  None
+ * @retval None
+ */
+void TMR0_WHEEL_DeInit(void)
+{
+    if (m_pstcTmr0 != NULL)
+    {
+        TMR0_Stop(m_pstcTmr0, m_u32Ch);
+        TMR0_IntCmd(m_pstcTmr0, m_u32Ch, Disable);
+        TMR0_ClearStatus(m_pstcTmr0, m_u32Ch);
+        NVIC_DisableIRQ((IRQn_Type)((uint32_t)TMR0_1_GCMA_IRQn + m_u32Ch +
+                                    ((m_pstcTmr0 == CM_TMR0_2) ? 2UL : 0UL)));
+        m_pstcTmr0 = NULL;
+    }
+}
+
+/**
+ * @brief  Prepare a timer before its first start.
+ * @param  [out] pstcTimer              Pointer to a stc_tmr0_wheel_timer_t structure.
+ * @param  [in] pfnCallback             Expiry callback.
+ * @param  [in] pvArg                   Callback argument.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcTimer == NULL or pfnCallback == NULL
+ */
+en_result_t TMR0_WHEEL_TimerInit(stc_tmr0_wheel_timer_t *pstcTimer,
+                                 func_ptr_tmr0_wheel_t pfnCallback, void *pvArg)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcTimer != NULL) && (pfnCallback != NULL))
+    {
+        pstcTimer->pstcNext = NULL;
+        pstcTimer->pstcPrev = NULL;
+        pstcTimer->u32Expiry = 0UL;
+        pstcTimer->u32Period = 0UL;
+        pstcTimer->u32Slot = TMR0_WHEEL_SLOT_NONE;
+        pstcTimer->pfnCallback = pfnCallback;
+        pstcTimer->pvArg = pvArg;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start or restart a timer.
+ * @param  [in] pstcTimer               Pointer to a timer prepared by TMR0_WHEEL_TimerInit().
+ * @param  [in] u32Timeout              Ticks until the first expiry, 0 is taken as 1.
+ * @param  [in] u32Period               Ticks between later expiries, 0 for one shot.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcTimer == NULL or the wheel is not initialized
+ * @note   Periodic expiries are counted from the previous expiry, not from
+ *         the callback, so they do not drift. May be called from any
+ *         interrupt, the wheel is updated in a critical section.
+ */
+en_result_t TMR0_WHEEL_TimerStart(stc_tmr0_wheel_timer_t *pstcTimer,
+                                  uint32_t u32Timeout, uint32_t u32Period)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    en_flag_status_t enPending;
+    uint32_t u32Elapsed;
+    uint32_t u32Primask;
+
+    if ((pstcTimer != NULL) && (pstcTimer->pfnCallback != NULL) && (m_pstcTmr0 != NULL))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+
+        if (pstcTimer->u32Slot != TMR0_WHEEL_SLOT_NONE)
+        {
+            TMR0_WHEEL_Remove(pstcTimer);
+        }
+
+        u32Elapsed = TMR0_WHEEL_Elapsed(&enPending);
+        pstcTimer->u32Expiry = m_u32Now + u32Elapsed + ((u32Timeout == 0UL) ? 1UL : u32Timeout);
+        pstcTimer->u32Period = u32Period;
+        TMR0_WHEEL_Insert(pstcTimer);
+
+        /* An expired period or the interrupt itself programs the next compare */
+        if ((0UL == m_u32InIsr) && (Reset == enPending))
+        {
+            TMR0_WHEEL_Program();
+        }
+
+        __set_PRIMASK(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop a timer. Stopping an idle timer has no effect.
+ * @param  [in] pstcTimer               Pointer to a stc_tmr0_wheel_timer_t structure.
+ * @retval None
+ */
+void TMR0_WHEEL_TimerStop(stc_tmr0_wheel_timer_t *pstcTimer)
+{
+    uint32_t u32Primask;
+
+    if (pstcTimer != NULL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        if (pstcTimer->u32Slot != TMR0_WHEEL_SLOT_NONE)
+        {
+            TMR0_WHEEL_Remove(pstcTimer);
+        }
+        __set_PRIMASK(u32Primask);
+    }
+}
+
+/**
+ * @brief  Check whether a timer is running.
+ * @param  [in] pstcTimer               Pointer to a stc_tmr0_wheel_timer_t structure.
+ * @retval An en_functional_state_t enumeration value:
+ *   @arg  Enable:                      Running
+ *   @arg  Disable:                     Idle
+ */
+en_functional_state_t TMR0_WHEEL_TimerIsRunning(const stc_tmr0_wheel_timer_t *pstcTimer)
+{
+    en_functional_state_t enRet = Disable;
+
+    if ((pstcTimer != NULL) && (pstcTimer->u32Slot != TMR0_WHEEL_SLOT_NONE))
+    {
+        enRet = Enable;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the current tick.
+ * @param  None
+ * @retval Ticks since TMR0_WHEEL_Init(), wraps at 2^32.
+ */
+uint32_t TMR0_WHEEL_GetTick(void)
+{
+    en_flag_status_t enPending;
+    uint32_t u32Tick = 0UL;
+    uint32_t u32Primask;
+
+    if (m_pstcTmr0 != NULL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        u32Tick = m_u32Now + TMR0_WHEEL_Elapsed(&enPending);
+        __set_PRIMASK(u32Primask);
+    }
+
+    return u32Tick;
+}
+
+/**
+ * @brief  Get the ticks until the wheel next needs the CPU.
+ * @param  None
+ * @retval Ticks from now, 0 if due, TMR0_WHEEL_NO_DEADLINE if no timer runs.
+ * @note   The result may be earlier than the next expiry when a long timer
+ *         has to be re-filed first.
+ */
+uint32_t TMR0_WHEEL_GetNextDeadline(void)
+{
+    en_flag_status_t enPending;
+    uint32_t u32Next = TMR0_WHEEL_NO_DEADLINE;
+    uint32_t u32Elapsed;
+    uint32_t u32Primask;
+
+    if (m_pstcTmr0 != NULL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        u32Next = TMR0_WHEEL_NextEvent();
+        if (u32Next != TMR0_WHEEL_NO_DEADLINE)
+        {
+            u32Elapsed = TMR0_WHEEL_Elapsed(&enPending);
+            u32Next = (u32Next > u32Elapsed) ? (u32Next - u32Elapsed) : 0UL;
+        }
+        __set_PRIMASK(u32Primask);
+    }
+
+    return u32Next;
+}
+
+/**
+ * @brief  TMR0 compare interrupt handler of the wheel.
+ * @param  None
+ * @retval None
+ * @note   Runs with interrupts disabled, the expiry callbacks included, so
+ *         TMR0_WHEEL_TimerStart() and TMR0_WHEEL_TimerStop() called from any
+ *         other interrupt never see the wheel half advanced.
+ */
+void TMR0_WHEEL_IrqHandler(void)
+{
+    uint32_t u32Primask;
+
+    if ((m_pstcTmr0 != NULL) && (Set == TMR0_GetStatus(m_pstcTmr0, m_u32Ch)))
+    {
+        /* An interrupt preempting the wheel would see detached slot lists and a stale m_u32Now */
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        TMR0_ClearStatus(m_pstcTmr0, m_u32Ch);
+        m_u32InIsr = 1UL;
+        TMR0_WHEEL_Advance(m_u32Now + m_u32HwTicks);
+        m_u32InIsr = 0UL;
+        TMR0_WHEEL_Program();
+        __set_PRIMASK(u32Primask);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TMR0_WHEEL_Local_Functions TMR0_WHEEL Local Functions
+ * @{
+ */
+
+/**
+ * @brief  File a timer in the slot of its expiry tick.
+ * @param  [in] pstcTimer               Pointer to a stc_tmr0_wheel_timer_t structure.
+ * @retval None
+ */
+static void TMR0_WHEEL_Insert(stc_tmr0_wheel_timer_t *pstcTimer)
+{
+    uint32_t u32Delta;
+    uint32_t u32Pos;
+    uint32_t u32Level = 0UL;
+    uint32_t u32Slot;
+
+    u32Delta = pstcTimer->u32Expiry - m_u32Now;
+    if ((int32_t)u32Delta < 0)
+    {
+        /* Late, expire on the tick being processed */
+        pstcTimer->u32Expiry = m_u32Now;
+        u32Delta = 0UL;
+    }
+
+    /* Beyond the wheel range: park at the far end, re-filed from there */
+    u32Pos = pstcTimer->u32Expiry;
+    if (u32Delta > TMR0_WHEEL_RANGE)
+    {
+        u32Pos = m_u32Now + TMR0_WHEEL_RANGE;
+        u32Delta = TMR0_WHEEL_RANGE;
+    }
+
+    while ((u32Level < (TMR0_WHEEL_LEVEL_NUM - 1UL)) &&
+           ((u32Delta >> ((u32Level + 1UL) * TMR0_WHEEL_SLOT_BITS)) != 0UL))
+    {
+        u32Level++;
+    }
+
+    u32Slot = (u32Pos >> (u32Level * TMR0_WHEEL_SLOT_BITS)) & TMR0_WHEEL_SLOT_MASK;
+    m_au32Occupied[u32Level] |= (1UL << u32Slot);
+    u32Slot += u32Level * TMR0_WHEEL_SLOT_NUM;
+
+    pstcTimer->u32Slot = u32Slot;
+    pstcTimer->pstcPrev = NULL;
+    pstcTimer->pstcNext = m_apstcSlot[u32Slot];
+    if (pstcTimer->pstcNext != NULL)
+    {
+        pstcTimer->pstcNext->pstcPrev = pstcTimer;
+    }
+    m_apstcSlot[u32Slot] = pstcTimer;
+}
+
+/**
+ * @brief  Unlink a timer from its slot.
+ * @param  [in] pstcTimer               Pointer to a filed stc_tmr0_wheel_timer_t structure.
+ * @retval None
+ */
+static void TMR0_WHEEL_Remove(stc_tmr0_wheel_timer_t *pstcTimer)
+{
+    const uint32_t u32Slot = pstcTimer->u32Slot;
+
+    if (pstcTimer->pstcPrev != NULL)
+    {
+        pstcTimer->pstcPrev->pstcNext = pstcTimer->pstcNext;
+    }
+    else
+    {
+        m_apstcSlot[u32Slot] = pstcTimer->pstcNext;
+    }
+    if (pstcTimer->pstcNext != NULL)
+    {
+        pstcTimer->pstcNext->pstcPrev = pstcTimer->pstcPrev;
+    }
+    if (NULL == m_apstcSlot[u32Slot])
+    {
+        m_au32Occupied[u32Slot / TMR0_WHEEL_SLOT_NUM] &= ~(1UL << (u32Slot & TMR0_WHEEL_SLOT_MASK));
+    }
+
+    pstcTimer->pstcNext = NULL;
+    pstcTimer->pstcPrev = NULL;
+    pstcTimer->u32Slot = TMR0_WHEEL_SLOT_NONE;
+}
+
+/**
+ * @brief  Ticks from m_u32Now to the next tick with work: a level 0 expiry
+ *         or the turn of a non-empty higher level slot.
+ * @param  None
+ * @retval 1 ~ TMR0_WHEEL_RANGE + 1, TMR0_WHEEL_NO_DEADLINE if the wheel is empty.
+ */
+static uint32_t TMR0_WHEEL_NextEvent(void)
+{
+    uint32_t u32Min = TMR0_WHEEL_NO_DEADLINE;
+    uint32_t u32Occupied;
+    uint32_t u32After;
+    uint32_t u32Shift;
+    uint32_t u32Idx;
+    uint32_t u32Dist;
+    uint32_t u32Ticks;
+    uint32_t u32Level;
+
+    for (u32Level = 0UL; u32Level < TMR0_WHEEL_LEVEL_NUM; u32Level++)
+    {
+        u32Occupied = m_au32Occupied[u32Level];
+        if (u32Occupied != 0UL)
+        {
+            u32Shift = u32Level * TMR0_WHEEL_SLOT_BITS;
+            u32Idx = (m_u32Now >> u32Shift) & TMR0_WHEEL_SLOT_MASK;
+
+            /* Slots after the current one come first, the current one last */
+            u32After = u32Occupied & ~((2UL << u32Idx) - 1UL);
+            if (u32After != 0UL)
+            {
+                u32Dist = TMR0_WHEEL_CTZ(u32After) - u32Idx;
+            }
+            else
+            {
+                u32Dist = (TMR0_WHEEL_CTZ(u32Occupied) + TMR0_WHEEL_SLOT_NUM) - u32Idx;
+            }
+
+            u32Ticks = (((m_u32Now >> u32Shift) + u32Dist) << u32Shift) - m_u32Now;
+            if (u32Ticks < u32Min)
+            {
+                u32Min = u32Ticks;
+            }
+        }
+    }
+
+    return u32Min;
+}
+
+/**
+ * @brief  Do the work of tick m_u32Now: re-file the higher level slots that
+ *         turn, then expire the level 0 slot.
+ * @param  None
+ * @retval None
+ */
+static void TMR0_WHEEL_ProcessTick(void)
+{
+    stc_tmr0_wheel_timer_t *pstcTimer;
+    stc_tmr0_wheel_timer_t *pstcNext;
+    uint32_t u32Shift;
+    uint32_t u32Slot;
+    uint32_t u32Level;
+
+    for (u32Level = TMR0_WHEEL_LEVEL_NUM - 1UL; u32Level > 0UL; u32Level--)
+    {
+        u32Shift = u32Level * TMR0_WHEEL_SLOT_BITS;
+        if ((m_u32Now & ((1UL << u32Shift) - 1UL)) == 0UL)
+        {
+            u32Slot = (m_u32Now >> u32Shift) & TMR0_WHEEL_SLOT_MASK;
+            pstcTimer = m_apstcSlot[(u32Level * TMR0_WHEEL_SLOT_NUM) + u32Slot];
+            m_apstcSlot[(u32Level * TMR0_WHEEL_SLOT_NUM) + u32Slot] = NULL;
+            m_au32Occupied[u32Level] &= ~(1UL << u32Slot);
+            while (pstcTimer != NULL)
+            {
+                pstcNext = pstcTimer->pstcNext;
+                TMR0_WHEEL_Insert(pstcTimer);
+                pstcTimer = pstcNext;
+            }
+        }
+    }
+
+    u32Slot = m_u32Now & TMR0_WHEEL_SLOT_MASK;
+    pstcTimer = m_apstcSlot[u32Slot];
+    while (pstcTimer != NULL)
+    {
+        TMR0_WHEEL_Remove(pstcTimer);
+        if (pstcTimer->u32Period != 0UL)
+        {
+            pstcTimer->u32Expiry += pstcTimer->u32Period;
+            TMR0_WHEEL_Insert(pstcTimer);
+        }
+        pstcTimer->pfnCallback(pstcTimer->pvArg);
+        pstcTimer = m_apstcSlot[u32Slot];
+    }
+}
+
+/**
+ * @brief  Advance the wheel to a tick, doing the work of the ticks on the way.
+ * @param  [in] u32Target               Tick to advance to.
+ * @retval None
+ */
+static void TMR0_WHEEL_Advance(uint32_t u32Target)
+{
+    uint32_t u32Next;
+
+    for (;;)
+    {
+        u32Next = TMR0_WHEEL_NextEvent();
+        if ((u32Next == TMR0_WHEEL_NO_DEADLINE) || (u32Next > (u32Target - m_u32Now)))
+        {
+            m_u32Now = u32Target;
+            break;
+        }
+        m_u32Now += u32Next;
+        TMR0_WHEEL_ProcessTick();
+    }
+}
+
+/**
+ * @brief  Whole ticks counted since m_u32Now.
+ * @param  [out] penPending             Set if a compare match is waiting for its interrupt.
+ * @retval Elapsed ticks
+ */
+static uint32_t TMR0_WHEEL_Elapsed(en_flag_status_t *penPending)
+{
+    uint32_t u32Cnt;
+    uint32_t u32Ticks;
+
+    *penPending = Reset;
+    if (0UL != m_u32InIsr)
+    {
+        u32Ticks = 0UL;
+    }
+    else
+    {
+        u32Cnt = TMR0_GetCountValue(m_pstcTmr0, m_u32Ch);
+        *penPending = TMR0_GetStatus(m_pstcTmr0, m_u32Ch);
+        u32Ticks = 0UL;
+        if (Set == *penPending)
+        {
+            /* The counter restarted, the count read before may be from either period */
+            u32Cnt = TMR0_GetCountValue(m_pstcTmr0, m_u32Ch);
+            u32Ticks = m_u32HwTicks;
+        }
+        u32Ticks += u32Cnt / m_u32CntPerTick;
+    }
+
+    return u32Ticks;
+}
+
+/**
+ * @brief  Set the compare value of the running period to the next tick with
+ *         work, but never behind the counter.
+ * @param  None
+ * @retval None
+ */
+static void TMR0_WHEEL_Program(void)
+{
+    uint32_t u32Ticks;
+    uint32_t u32MinTicks;
+
+    u32Ticks = TMR0_WHEEL_NextEvent();
+    if (u32Ticks > m_u32MaxHwTicks)
+    {
+        u32Ticks = m_u32MaxHwTicks;
+    }
+
+    u32MinTicks = ((TMR0_GetCountValue(m_pstcTmr0, m_u32Ch) + TMR0_WHEEL_GUARD_CNT) / m_u32CntPerTick) + 1UL;
+    if (u32Ticks < u32MinTicks)
+    {
+        /* Already late: the wheel catches up at the next interrupt */
+        u32Ticks = (u32MinTicks > m_u32MaxHwTicks) ? m_u32MaxHwTicks : u32MinTicks;
+    }
+
+    m_u32HwTicks = u32Ticks;
+    TMR0_SetCompareValue(m_pstcTmr0, m_u32Ch, (uint16_t)((u32Ticks * m_u32CntPerTick) - 1UL));
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMR0_WHEEL_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
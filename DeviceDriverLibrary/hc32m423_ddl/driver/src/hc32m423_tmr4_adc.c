@@ -0,0 +1,623 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmr4_adc.c
+ * @brief This file provides firmware functions for ADC current sampling
+ *        synchronized to the TMR4 PWM period.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_tmr4_adc.h"
+#include "hc32m423_adc.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_dma.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_tmr4.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_TMR4_ADC TMR4_ADC
+ * @brief TMR4 Synchronized ADC Current Sampling Driver Library
+ * @details With the counter in triangle mode and centre-aligned outputs
+ *          (e.g. TMR4_MOD), the low side switch of every phase is on around
+ *          the counter zero, so the middle of the low side on time is the
+ *          same instant for the three phases. One SEVT channel in compare
+ *          mode matches counting down, TMR4_ADC_GetTriggerAdvance() counts
+ *          before zero, so that the sampling windows of the sequence B scan
+ *          are centred on zero. EVT_TMR4_SCMxx starts sequence B, and
+ *          EVT_ADC_EOCB makes the DMA move the data registers to the next
+ *          frame of a ring, one frame per PWM period without the CPU.
+ *          The DMA block transfer complete interrupt reports each frame.
+ *          The placement is derived from the TMR4 registers, so TMR4 must be
+ *          configured before TMR4_ADC_Init(). The application enables the
+ *          ADC, AOS and DMA function clocks and calls ADC_Init().
+ * @{
+ */
+
+#if (DDL_TMR4_ADC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_ADC_Local_Macros TMR4_ADC Local Macros
+ * @{
+ */
+#define TMR4_ADC_ADC_UNIT               (CM_ADC)
+#define TMR4_ADC_DMA_UNIT               (CM_DMA)
+#define TMR4_ADC_TMR4_UNIT              (CM_TMR4)
+
+#define TMR4_ADC_NS_PER_SEC             (1000000000ULL)
+#define TMR4_ADC_DUTY_FULL              (32768UL)
+
+#define TMR4_ADC_LLP_POS                (DMA_CH0CTL0_LLP_POS - 4U)
+
+#define TMR4_ADC_DESC_CTL0(blk, cnt, next)                                     \
+(   (blk)                                               |                      \
+    ((cnt) << DMA_CH0CTL0_CNT_POS)                      |                      \
+    (((uint32_t)(next) << TMR4_ADC_LLP_POS) & DMA_CH0CTL0_LLP) |               \
+    DMA_LLP_ENABLE                                      |                      \
+    DMA_LLP_WAIT                                        |                      \
+    DMA_DATA_WIDTH_16BIT)
+
+#define TMR4_ADC_DESC_CTL1(blk)                                                \
+(   DMA_SRC_ADDR_MD_INC                                 |                      \
+    DMA_DEST_ADDR_MD_INC                                |                      \
+    DMA_RPT_ENABLE                                      |                      \
+    DMA_SRC_RPT                                         |                      \
+    ((blk) << DMA_CH0CTL1_RPTNSCNT_POS)                 |                      \
+    DMA_LLP_ADDR_RAM)
+
+/**
+ * @defgroup TMR4_ADC_Check_Parameters_Validity TMR4_ADC Check Parameters Validity
+ * @{
+ */
+#define IS_TMR4_ADC_SEVT_CH(x)          ((x) <= TMR4_SEVT_CH_WL)
+#define IS_TMR4_ADC_DMA_CH(x)           ((x) <= DMA_CH3)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup TMR4_ADC_Local_Functions
+ * @{
+ */
+static uint32_t TMR4_ADC_NsToCount(uint32_t u32Ns, uint32_t u32Clk, uint32_t u32Round);
+static void TMR4_ADC_Rewind(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_ADC_Local_Variables TMR4_ADC Local Variables
+ * @{
+ */
+#if defined (__ICCARM__)
+_Pragma("data_alignment=16")
+static stc_dma_llp_descriptor_t m_stcLlpDesc;
+#else
+static stc_dma_llp_descriptor_t m_stcLlpDesc __ALIGNED(16);
+#endif
+
+static uint32_t m_u32SevtCh = TMR4_SEVT_CH_UH;
+static uint32_t m_u32DmaCh = DMA_CH0;
+static uint16_t *m_pu16Buf = NULL;
+static uint32_t m_u32FrameLen = 0UL;
+static uint32_t m_u32FrameNum = 0UL;
+static uint32_t m_u32FirstChNum = 0UL;
+static func_ptr_tmr4_adc_frame_t m_pfnFrameCallback = NULL;
+
+static uint16_t m_u16Peak = 0U;
+static uint16_t m_u16Advance = 0U;
+static uint16_t m_u16MinCompare = 0U;
+
+static uint32_t m_u32NextIdx = 0UL;
+static __IO uint32_t m_u32LatestIdx = 0UL;
+static __IO uint32_t m_u32FrameCnt = 0UL;
+static __IO uint32_t m_u32MissedCnt = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_ADC_Global_Functions TMR4_ADC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_tmr4_adc_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_tmr4_adc_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t TMR4_ADC_StructInit(stc_tmr4_adc_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32SevtCh = TMR4_SEVT_CH_UH;
+        pstcInit->u32AdcCh = 0UL;
+        pstcInit->pu8SampleTime = NULL;
+        pstcInit->u32SampleTimeNs = 500UL;
+        pstcInit->u32ConvTimeNs = 1000UL;
+        pstcInit->u32GuardNs = 1000UL;
+        pstcInit->u32DmaCh = DMA_CH0;
+        pstcInit->pu16Buf = NULL;
+        pstcInit->u32FrameNum = 2UL;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI01;
+        pstcInit->pfnFrameCallback = NULL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Place the SEVT trigger and initialize sequence B and the DMA ring.
+ * @param  [in] pstcInit                Pointer to a stc_tmr4_adc_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration, TMR4 is not in
+ *                                      triangle mode, or the sampling window
+ *                                      does not fit in a PWM period
+ * @note   Sequence B is added to the current scan mode of the ADC.
+ *         Call TMR4_ADC_DmaBtc_IrqHandler() from DMA_BTCx_IrqHandler() of
+ *         the channel given by u32DmaCh.
+ */
+en_result_t TMR4_ADC_Init(const stc_tmr4_adc_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_clock_freq_t stcClkFreq;
+    stc_tmr4_sevt_init_t stcSevtInit;
+    stc_adc_trigger_config_t stcTrigCfg;
+    uint32_t u32AdcCh;
+    uint32_t u32ChCnt = 0UL;
+    uint32_t u32LastChNum = 0UL;
+    uint32_t u32Clk;
+    uint32_t u32Window;
+    uint32_t u32Peak;
+    uint32_t i;
+    uint16_t u16ScanMode;
+    IRQn_Type enIRQn;
+
+    if ((pstcInit != NULL) && (pstcInit->pu8SampleTime != NULL) &&
+        (pstcInit->pu16Buf != NULL) &&
+        ((pstcInit->u32AdcCh & (uint32_t)ADC_CH_ALL) != 0UL) &&
+        (pstcInit->u32FrameNum != 0UL) &&
+        (pstcInit->u32FrameNum <= TMR4_ADC_FRAME_NUM_MAX) &&
+        (READ_REG16_BIT(TMR4_ADC_TMR4_UNIT->CCSR, TMR4_CCSR_MODE) == TMR4_CNT_MD_TRIANGLE))
+    {
+        DDL_ASSERT(IS_TMR4_ADC_SEVT_CH(pstcInit->u32SevtCh));
+        DDL_ASSERT(IS_TMR4_ADC_DMA_CH(pstcInit->u32DmaCh));
+
+        u32AdcCh = pstcInit->u32AdcCh & (uint32_t)ADC_CH_ALL;
+        m_u32FirstChNum = ADC_CH_CNT;
+        for (i = 0UL; i < ADC_CH_CNT; i++)
+        {
+            if ((u32AdcCh & (1UL << i)) != 0UL)
+            {
+                if (m_u32FirstChNum == ADC_CH_CNT)
+                {
+                    m_u32FirstChNum = i;
+                }
+                u32LastChNum = i;
+                u32ChCnt++;
+            }
+        }
+
+        /* The sampling windows span (n - 1) conversions plus one window, centred on zero */
+        (void)CLK_GetClockFreq(&stcClkFreq);
+        u32Clk = stcClkFreq.u32Pclk1Freq >>
+                 ((uint32_t)READ_REG16_BIT(TMR4_ADC_TMR4_UNIT->CCSR, TMR4_CCSR_CKDIV) >> TMR4_CCSR_CKDIV_POS);
+        u32Window = ((u32ChCnt - 1UL) * pstcInit->u32ConvTimeNs) + pstcInit->u32SampleTimeNs;
+        u32Peak = READ_REG16(TMR4_ADC_TMR4_UNIT->CPSR);
+        m_u16Advance = (uint16_t)TMR4_ADC_NsToCount(u32Window / 2UL, u32Clk, 0UL);
+        m_u16MinCompare = (uint16_t)(TMR4_ADC_NsToCount(u32Window - (u32Window / 2UL), u32Clk, 1UL) +
+                                     TMR4_ADC_NsToCount(pstcInit->u32GuardNs, u32Clk, 1UL));
+        if (m_u16MinCompare < m_u16Advance)
+        {
+            m_u16MinCompare = m_u16Advance;
+        }
+
+        if ((u32Peak != 0UL) && (m_u16MinCompare < u32Peak))
+        {
+            enRet = Ok;
+        }
+    }
+
+    if (enRet == Ok)
+    {
+        m_u16Peak = (uint16_t)u32Peak;
+        m_u32SevtCh = pstcInit->u32SevtCh;
+        m_u32DmaCh = pstcInit->u32DmaCh;
+        m_pu16Buf = pstcInit->pu16Buf;
+        m_u32FrameLen = u32LastChNum - m_u32FirstChNum + 1UL;
+        m_u32FrameNum = pstcInit->u32FrameNum;
+        m_pfnFrameCallback = pstcInit->pfnFrameCallback;
+        m_u32FrameCnt = 0UL;
+
+        /* Match counting down m_u16Advance counts before zero, or at zero */
+        (void)TMR4_SEVT_StructInit(&stcSevtInit);
+        stcSevtInit.u16Mode = TMR4_SEVT_MD_CMP;
+        stcSevtInit.u16CompareValue = m_u16Advance;
+        stcSevtInit.u16CountCompareType = (m_u16Advance != 0U) ? TMR4_SEVT_CNT_CMP_DOWN : TMR4_SEVT_CNT_CMP_ZERO;
+        stcSevtInit.u16BufCond = TMR4_SEVT_BUF_COND_IMMED;
+        /* EVT_TMR4_SCMxx follow the output event index, use the one of the channel */
+        stcSevtInit.u16OutputEvent = (uint16_t)(m_u32SevtCh << TMR4_SCSR_EVTOS_POS);
+        enRet = TMR4_SEVT_Init(TMR4_ADC_TMR4_UNIT, m_u32SevtCh, &stcSevtInit);
+    }
+
+    if (enRet == Ok)
+    {
+        u16ScanMode = READ_REG16_BIT(TMR4_ADC_ADC_UNIT->CR0, ADC_CR0_MS);
+        if (u16ScanMode == ADC_MD_SA_SSHOT)
+        {
+            ADC_SetScanMode(TMR4_ADC_ADC_UNIT, ADC_MD_SA_SB_SSHOT);
+        }
+        else if (u16ScanMode == ADC_MD_SA_CONT)
+        {
+            ADC_SetScanMode(TMR4_ADC_ADC_UNIT, ADC_MD_SA_CONT_SB_SSHOT);
+        }
+        else
+        {
+            /* Sequence B already in use */
+        }
+        enRet = ADC_ChCmd(TMR4_ADC_ADC_UNIT, ADC_SEQ_B, u32AdcCh, pstcInit->pu8SampleTime, Enable);
+    }
+
+    if (enRet == Ok)
+    {
+        (void)ADC_TriggerSrcStructInit(&stcTrigCfg);
+        stcTrigCfg.u16TriggerSrc = ADC_TRIG_SRC_EVT0;
+        /* Output event m_u32SevtCh of the SEVT above */
+        stcTrigCfg.enEvent0 = (en_event_src_t)((uint32_t)EVT_TMR4_SCMUH + m_u32SevtCh);
+        enRet = ADC_TriggerSrcConfig(TMR4_ADC_ADC_UNIT, ADC_SEQ_B, &stcTrigCfg);
+    }
+
+    if (enRet == Ok)
+    {
+        /* One frame per EOCB, the descriptor links to itself to wrap the ring */
+        m_stcLlpDesc.SARx = (uint32_t)(&TMR4_ADC_ADC_UNIT->DR0 + m_u32FirstChNum);
+        m_stcLlpDesc.DARx = (uint32_t)&m_pu16Buf[0U];
+        m_stcLlpDesc.CHxCTL0 = TMR4_ADC_DESC_CTL0(m_u32FrameLen, m_u32FrameNum, &m_stcLlpDesc);
+        m_stcLlpDesc.CHxCTL1 = TMR4_ADC_DESC_CTL1(m_u32FrameLen);
+
+        DMA_ChCmd(TMR4_ADC_DMA_UNIT, m_u32DmaCh, Disable);
+        TMR4_ADC_Rewind();
+        DMA_SetTriggerSrc(TMR4_ADC_DMA_UNIT, m_u32DmaCh, EVT_ADC_EOCB);
+
+        enIRQn = (IRQn_Type)((uint32_t)DMA_BTC0_IRQn + m_u32DmaCh);
+        DMA_ClearTransIntStatus(TMR4_ADC_DMA_UNIT, (DMA_INT_BTC0 << m_u32DmaCh));
+        DMA_TransIntCmd(TMR4_ADC_DMA_UNIT, (DMA_INT_BTC0 << m_u32DmaCh), Enable);
+        NVIC_ClearPendingIRQ(enIRQn);
+        NVIC_SetPriority(enIRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(enIRQn);
+
+        DMA_Cmd(TMR4_ADC_DMA_UNIT, Enable);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the sampling pipeline.
+ * @param  None
+ * @retval None
+ * @note   The ADC channel selection and scan mode are left as they are.
+ */
+void TMR4_ADC_DeInit(void)
+{
+    if (m_u16Peak != 0U)
+    {
+        TMR4_ADC_Stop();
+        NVIC_DisableIRQ((IRQn_Type)((uint32_t)DMA_BTC0_IRQn + m_u32DmaCh));
+        DMA_TransIntCmd(TMR4_ADC_DMA_UNIT, (DMA_INT_BTC0 << m_u32DmaCh), Disable);
+        TMR4_SEVT_DeInit(TMR4_ADC_TMR4_UNIT, m_u32SevtCh);
+        m_pfnFrameCallback = NULL;
+        m_u16Peak = 0U;
+    }
+}
+
+/**
+ * @brief  Start sampling from frame 0 of the ring.
+ * @param  None
+ * @retval None
+ * @note   Frames are produced once the TMR4 counter runs.
+ */
+void TMR4_ADC_Start(void)
+{
+    if (m_u16Peak != 0U)
+    {
+        TMR4_ADC_Stop();
+        m_u32NextIdx = 0UL;
+        m_u32FrameCnt = 0UL;
+        m_u32MissedCnt = 0UL;
+        ADC_SeqClearStatus(TMR4_ADC_ADC_UNIT, ADC_SEQ_FLAG_EOCB);
+        DMA_ClearTransIntStatus(TMR4_ADC_DMA_UNIT, (DMA_INT_BTC0 << m_u32DmaCh));
+        DMA_ChCmd(TMR4_ADC_DMA_UNIT, m_u32DmaCh, Enable);
+        ADC_TriggerSrcCmd(TMR4_ADC_ADC_UNIT, ADC_SEQ_B, Enable);
+    }
+}
+
+/**
+ * @brief  Stop sampling.
+ * @param  None
+ * @retval None
+ */
+void TMR4_ADC_Stop(void)
+{
+    if (m_u16Peak != 0U)
+    {
+        ADC_TriggerSrcCmd(TMR4_ADC_ADC_UNIT, ADC_SEQ_B, Disable);
+        DMA_ChCmd(TMR4_ADC_DMA_UNIT, m_u32DmaCh, Disable);
+        TMR4_ADC_Rewind();
+    }
+}
+
+/**
+ * @brief  Get the frame length of a channel selection.
+ * @param  [in] u32AdcCh                Channels of sequence B, @ref ADC_Channel
+ * @retval Frame length in half words, from the lowest to the highest channel.
+ */
+uint32_t TMR4_ADC_GetFrameLen(uint32_t u32AdcCh)
+{
+    uint32_t u32Len = 0UL;
+    uint32_t u32Low = 0UL;
+    uint32_t u32High = ADC_CH_NUM_MAX;
+
+    u32AdcCh &= (uint32_t)ADC_CH_ALL;
+    if (u32AdcCh != 0UL)
+    {
+        while ((u32AdcCh & (1UL << u32Low)) == 0UL)
+        {
+            u32Low++;
+        }
+        while ((u32AdcCh & (1UL << u32High)) == 0UL)
+        {
+            u32High--;
+        }
+        u32Len = u32High - u32Low + 1UL;
+    }
+
+    return u32Len;
+}
+
+/**
+ * @brief  Get the position of a channel in a frame.
+ * @param  [in] u32ChNum                Channel number, @ref ADC_Channel_Number
+ * @retval Offset in half words.
+ */
+uint32_t TMR4_ADC_GetChOffset(uint32_t u32ChNum)
+{
+    DDL_ASSERT(u32ChNum >= m_u32FirstChNum);
+
+    return u32ChNum - m_u32FirstChNum;
+}
+
+/**
+ * @brief  Get the last complete frame.
+ * @param  None
+ * @retval Pointer to the frame, NULL if no frame since TMR4_ADC_Start().
+ */
+const uint16_t *TMR4_ADC_GetLatestFrame(void)
+{
+    const uint16_t *pu16Frame = NULL;
+
+    if (m_u32FrameCnt != 0UL)
+    {
+        pu16Frame = &m_pu16Buf[m_u32LatestIdx * m_u32FrameLen];
+    }
+
+    return pu16Frame;
+}
+
+/**
+ * @brief  Get the trigger position.
+ * @param  None
+ * @retval Counts before zero, counting down, at which sequence B is started.
+ */
+uint16_t TMR4_ADC_GetTriggerAdvance(void)
+{
+    return m_u16Advance;
+}
+
+/**
+ * @brief  Get the smallest low channel compare value that gives a valid sample.
+ * @param  None
+ * @retval Compare value. A phase whose compare value is lower has its low side
+ *         switched during the sampling window.
+ */
+uint16_t TMR4_ADC_GetMinCompare(void)
+{
+    return m_u16MinCompare;
+}
+
+/**
+ * @brief  Get the largest high side duty that gives a valid sample.
+ * @param  None
+ * @retval Duty in the scale of TMR4_MOD_SetDuty(), 32768 for 100%.
+ */
+uint16_t TMR4_ADC_GetMaxDuty(void)
+{
+    uint32_t u32Duty = 0UL;
+
+    if (m_u16Peak != 0U)
+    {
+        u32Duty = (((uint32_t)m_u16Peak - m_u16MinCompare) * TMR4_ADC_DUTY_FULL) / m_u16Peak;
+    }
+
+    return (uint16_t)u32Duty;
+}
+
+/**
+ * @brief  Get the number of frames not reported by the interrupt in time.
+ * @param  None
+ * @retval Missed frame count since TMR4_ADC_Start()
+ */
+uint32_t TMR4_ADC_GetMissedCount(void)
+{
+    return m_u32MissedCnt;
+}
+
+/**
+ * @brief  DMA block transfer complete interrupt handler, once per frame.
+ * @param  None
+ * @retval None
+ * @note   The completed frame is derived from the destination address the
+ *         DMA has moved on to, so frames completed while the interrupt was
+ *         held off are counted as missed and the newest one is reported.
+ */
+void TMR4_ADC_DmaBtc_IrqHandler(void)
+{
+    uint32_t u32Dest;
+    uint32_t u32Idx;
+    uint32_t u32Done;
+
+    DMA_ClearTransIntStatus(TMR4_ADC_DMA_UNIT, (DMA_INT_BTC0 << m_u32DmaCh));
+
+    u32Dest = DMA_GetDestAddr(TMR4_ADC_DMA_UNIT, m_u32DmaCh);
+    /* Frame the DMA writes next */
+    u32Idx = (u32Dest - (uint32_t)&m_pu16Buf[0U]) / (m_u32FrameLen * 2UL);
+    if (u32Idx >= m_u32FrameNum)
+    {
+        u32Idx = 0UL;
+    }
+
+    u32Done = (u32Idx + m_u32FrameNum - m_u32NextIdx) % m_u32FrameNum;
+    if (u32Done == 0UL)
+    {
+        u32Done = m_u32FrameNum;
+    }
+    m_u32MissedCnt += u32Done - 1UL;
+    m_u32NextIdx = u32Idx;
+    m_u32LatestIdx = (u32Idx + m_u32FrameNum - 1UL) % m_u32FrameNum;
+    m_u32FrameCnt += u32Done;
+
+    if (m_pfnFrameCallback != NULL)
+    {
+        m_pfnFrameCallback(&m_pu16Buf[m_u32LatestIdx * m_u32FrameLen], m_u32FrameCnt);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TMR4_ADC_Local_Functions TMR4_ADC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Convert a duration to TMR4 counts.
+ * @param  [in] u32Ns                   Duration in ns.
+ * @param  [in] u32Clk                  TMR4 count clock in Hz.
+ * @param  [in] u32Round                0: to nearest, 1: up.
+ * @retval Counts, saturated to 0xFFFF.
+ */
+static uint32_t TMR4_ADC_NsToCount(uint32_t u32Ns, uint32_t u32Clk, uint32_t u32Round)
+{
+    uint64_t u64Cnt = (uint64_t)u32Ns * u32Clk;
+
+    u64Cnt += (u32Round != 0UL) ? (TMR4_ADC_NS_PER_SEC - 1ULL) : (TMR4_ADC_NS_PER_SEC / 2ULL);
+    u64Cnt /= TMR4_ADC_NS_PER_SEC;
+
+    return (u64Cnt > 0xFFFFULL) ? 0xFFFFUL : (uint32_t)u64Cnt;
+}
+
+/**
+ * @brief  Load the ring descriptor into the DMA channel.
+ * @param  None
+ * @retval None
+ */
+static void TMR4_ADC_Rewind(void)
+{
+    stc_dma_init_t stcDmaInit;
+    stc_dma_repeat_init_t stcRptInit;
+    stc_dma_llp_init_t stcLlpInit;
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32SrcAddr = m_stcLlpDesc.SARx;
+    stcDmaInit.u32DestAddr = m_stcLlpDesc.DARx;
+    stcDmaInit.u32DataWidth = DMA_DATA_WIDTH_16BIT;
+    stcDmaInit.u32BlockSize = m_u32FrameLen;
+    stcDmaInit.u32TransCount = m_u32FrameNum;
+    stcDmaInit.u32SrcAddrMode = DMA_SRC_ADDR_MD_INC;
+    stcDmaInit.u32DestAddrMode = DMA_DEST_ADDR_MD_INC;
+    (void)DMA_Init(TMR4_ADC_DMA_UNIT, m_u32DmaCh, &stcDmaInit);
+
+    (void)DMA_RepeatStructInit(&stcRptInit);
+    stcRptInit.u32RepeatEn = DMA_RPT_ENABLE;
+    stcRptInit.u32RepeatSel = DMA_SRC_RPT;
+    stcRptInit.u32RepeatSize = m_u32FrameLen;
+    (void)DMA_RepeatInit(TMR4_ADC_DMA_UNIT, m_u32DmaCh, &stcRptInit);
+
+    (void)DMA_LlpStructInit(&stcLlpInit);
+    stcLlpInit.u32Llp = DMA_LLP_ENABLE;
+    stcLlpInit.u32LlpMode = DMA_LLP_WAIT;
+    stcLlpInit.u32LlpAddr = (uint32_t)&m_stcLlpDesc;
+    stcLlpInit.u32LlpAddrMode = DMA_LLP_ADDR_RAM;
+    (void)DMA_LlpInit(TMR4_ADC_DMA_UNIT, m_u32DmaCh, &stcLlpInit);
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMR4_ADC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
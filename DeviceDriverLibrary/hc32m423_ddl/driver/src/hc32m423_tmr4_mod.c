@@ -0,0 +1,531 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmr4_mod.c
+ * @brief This file provides firmware functions for three-phase PWM
+ *        modulation on TMR4.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_tmr4_mod.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_tmr4.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_TMR4_MOD TMR4_MOD
+ * @brief TMR4 Three-phase Modulation Driver Library
+ * @details The TMR4 counter runs in triangle mode. Each phase uses its low
+ *          OCO channel (OUL/OVL/OWL): the output goes high at the compare
+ *          match counting up and low counting down, so the on time is
+ *          centred on the peak. The PWM couple of each phase runs in dead
+ *          timer mode and drives the complementary OxH/OxL pair with the
+ *          dead time inserted by hardware.
+ *          The compare values are written to the OCCR buffers and move to
+ *          the active registers together at the zero and/or peak match.
+ *          Updates may be made from thread or interrupt context: the three
+ *          buffer writes are made with interrupts masked and never
+ *          straddle a transfer, so the three phases always change in the
+ *          same carrier period.
+ *          The voltage calculation is 16-bit fixed point with no table. The
+ *          application enables the TMR4 function clock and the pin
+ *          functions of the six outputs.
+ * @{
+ */
+
+#if (DDL_TMR4_MOD_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_MOD_Local_Macros TMR4_MOD Local Macros
+ * @{
+ */
+#define TMR4_MOD_PHASE_NUM              (3UL)
+#define TMR4_MOD_PWM_DIV_MAX            (7UL)
+#define TMR4_MOD_NS_PER_SEC             (1000000000ULL)
+/* CPU cycles for the three buffer writes, sets the guard band around a transfer */
+#define TMR4_MOD_WRITE_CYCLES           (32UL)
+
+/* 2 / sqrt(3) in Q14 */
+#define TMR4_MOD_2_DIV_SQRT3_Q14        (18919L)
+
+/**
+ * @defgroup TMR4_MOD_Check_Parameters_Validity TMR4_MOD Check Parameters Validity
+ * @{
+ */
+#define IS_TMR4_MOD_METHOD(x)                                                  \
+(   ((x) == TMR4_MOD_SPWM)                      ||                             \
+    ((x) == TMR4_MOD_THIPWM)                    ||                             \
+    ((x) == TMR4_MOD_SVPWM))
+
+#define IS_TMR4_MOD_UPDATE_COND(x)                                             \
+(   ((x) == TMR4_OCO_BUF_COND_UDF)              ||                             \
+    ((x) == TMR4_OCO_BUF_COND_OVF)              ||                             \
+    ((x) == TMR4_OCO_BUF_COND_UDF_OVF))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup TMR4_MOD_Local_Functions
+ * @{
+ */
+static uint16_t TMR4_MOD_DutyToCompare(int32_t i32Duty);
+static void TMR4_MOD_Write(uint16_t u16CmpU, uint16_t u16CmpV, uint16_t u16CmpW);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_MOD_Local_Variables TMR4_MOD Local Variables
+ * @{
+ */
+static const uint32_t m_au32OcoCh[TMR4_MOD_PHASE_NUM] = {
+    TMR4_OCO_CH_UL, TMR4_OCO_CH_VL, TMR4_OCO_CH_WL
+};
+static const uint32_t m_au32PwmCh[TMR4_MOD_PHASE_NUM] = {
+    TMR4_PWM_CH_U, TMR4_PWM_CH_V, TMR4_PWM_CH_W
+};
+
+static uint32_t m_u32Method = TMR4_MOD_SVPWM;
+static uint16_t m_u16UpdateCond = TMR4_OCO_BUF_COND_UDF;
+/* Peak count, 0 while not initialized */
+static uint16_t m_u16Peak = 0U;
+static uint16_t m_u16Guard = 1U;
+/* Poll limit of the guard band wait: each poll takes at least one HCLK cycle */
+static uint32_t m_u32GuardPollMax = 1UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR4_MOD_Global_Functions TMR4_MOD Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_tmr4_mod_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_tmr4_mod_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t TMR4_MOD_StructInit(stc_tmr4_mod_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32PwmFreq = 20000UL;
+        pstcInit->u32DeadTime = 1000UL;
+        pstcInit->u32Method = TMR4_MOD_SVPWM;
+        pstcInit->u16UpdateCond = TMR4_OCO_BUF_COND_UDF;
+        pstcInit->u32AbnormalPolarity = TMR4_PWM_ABNORMAL_POLARITY_LOW;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize TMR4 for three-phase modulation at 50% duty.
+ * @param  [in] pstcInit                Pointer to a stc_tmr4_mod_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL, the carrier frequency
+ *                                      is out of range, the dead time is
+ *                                      longer than a half period, or the period
+ *                                      is too short for the buffer writes
+ * @note   The counter clock division is the smallest that fits the carrier
+ *         period, for the finest duty resolution.
+ */
+en_result_t TMR4_MOD_Init(const stc_tmr4_mod_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_clock_freq_t stcClkFreq;
+    stc_tmr4_cnt_init_t stcCntInit;
+    stc_tmr4_oco_init_t stcOcoInit;
+    stc_tmr4_pwm_init_t stcPwmInit;
+    stc_oco_low_ch_compare_mode_t stcLowChCmpMode;
+    uint32_t u32Div;
+    uint32_t u32Clk = 0UL;
+    uint32_t u32Peak = 0UL;
+    uint32_t u32Dead;
+    uint32_t u32Guard;
+    uint32_t i;
+
+    if ((pstcInit != NULL) && (pstcInit->u32PwmFreq != 0UL))
+    {
+        DDL_ASSERT(IS_TMR4_MOD_METHOD(pstcInit->u32Method));
+        DDL_ASSERT(IS_TMR4_MOD_UPDATE_COND(pstcInit->u16UpdateCond));
+
+        (void)CLK_GetClockFreq(&stcClkFreq);
+        for (u32Div = 0UL; u32Div <= TMR4_MOD_PWM_DIV_MAX; u32Div++)
+        {
+            u32Clk = stcClkFreq.u32Pclk1Freq >> u32Div;
+            u32Peak = u32Clk / (2UL * pstcInit->u32PwmFreq);
+            if (u32Peak <= 0xFFFFUL)
+            {
+                break;
+            }
+        }
+
+        u32Dead = (uint32_t)(((uint64_t)pstcInit->u32DeadTime * u32Clk) / TMR4_MOD_NS_PER_SEC);
+        u32Guard = ((TMR4_MOD_WRITE_CYCLES * (u32Clk / 1000UL)) / (stcClkFreq.u32HclkFreq / 1000UL)) + 1UL;
+        /* TMR4_MOD_Write() needs a window between the guard bands to write the buffers */
+        if ((u32Div <= TMR4_MOD_PWM_DIV_MAX) && (u32Peak >= 4UL) && (u32Dead < u32Peak) &&
+            ((2UL * u32Guard) < u32Peak))
+        {
+            m_u16Peak = (uint16_t)u32Peak;
+            m_u16Guard = (uint16_t)u32Guard;
+            /* Two guard widths of count time in HCLK cycles */
+            m_u32GuardPollMax = ((2UL * u32Guard * (stcClkFreq.u32HclkFreq / 1000UL)) / (u32Clk / 1000UL)) + 1UL;
+            m_u32Method = pstcInit->u32Method;
+            m_u16UpdateCond = pstcInit->u16UpdateCond;
+
+            TMR4_CNT_Stop(CM_TMR4);
+            (void)TMR4_CNT_StructInit(&stcCntInit);
+            stcCntInit.u16ClockDiv = (uint16_t)(u32Div << TMR4_CCSR_CKDIV_POS);
+            stcCntInit.u16CountMode = TMR4_CNT_MD_TRIANGLE;
+            stcCntInit.u16PeriodValue = m_u16Peak;
+            (void)TMR4_CNT_Init(CM_TMR4, &stcCntInit);
+
+            /* Up count match: high, down count match: low */
+            stcLowChCmpMode.OCMRx = 0UL;
+            stcLowChCmpMode.OCMRx_f.OPDCL  = TMR4_OCO_LOW;
+            stcLowChCmpMode.OCMRx_f.OPUCL  = TMR4_OCO_HIGH;
+            stcLowChCmpMode.OCMRx_f.EOPDCL = TMR4_OCO_LOW;
+            stcLowChCmpMode.OCMRx_f.EOPUCL = TMR4_OCO_HIGH;
+
+            (void)TMR4_OCO_StructInit(&stcOcoInit);
+            stcOcoInit.u16CompareValue = (uint16_t)(m_u16Peak / 2U);
+            stcOcoInit.u16OcoInvalidPolarity = TMR4_OCO_INVD_LOW;
+            stcOcoInit.u16CompareValueBufCond = m_u16UpdateCond;
+
+            (void)TMR4_PWM_StructInit(&stcPwmInit);
+            stcPwmInit.u16Mode = TMR4_PWM_MD_DEAD_TIMER;
+            stcPwmInit.u16ClockDiv = (uint16_t)(u32Div << TMR4_POCR_DIVCK_POS);
+            stcPwmInit.u16Polarity = TMR4_PWM_OXH_HOLD_OXL_HOLD;
+            stcPwmInit.u32OXHPortOutMode = TMR4_PWM_PORT_OUTPUT_NORMAL;
+            stcPwmInit.u32OXLPortOutMode = TMR4_PWM_PORT_OUTPUT_NORMAL;
+            stcPwmInit.u32OXHAbnormalPolarity = pstcInit->u32AbnormalPolarity;
+            stcPwmInit.u32OXLAbnormalPolarity = pstcInit->u32AbnormalPolarity;
+
+            for (i = 0UL; i < TMR4_MOD_PHASE_NUM; i++)
+            {
+                (void)TMR4_OCO_Init(CM_TMR4, m_au32OcoCh[i], &stcOcoInit);
+                (void)TMR4_OCO_SetLowChCompareMode(CM_TMR4, m_au32OcoCh[i], &stcLowChCmpMode);
+                TMR4_OCO_Cmd(CM_TMR4, m_au32OcoCh[i], Enable);
+
+                (void)TMR4_PWM_Init(CM_TMR4, m_au32PwmCh[i], &stcPwmInit);
+                TMR4_PWM_SetDeadTimeValue(CM_TMR4, m_au32PwmCh[i], TMR4_PWM_PDAR_IDX, (uint16_t)u32Dead);
+                TMR4_PWM_SetDeadTimeValue(CM_TMR4, m_au32PwmCh[i], TMR4_PWM_PDBR_IDX, (uint16_t)u32Dead);
+            }
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize TMR4.
+ * @param  None
+ * @retval None
+ */
+void TMR4_MOD_DeInit(void)
+{
+    uint32_t i;
+
+    if (m_u16Peak != 0U)
+    {
+        TMR4_MOD_Stop();
+        for (i = 0UL; i < TMR4_MOD_PHASE_NUM; i++)
+        {
+            TMR4_OCO_DeInit(CM_TMR4, m_au32OcoCh[i]);
+            TMR4_PWM_DeInit(CM_TMR4, m_au32PwmCh[i]);
+        }
+        TMR4_CNT_DeInit(CM_TMR4);
+        m_u16Peak = 0U;
+    }
+}
+
+/**
+ * @brief  Start the counter and enable the outputs.
+ * @param  None
+ * @retval None
+ */
+void TMR4_MOD_Start(void)
+{
+    if (m_u16Peak != 0U)
+    {
+        TMR4_CNT_Start(CM_TMR4);
+        TMR4_PWM_MasterOutputCmd(CM_TMR4, Enable);
+    }
+}
+
+/**
+ * @brief  Put the outputs in the abnormal state and stop the counter.
+ * @param  None
+ * @retval None
+ */
+void TMR4_MOD_Stop(void)
+{
+    if (m_u16Peak != 0U)
+    {
+        TMR4_PWM_MasterOutputCmd(CM_TMR4, Disable);
+        TMR4_CNT_Stop(CM_TMR4);
+    }
+}
+
+/**
+ * @brief  Change the modulation method.
+ * @param  [in] u32Method               Method, @ref TMR4_MOD_Method
+ * @retval None
+ */
+void TMR4_MOD_SetMethod(uint32_t u32Method)
+{
+    DDL_ASSERT(IS_TMR4_MOD_METHOD(u32Method));
+
+    m_u32Method = u32Method;
+}
+
+/**
+ * @brief  Set the output voltage vector.
+ * @param  [in] i16Alpha                Alpha component in Q15 of Vdc / sqrt(3).
+ * @param  [in] i16Beta                 Beta component in Q15 of Vdc / sqrt(3).
+ * @retval None
+ * @note   Vectors beyond the linear range of the method are clamped per
+ *         phase. Safe to call from any context, also before TMR4_MOD_Start()
+ *         to set the first carrier period.
+ */
+void TMR4_MOD_SetAlphaBeta(int16_t i16Alpha, int16_t i16Beta)
+{
+    int32_t i32U;
+    int32_t i32V;
+    int32_t i32W;
+    int32_t i32Max;
+    int32_t i32Min;
+    int32_t i32Zero = 0;
+    int64_t i64Mag2;
+    int32_t i32BetaPh;
+
+    if (m_u16Peak != 0U)
+    {
+        /* Phase voltages in Q15 of Vdc / 2 */
+        i32U = ((int32_t)i16Alpha * TMR4_MOD_2_DIV_SQRT3_Q14) >> 14;
+        i32V = -(i32U >> 1) + (int32_t)i16Beta;
+        i32W = -(i32U >> 1) - (int32_t)i16Beta;
+
+        if (TMR4_MOD_SVPWM == m_u32Method)
+        {
+            i32Max = (i32U > i32V) ? i32U : i32V;
+            i32Max = (i32Max > i32W) ? i32Max : i32W;
+            i32Min = (i32U < i32V) ? i32U : i32V;
+            i32Min = (i32Min < i32W) ? i32Min : i32W;
+            i32Zero = -((i32Max + i32Min) >> 1);
+        }
+        else if (TMR4_MOD_THIPWM == m_u32Method)
+        {
+            /* -(A / 6) * cos(3 * theta) = -(2 / 3) * U * V * W / A^2 */
+            i32BetaPh = ((int32_t)i16Beta * TMR4_MOD_2_DIV_SQRT3_Q14) >> 14;
+            i64Mag2 = ((int64_t)i32U * i32U) + ((int64_t)i32BetaPh * i32BetaPh);
+            if (i64Mag2 != 0)
+            {
+                i32Zero = -(int32_t)((2LL * (int64_t)i32U * i32V * i32W) / (3LL * i64Mag2));
+            }
+        }
+        else
+        {
+            /* Sinusoidal: no zero sequence */
+        }
+
+        TMR4_MOD_Write(TMR4_MOD_DutyToCompare((int32_t)(TMR4_MOD_DUTY_FULL / 2U) + ((i32U + i32Zero) >> 1)),
+                       TMR4_MOD_DutyToCompare((int32_t)(TMR4_MOD_DUTY_FULL / 2U) + ((i32V + i32Zero) >> 1)),
+                       TMR4_MOD_DutyToCompare((int32_t)(TMR4_MOD_DUTY_FULL / 2U) + ((i32W + i32Zero) >> 1)));
+    }
+}
+
+/**
+ * @brief  Set the high side duty of the three phases.
+ * @param  [in] u16DutyU                Phase U duty, 0 ~ TMR4_MOD_DUTY_FULL
+ * @param  [in] u16DutyV                Phase V duty, 0 ~ TMR4_MOD_DUTY_FULL
+ * @param  [in] u16DutyW                Phase W duty, 0 ~ TMR4_MOD_DUTY_FULL
+ * @retval None
+ * @note   Safe to call from any context, also before TMR4_MOD_Start()
+ *         to set the first carrier period.
+ */
+void TMR4_MOD_SetDuty(uint16_t u16DutyU, uint16_t u16DutyV, uint16_t u16DutyW)
+{
+    if (m_u16Peak != 0U)
+    {
+        TMR4_MOD_Write(TMR4_MOD_DutyToCompare((int32_t)u16DutyU),
+                       TMR4_MOD_DutyToCompare((int32_t)u16DutyV),
+                       TMR4_MOD_DutyToCompare((int32_t)u16DutyW));
+    }
+}
+
+/**
+ * @brief  Get the counter peak value, the duty resolution.
+ * @param  None
+ * @retval Peak count, 0 if not initialized.
+ */
+uint16_t TMR4_MOD_GetPeakValue(void)
+{
+    return m_u16Peak;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TMR4_MOD_Local_Functions TMR4_MOD Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Convert a duty to a compare value.
+ * @param  [in] i32Duty                 Duty, 0 ~ TMR4_MOD_DUTY_FULL, clamped.
+ * @retval Compare value, 1 ~ peak - 1 so that each half period has both edges.
+ */
+static uint16_t TMR4_MOD_DutyToCompare(int32_t i32Duty)
+{
+    uint32_t u32Cmp;
+
+    if (i32Duty < 0)
+    {
+        i32Duty = 0;
+    }
+    else if (i32Duty > (int32_t)TMR4_MOD_DUTY_FULL)
+    {
+        i32Duty = (int32_t)TMR4_MOD_DUTY_FULL;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    u32Cmp = (uint32_t)m_u16Peak - (((uint32_t)i32Duty * m_u16Peak) >> 15U);
+    if (u32Cmp < 1UL)
+    {
+        u32Cmp = 1UL;
+    }
+    else if (u32Cmp > ((uint32_t)m_u16Peak - 1UL))
+    {
+        u32Cmp = (uint32_t)m_u16Peak - 1UL;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    return (uint16_t)u32Cmp;
+}
+
+/**
+ * @brief  Write the three compare buffers between two buffer transfers.
+ * @param  [in] u16CmpU                 Phase U compare value.
+ * @param  [in] u16CmpV                 Phase V compare value.
+ * @param  [in] u16CmpW                 Phase W compare value.
+ * @retval None
+ * @note   With the counter stopped the buffers are written at once.
+ */
+static void TMR4_MOD_Write(uint16_t u16CmpU, uint16_t u16CmpV, uint16_t u16CmpW)
+{
+    uint32_t u32Primask;
+    uint32_t u32Cnt;
+    uint32_t u32Wait;
+    uint32_t u32Poll = m_u32GuardPollMax;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    /* Wait out the guard band around a transfer, at most twice its width.
+       A stopped counter makes no transfer, nothing to wait for. */
+    if (0U == READ_REG16_BIT(CM_TMR4->CCSR, TMR4_CCSR_STOP))
+    {
+        do
+        {
+            u32Cnt = READ_REG16(CM_TMR4->CNTR);
+            u32Wait = 0UL;
+            if ((m_u16UpdateCond != TMR4_OCO_BUF_COND_OVF) && (u32Cnt < m_u16Guard))
+            {
+                u32Wait = 1UL;
+            }
+            if ((m_u16UpdateCond != TMR4_OCO_BUF_COND_UDF) && ((u32Cnt + m_u16Guard) > m_u16Peak))
+            {
+                u32Wait = 1UL;
+            }
+            u32Poll--;
+        } while ((u32Wait != 0UL) && (u32Poll != 0UL));
+    }
+
+    WRITE_REG16(CM_TMR4->OCCRUL, u16CmpU);
+    WRITE_REG16(CM_TMR4->OCCRVL, u16CmpV);
+    WRITE_REG16(CM_TMR4->OCCRWL, u16CmpW);
+
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMR4_MOD_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
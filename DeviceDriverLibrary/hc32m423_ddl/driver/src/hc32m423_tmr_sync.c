@@ -0,0 +1,553 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmr_sync.c
+ * @brief This file provides firmware functions for a synchronized group of
+ *        TMRA and TMRB units with phase offsets.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_tmr_sync.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_tmra.h"
+#include "hc32m423_tmrb.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_TMR_SYNC TMR_SYNC
+ * @brief Synchronized Timer Group Driver Library
+ * @details A group of TMRA units, optionally with TMRB, is started and
+ *          stopped by one event: the AOS software trigger is selected as
+ *          the hardware start or stop event of every unit of the group and
+ *          fired once, so all counters change state on the same count
+ *          clock edge. Before the start each stopped counter is loaded with
+ *          its phase, the position it would have reached au16Phase/65536 of
+ *          a period after a unit of phase 0, taking the count direction
+ *          into account in triangle mode. TMR_SYNC_Realign() stops the group
+ *          on one event, restores the phase offsets relative to the
+ *          reference unit and restarts it, so drifts from software writes
+ *          are removed while the reference keeps its timing.
+ *          The units are configured (count mode, clock, period, PWM) with
+ *          the TMRA/TMRB drivers before TMR_SYNC_Init() and keep their
+ *          alignment when they share the count clock and the period. The
+ *          trigger source of the TMRA count events and of TMRB is borrowed
+ *          during a start or stop and restored afterwards. The AOS function
+ *          clock must be enabled. Use the hold stop polarity for PWM
+ *          outputs that must not change during TMR_SYNC_Realign().
+ * @{
+ */
+
+#if (DDL_TMR_SYNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR_SYNC_Local_Macros TMR_SYNC Local Macros
+ * @{
+ */
+#define TMR_SYNC_TMRA_NUM               (4UL)
+
+#define TMR_SYNC_COND_START             (0UL)
+#define TMR_SYNC_COND_STOP              (1UL)
+
+/* Loops waiting for the trigger to reach the reference unit */
+#define TMR_SYNC_TIMEOUT                (100UL)
+
+/**
+ * @defgroup TMR_SYNC_Check_Parameters_Validity TMR_SYNC Check Parameters Validity
+ * @{
+ */
+#define IS_TMR_SYNC_UNIT(x)                                                    \
+(   ((x) != 0UL)                                &&                             \
+    (((x) | TMR_SYNC_UNIT_ALL) == TMR_SYNC_UNIT_ALL))
+
+#define IS_TMR_SYNC_UNIT_IDX(x)         ((x) < TMR_SYNC_UNIT_NUM)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup TMR_SYNC_Local_Functions
+ * @{
+ */
+static uint32_t TMR_SYNC_GetLen(uint32_t u32Idx);
+static uint32_t TMR_SYNC_GetPos(uint32_t u32Idx);
+static void TMR_SYNC_SetPos(uint32_t u32Idx, uint32_t u32Pos);
+static uint32_t TMR_SYNC_IsRunning(uint32_t u32Idx);
+static void TMR_SYNC_Trigger(uint32_t u32Cond);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR_SYNC_Local_Variables TMR_SYNC Local Variables
+ * @{
+ */
+static CM_TMRA_TypeDef *const m_apstcTmra[TMR_SYNC_TMRA_NUM] =
+{
+    CM_TMRA_1, CM_TMRA_2, CM_TMRA_3, CM_TMRA_4
+};
+
+static uint32_t m_u32Unit = 0UL;
+static uint32_t m_u32RefIdx = 0UL;
+static uint16_t m_au16Phase[TMR_SYNC_UNIT_NUM];
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR_SYNC_Global_Functions TMR_SYNC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_tmr_sync_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_tmr_sync_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t TMR_SYNC_StructInit(stc_tmr_sync_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t i;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u32Unit = TMR_SYNC_UNIT_TMRA_1 | TMR_SYNC_UNIT_TMRA_2;
+        for (i = 0UL; i < TMR_SYNC_UNIT_NUM; i++)
+        {
+            pstcInit->au16Phase[i] = 0U;
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the timer group.
+ * @param  [in] pstcInit                Pointer to a stc_tmr_sync_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL or no unit
+ * @note   The units are not started, see TMR_SYNC_Start().
+ */
+en_result_t TMR_SYNC_Init(const stc_tmr_sync_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t i;
+
+    if ((pstcInit != NULL) && ((pstcInit->u32Unit & TMR_SYNC_UNIT_ALL) != 0UL))
+    {
+        DDL_ASSERT(IS_TMR_SYNC_UNIT(pstcInit->u32Unit));
+
+        m_u32Unit = pstcInit->u32Unit & TMR_SYNC_UNIT_ALL;
+        m_u32RefIdx = TMR_SYNC_UNIT_NUM;
+        for (i = 0UL; i < TMR_SYNC_UNIT_NUM; i++)
+        {
+            m_au16Phase[i] = pstcInit->au16Phase[i];
+            if (((m_u32Unit & (1UL << i)) != 0UL) && (m_u32RefIdx == TMR_SYNC_UNIT_NUM))
+            {
+                m_u32RefIdx = i;
+            }
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  De-initialize the timer group.
+ * @param  None
+ * @retval None
+ * @note   The units keep running.
+ */
+void TMR_SYNC_DeInit(void)
+{
+    m_u32Unit = 0UL;
+}
+
+/**
+ * @brief  Load the phases and start all units of the group together.
+ * @param  None
+ * @retval None
+ */
+void TMR_SYNC_Start(void)
+{
+    uint32_t i;
+
+    if (m_u32Unit != 0UL)
+    {
+        TMR_SYNC_Trigger(TMR_SYNC_COND_STOP);
+        for (i = 0UL; i < TMR_SYNC_UNIT_NUM; i++)
+        {
+            if ((m_u32Unit & (1UL << i)) != 0UL)
+            {
+                TMR_SYNC_SetPos(i, TMR_SYNC_GetPhaseCount(i));
+            }
+        }
+        TMR_SYNC_Trigger(TMR_SYNC_COND_START);
+    }
+}
+
+/**
+ * @brief  Stop all units of the group together.
+ * @param  None
+ * @retval None
+ */
+void TMR_SYNC_Stop(void)
+{
+    if (m_u32Unit != 0UL)
+    {
+        TMR_SYNC_Trigger(TMR_SYNC_COND_STOP);
+    }
+}
+
+/**
+ * @brief  Restore the phase offsets relative to the reference unit.
+ * @param  None
+ * @retval None
+ * @note   The group is stopped for the few microseconds of the update, with
+ *         interrupts masked. Phases changed by TMR_SYNC_SetPhase() are
+ *         applied here.
+ */
+void TMR_SYNC_Realign(void)
+{
+    uint32_t u32Primask;
+    uint32_t u32Len;
+    uint32_t u32Time;
+    uint32_t i;
+
+    if (m_u32Unit != 0UL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        TMR_SYNC_Trigger(TMR_SYNC_COND_STOP);
+
+        /* Time of the group in counts of the reference, a unit at phase 0 is there */
+        u32Len = TMR_SYNC_GetLen(m_u32RefIdx);
+        u32Time = (TMR_SYNC_GetPos(m_u32RefIdx) + u32Len - TMR_SYNC_GetPhaseCount(m_u32RefIdx)) % u32Len;
+        for (i = 0UL; i < TMR_SYNC_UNIT_NUM; i++)
+        {
+            if ((m_u32Unit & (1UL << i)) != 0UL)
+            {
+                u32Len = TMR_SYNC_GetLen(i);
+                TMR_SYNC_SetPos(i, (u32Time + TMR_SYNC_GetPhaseCount(i)) % u32Len);
+            }
+        }
+
+        TMR_SYNC_Trigger(TMR_SYNC_COND_START);
+        __set_PRIMASK(u32Primask);
+    }
+}
+
+/**
+ * @brief  Set the phase of a unit, applied by TMR_SYNC_Start() or TMR_SYNC_Realign().
+ * @param  [in] u32UnitIdx              Unit, TMR_SYNC_UNIT_IDX_xxx.
+ * @param  [in] u16Phase                Phase in 1/65536 of the period.
+ * @retval None
+ */
+void TMR_SYNC_SetPhase(uint32_t u32UnitIdx, uint16_t u16Phase)
+{
+    DDL_ASSERT(IS_TMR_SYNC_UNIT_IDX(u32UnitIdx));
+
+    m_au16Phase[u32UnitIdx] = u16Phase;
+}
+
+/**
+ * @brief  Get the phase of a unit in counts.
+ * @param  [in] u32UnitIdx              Unit, TMR_SYNC_UNIT_IDX_xxx.
+ * @retval Counts from the position of phase 0, with the current period.
+ */
+uint16_t TMR_SYNC_GetPhaseCount(uint32_t u32UnitIdx)
+{
+    DDL_ASSERT(IS_TMR_SYNC_UNIT_IDX(u32UnitIdx));
+
+    return (uint16_t)((TMR_SYNC_GetLen(u32UnitIdx) * m_au16Phase[u32UnitIdx]) >> 16U);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TMR_SYNC_Local_Functions TMR_SYNC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the length of one period of a unit.
+ * @param  [in] u32Idx                  Unit index.
+ * @retval Counts: period value + 1 in sawtooth mode, 2 x period value in triangle mode.
+ */
+static uint32_t TMR_SYNC_GetLen(uint32_t u32Idx)
+{
+    uint32_t u32Per;
+    uint32_t u32Len;
+
+    if (u32Idx == TMR_SYNC_UNIT_IDX_TMRB)
+    {
+        u32Per = TMRB_GetPeriodValue(CM_TMRB);
+        u32Len = (READ_REG16_BIT(CM_TMRB->BCSTR, TMRB_BCSTR_MODE) != 0U) ? (u32Per * 2UL) : (u32Per + 1UL);
+    }
+    else
+    {
+        u32Per = TMRA_GetPeriodValue(m_apstcTmra[u32Idx]);
+        u32Len = (READ_REG16_BIT(m_apstcTmra[u32Idx]->BCSTR, TMRA_BCSTR_MODE) != 0U) ?
+                 (u32Per * 2UL) : (u32Per + 1UL);
+    }
+
+    return (u32Len != 0UL) ? u32Len : 1UL;
+}
+
+/**
+ * @brief  Get the position of a unit in its period.
+ * @param  [in] u32Idx                  Unit index.
+ * @retval Counts since the start of the period: the counter value counting up,
+ *         the distance from the top counting down.
+ */
+static uint32_t TMR_SYNC_GetPos(uint32_t u32Idx)
+{
+    uint32_t u32Per;
+    uint32_t u32Cnt;
+    uint32_t u32Up;
+    uint32_t u32Tri;
+    uint32_t u32Pos;
+
+    if (u32Idx == TMR_SYNC_UNIT_IDX_TMRB)
+    {
+        u32Per = TMRB_GetPeriodValue(CM_TMRB);
+        u32Cnt = TMRB_GetCountValue(CM_TMRB);
+        u32Up = (TMRB_GetCountDir(CM_TMRB) == TMRB_DIR_UP) ? 1UL : 0UL;
+        u32Tri = (READ_REG16_BIT(CM_TMRB->BCSTR, TMRB_BCSTR_MODE) != 0U) ? 1UL : 0UL;
+    }
+    else
+    {
+        u32Per = TMRA_GetPeriodValue(m_apstcTmra[u32Idx]);
+        u32Cnt = TMRA_GetCountValue(m_apstcTmra[u32Idx]);
+        u32Up = (TMRA_GetCountDir(m_apstcTmra[u32Idx]) == TMRA_DIR_UP) ? 1UL : 0UL;
+        u32Tri = (READ_REG16_BIT(m_apstcTmra[u32Idx]->BCSTR, TMRA_BCSTR_MODE) != 0U) ? 1UL : 0UL;
+    }
+
+    if (u32Up != 0UL)
+    {
+        u32Pos = u32Cnt;
+    }
+    else if (u32Tri != 0UL)
+    {
+        u32Pos = (u32Per * 2UL) - u32Cnt;
+    }
+    else
+    {
+        u32Pos = u32Per - u32Cnt;
+    }
+
+    return u32Pos % TMR_SYNC_GetLen(u32Idx);
+}
+
+/**
+ * @brief  Move a stopped unit to a position in its period.
+ * @param  [in] u32Idx                  Unit index.
+ * @param  [in] u32Pos                  Position, below TMR_SYNC_GetLen().
+ * @retval None
+ */
+static void TMR_SYNC_SetPos(uint32_t u32Idx, uint32_t u32Pos)
+{
+    uint32_t u32Per;
+    uint32_t u32Cnt;
+    uint32_t u32Up;
+
+    if (u32Idx == TMR_SYNC_UNIT_IDX_TMRB)
+    {
+        u32Per = TMRB_GetPeriodValue(CM_TMRB);
+        if (READ_REG16_BIT(CM_TMRB->BCSTR, TMRB_BCSTR_MODE) != 0U)
+        {
+            u32Up = (u32Pos <= u32Per) ? 1UL : 0UL;
+            u32Cnt = (u32Up != 0UL) ? u32Pos : ((u32Per * 2UL) - u32Pos);
+            TMRB_SetCountDir(CM_TMRB, (u32Up != 0UL) ? TMRB_DIR_UP : TMRB_DIR_DOWN);
+        }
+        else
+        {
+            u32Cnt = (TMRB_GetCountDir(CM_TMRB) == TMRB_DIR_UP) ? u32Pos : (u32Per - u32Pos);
+        }
+        TMRB_SetCountValue(CM_TMRB, (uint16_t)u32Cnt);
+    }
+    else
+    {
+        u32Per = TMRA_GetPeriodValue(m_apstcTmra[u32Idx]);
+        if (READ_REG16_BIT(m_apstcTmra[u32Idx]->BCSTR, TMRA_BCSTR_MODE) != 0U)
+        {
+            u32Up = (u32Pos <= u32Per) ? 1UL : 0UL;
+            u32Cnt = (u32Up != 0UL) ? u32Pos : ((u32Per * 2UL) - u32Pos);
+            TMRA_SetCountDir(m_apstcTmra[u32Idx], (u32Up != 0UL) ? TMRA_DIR_UP : TMRA_DIR_DOWN);
+        }
+        else
+        {
+            u32Cnt = (TMRA_GetCountDir(m_apstcTmra[u32Idx]) == TMRA_DIR_UP) ? u32Pos : (u32Per - u32Pos);
+        }
+        TMRA_SetCountValue(m_apstcTmra[u32Idx], (uint16_t)u32Cnt);
+    }
+}
+
+/**
+ * @brief  Get the run state of a unit.
+ * @param  [in] u32Idx                  Unit index.
+ * @retval 1 if counting, otherwise 0.
+ */
+static uint32_t TMR_SYNC_IsRunning(uint32_t u32Idx)
+{
+    uint16_t u16Start;
+
+    if (u32Idx == TMR_SYNC_UNIT_IDX_TMRB)
+    {
+        u16Start = READ_REG16_BIT(CM_TMRB->BCSTR, TMRB_BCSTR_START);
+    }
+    else
+    {
+        u16Start = READ_REG16_BIT(m_apstcTmra[u32Idx]->BCSTR, TMRA_BCSTR_START);
+    }
+
+    return (u16Start != 0U) ? 1UL : 0UL;
+}
+
+/**
+ * @brief  Start or stop all units of the group on one AOS software trigger.
+ * @param  [in] u32Cond                 TMR_SYNC_COND_START or TMR_SYNC_COND_STOP.
+ * @retval None
+ */
+static void TMR_SYNC_Trigger(uint32_t u32Cond)
+{
+    uint32_t u32Primask;
+    uint32_t u32TmraSrc;
+    uint32_t u32TmrbSrc;
+    uint32_t u32Timeout = 0UL;
+    uint32_t u32Expect = (u32Cond == TMR_SYNC_COND_START) ? 1UL : 0UL;
+    uint32_t i;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    u32TmraSrc = READ_REG32(CM_AOS->TMRA0_HTSSR);
+    u32TmrbSrc = READ_REG32(CM_AOS->TMRB_HTSSR);
+    TMRA_SetTriggerSrc(TMRA_EVT_USAGE_CNT, EVT_AOS_STRG);
+    TMRB_SetTriggerSrc(EVT_AOS_STRG);
+
+    for (i = 0UL; i < TMR_SYNC_UNIT_NUM; i++)
+    {
+        if ((m_u32Unit & (1UL << i)) != 0UL)
+        {
+            if (i == TMR_SYNC_UNIT_IDX_TMRB)
+            {
+                if (u32Cond == TMR_SYNC_COND_START)
+                {
+                    TMRB_HWStartCondCmd(CM_TMRB, TMRB_START_COND_EVT, Enable);
+                }
+                else
+                {
+                    TMRB_HWStopCondCmd(CM_TMRB, TMRB_STOP_COND_EVT, Enable);
+                }
+            }
+            else
+            {
+                if (u32Cond == TMR_SYNC_COND_START)
+                {
+                    TMRA_HWStartCondCmd(m_apstcTmra[i], TMRA_START_COND_EVT, Enable);
+                }
+                else
+                {
+                    TMRA_HWStopCondCmd(m_apstcTmra[i], TMRA_STOP_COND_EVT, Enable);
+                }
+            }
+        }
+    }
+
+    AOS_SW_Trigger();
+    while ((TMR_SYNC_IsRunning(m_u32RefIdx) != u32Expect) && (u32Timeout < TMR_SYNC_TIMEOUT))
+    {
+        u32Timeout++;
+    }
+
+    for (i = 0UL; i < TMR_SYNC_UNIT_NUM; i++)
+    {
+        if ((m_u32Unit & (1UL << i)) != 0UL)
+        {
+            if (i == TMR_SYNC_UNIT_IDX_TMRB)
+            {
+                TMRB_HWStartCondCmd(CM_TMRB, TMRB_START_COND_EVT, Disable);
+                TMRB_HWStopCondCmd(CM_TMRB, TMRB_STOP_COND_EVT, Disable);
+            }
+            else
+            {
+                TMRA_HWStartCondCmd(m_apstcTmra[i], TMRA_START_COND_EVT, Disable);
+                TMRA_HWStopCondCmd(m_apstcTmra[i], TMRA_STOP_COND_EVT, Disable);
+            }
+        }
+    }
+
+    WRITE_REG32(CM_AOS->TMRA0_HTSSR, u32TmraSrc);
+    WRITE_REG32(CM_AOS->TMRB_HTSSR, u32TmrbSrc);
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMR_SYNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,714 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmra_enc.c
+ * @brief This file provides firmware functions for quadrature encoder
+ *        decoding and M/T speed estimation on TMRA.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_tmra_enc.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_tmra.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_TMRA_ENC TMRA_ENC
+ * @brief TMRA Quadrature Encoder Driver Library
+ * @details The encoder unit counts phases A/B with its hardware count
+ *          conditions, and its overflow/underflow interrupts extend the
+ *          16-bit count to a 64-bit position.
+ *          Speed uses the M/T method: the number of counts between two
+ *          phase A edges divided by the exact time between them. With the
+ *          edge latch, every A edge captures the position on channel 1 of
+ *          the encoder unit, and its capture event captures the time base
+ *          on channel 1 of the time base unit, so the last edge is known to
+ *          one time base count without an interrupt per edge.
+ *          TMRA_ENC_Update(), called periodically, measures over all edges
+ *          since the previous measurement: at high speed many counts per
+ *          period, at low speed one edge interval spanning many periods.
+ *          Between edges the speed is bounded by one edge step over the
+ *          time since the last edge, so it decays to zero at standstill.
+ *          The index pulse on PWM2 captures the position on channel 2.
+ *          The application enables the TMRA and AOS function clocks, sets
+ *          the pin functions, and calls the three handlers from the
+ *          overflow, underflow and compare handlers of the encoder unit.
+ * @{
+ */
+
+#if (DDL_TMRA_ENC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_ENC_Local_Macros TMRA_ENC Local Macros
+ * @{
+ */
+#define TMRA_ENC_US_PER_SEC             (1000000ULL)
+#define TMRA_ENC_CNT_MOD                (65536L)
+/* Distance between the IRQ numbers and the event numbers of two units */
+#define TMRA_ENC_UNIT_STEP              (3UL)
+
+#define TMRA_ENC_X4_UP                                                         \
+(   TMRA_CNT_UP_COND_CLKBL_CLKAR                |                              \
+    TMRA_CNT_UP_COND_CLKAH_CLKBR                |                              \
+    TMRA_CNT_UP_COND_CLKBH_CLKAF                |                              \
+    TMRA_CNT_UP_COND_CLKAL_CLKBF)
+#define TMRA_ENC_X4_DOWN                                                       \
+(   TMRA_CNT_DOWN_COND_CLKBH_CLKAR              |                              \
+    TMRA_CNT_DOWN_COND_CLKAL_CLKBR              |                              \
+    TMRA_CNT_DOWN_COND_CLKBL_CLKAF              |                              \
+    TMRA_CNT_DOWN_COND_CLKAH_CLKBF)
+#define TMRA_ENC_X2_UP                  (TMRA_CNT_UP_COND_CLKBL_CLKAR | TMRA_CNT_UP_COND_CLKBH_CLKAF)
+#define TMRA_ENC_X2_DOWN                (TMRA_CNT_DOWN_COND_CLKBH_CLKAR | TMRA_CNT_DOWN_COND_CLKBL_CLKAF)
+#define TMRA_ENC_X1_UP                  (TMRA_CNT_UP_COND_CLKBL_CLKAR)
+#define TMRA_ENC_X1_DOWN                (TMRA_CNT_DOWN_COND_CLKBH_CLKAR)
+
+/**
+ * @defgroup TMRA_ENC_Check_Parameters_Validity TMRA_ENC Check Parameters Validity
+ * @{
+ */
+#define IS_TMRA_ENC_UNIT(x)                                                    \
+(   ((x) == CM_TMRA_1)                          ||                             \
+    ((x) == CM_TMRA_2)                          ||                             \
+    ((x) == CM_TMRA_3)                          ||                             \
+    ((x) == CM_TMRA_4))
+
+#define IS_TMRA_ENC_RESOLUTION(x)                                              \
+(   ((x) == TMRA_ENC_X1)                        ||                             \
+    ((x) == TMRA_ENC_X2)                        ||                             \
+    ((x) == TMRA_ENC_X4))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup TMRA_ENC_Local_Functions
+ * @{
+ */
+static uint32_t TMRA_ENC_UnitIdx(const CM_TMRA_TypeDef *TMRAx);
+static void TMRA_ENC_Fold(void);
+static int64_t TMRA_ENC_ReadPosition(uint16_t *pu16Cnt);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_ENC_Local_Variables TMRA_ENC Local Variables
+ * @{
+ */
+static CM_TMRA_TypeDef *m_pstcTmraEnc = NULL;
+static CM_TMRA_TypeDef *m_pstcTmraTime = NULL;
+static uint32_t m_u32UnitIdx = 0UL;
+static uint32_t m_u32EdgeLatch = 0UL;
+static uint32_t m_u32Index = 0UL;
+static uint32_t m_u32TimeFreq = 0UL;
+static uint32_t m_u32EdgeStep = 1UL;
+static uint32_t m_u32StandstillTicks = 0UL;
+static func_ptr_tmra_enc_index_t m_pfnIndexCallback = NULL;
+
+/* Wraps of the 16-bit counter, the position above bit 15 */
+static __IO int64_t m_i64Epoch = 0LL;
+static __IO int64_t m_i64Offset = 0LL;
+static __IO int64_t m_i64IndexPos = 0LL;
+static __IO uint32_t m_u32IndexCnt = 0UL;
+
+/* Extended time base and the M/T reference edge, owned by TMRA_ENC_Update() */
+static uint32_t m_u32Now = 0UL;
+static uint16_t m_u16LastTime = 0U;
+static uint32_t m_u32LastUpdate = 0UL;
+static int64_t m_i64LastPos = 0LL;
+static int64_t m_i64RefPos = 0LL;
+static uint32_t m_u32RefTime = 0UL;
+static uint32_t m_u32RefValid = 0UL;
+static float32_t m_f32Velocity = 0.0F;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_ENC_Global_Functions TMRA_ENC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_tmra_enc_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_tmra_enc_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t TMRA_ENC_StructInit(stc_tmra_enc_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->pstcTmraEnc = CM_TMRA_3;
+        pstcInit->pstcTmraTime = CM_TMRA_4;
+        pstcInit->u16TimeClockDiv = TMRA_CLK_DIV64;
+        pstcInit->u32Resolution = TMRA_ENC_X4;
+        pstcInit->enEdgeLatch = Enable;
+        pstcInit->u16FilterClockDiv = TMRA_FILTER_CLK_DIV4;
+        pstcInit->enIndex = Disable;
+        pstcInit->u32StandstillUs = 100000UL;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI03;
+        pstcInit->pfnIndexCallback = NULL;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize and start the encoder unit and the time base unit.
+ * @param  [in] pstcInit                Pointer to a stc_tmra_enc_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       Invalid configuration, or the index
+ *                                      is requested on a unit without channel 2
+ * @note   The edge latch uses the TMRA capture event source, which is shared
+ *         by all TMRA units.
+ */
+en_result_t TMRA_ENC_Init(const stc_tmra_enc_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_clock_freq_t stcClkFreq;
+    stc_tmra_init_t stcTmraInit;
+    uint16_t u16Up;
+    uint16_t u16Down;
+    uint32_t u32Pin;
+    IRQn_Type enIRQn;
+    uint64_t u64Ticks;
+
+    if ((pstcInit != NULL) && (pstcInit->pstcTmraEnc != NULL) &&
+        (pstcInit->pstcTmraTime != NULL) && (pstcInit->pstcTmraEnc != pstcInit->pstcTmraTime) &&
+        ((pstcInit->enIndex == Disable) ||
+         (pstcInit->pstcTmraEnc == CM_TMRA_3) || (pstcInit->pstcTmraEnc == CM_TMRA_4)))
+    {
+        DDL_ASSERT(IS_TMRA_ENC_UNIT(pstcInit->pstcTmraEnc));
+        DDL_ASSERT(IS_TMRA_ENC_UNIT(pstcInit->pstcTmraTime));
+        DDL_ASSERT(IS_TMRA_ENC_RESOLUTION(pstcInit->u32Resolution));
+        DDL_ASSERT(IS_FUNCTIONAL_STATE(pstcInit->enEdgeLatch));
+        DDL_ASSERT(IS_FUNCTIONAL_STATE(pstcInit->enIndex));
+
+        TMRA_ENC_DeInit();
+        m_pstcTmraEnc = pstcInit->pstcTmraEnc;
+        m_pstcTmraTime = pstcInit->pstcTmraTime;
+        m_u32UnitIdx = TMRA_ENC_UnitIdx(m_pstcTmraEnc);
+        m_u32EdgeLatch = (pstcInit->enEdgeLatch == Enable) ? 1UL : 0UL;
+        m_u32Index = (pstcInit->enIndex == Enable) ? 1UL : 0UL;
+        m_pfnIndexCallback = pstcInit->pfnIndexCallback;
+
+        (void)CLK_GetClockFreq(&stcClkFreq);
+        m_u32TimeFreq = stcClkFreq.u32Pclk1Freq >> ((uint32_t)pstcInit->u16TimeClockDiv >> TMRA_BCSTR_CKDIV_POS);
+        u64Ticks = ((uint64_t)pstcInit->u32StandstillUs * m_u32TimeFreq) / TMRA_ENC_US_PER_SEC;
+        m_u32StandstillTicks = (u64Ticks > 0x7FFFFFFFULL) ? 0x7FFFFFFFUL : (uint32_t)u64Ticks;
+
+        if (pstcInit->u32Resolution == TMRA_ENC_X4)
+        {
+            u16Up = TMRA_ENC_X4_UP;
+            u16Down = TMRA_ENC_X4_DOWN;
+            m_u32EdgeStep = 2UL;
+        }
+        else if (pstcInit->u32Resolution == TMRA_ENC_X2)
+        {
+            u16Up = TMRA_ENC_X2_UP;
+            u16Down = TMRA_ENC_X2_DOWN;
+            m_u32EdgeStep = 1UL;
+        }
+        else
+        {
+            u16Up = TMRA_ENC_X1_UP;
+            u16Down = TMRA_ENC_X1_DOWN;
+            m_u32EdgeStep = 1UL;
+        }
+
+        (void)TMRA_StructInit(&stcTmraInit);
+        stcTmraInit.u16CountMode   = TMRA_MD_SAWTOOTH;
+        stcTmraInit.u16CountDir    = TMRA_DIR_UP;
+        stcTmraInit.u16PeriodValue = 0xFFFFU;
+        (void)TMRA_Init(m_pstcTmraEnc, &stcTmraInit);
+        stcTmraInit.u16ClockDiv    = pstcInit->u16TimeClockDiv;
+        (void)TMRA_Init(m_pstcTmraTime, &stcTmraInit);
+
+        TMRA_HWCountUpCondCmd(m_pstcTmraEnc, u16Up, Enable);
+        TMRA_HWCountDownCondCmd(m_pstcTmraEnc, u16Down, Enable);
+
+        u32Pin = TMRA_PIN_CLKA | TMRA_PIN_CLKB;
+        if (m_u32EdgeLatch != 0UL)
+        {
+            u32Pin |= TMRA_PIN_PWM1;
+            TMRA_SetFunc(m_pstcTmraEnc, TMRA_CH1, TMRA_FUNC_CAPT);
+            TMRA_HWCaptureCondCmd(m_pstcTmraEnc, TMRA_CH1,
+                                  (pstcInit->u32Resolution == TMRA_ENC_X1) ?
+                                  TMRA_CAPT_COND_PWMR : (TMRA_CAPT_COND_PWMR | TMRA_CAPT_COND_PWMF),
+                                  Enable);
+            TMRA_EventCmd(m_pstcTmraEnc, TMRA_CH1, Enable);
+            TMRA_SetTriggerSrc(TMRA_EVT_USAGE_CAPT,
+                               (en_event_src_t)((uint32_t)EVT_TMRA_1_CMP + (m_u32UnitIdx * TMRA_ENC_UNIT_STEP)));
+            TMRA_SetFunc(m_pstcTmraTime, TMRA_CH1, TMRA_FUNC_CAPT);
+            TMRA_HWCaptureCondCmd(m_pstcTmraTime, TMRA_CH1, TMRA_CAPT_COND_EVT, Enable);
+        }
+        if (m_u32Index != 0UL)
+        {
+            u32Pin |= TMRA_PIN_PWM2;
+            TMRA_SetFunc(m_pstcTmraEnc, TMRA_CH2, TMRA_FUNC_CAPT);
+            TMRA_HWCaptureCondCmd(m_pstcTmraEnc, TMRA_CH2, TMRA_CAPT_COND_PWMR, Enable);
+        }
+        TMRA_SetFilterClockDiv(m_pstcTmraEnc, u32Pin, pstcInit->u16FilterClockDiv);
+        TMRA_FilterCmd(m_pstcTmraEnc, u32Pin, Enable);
+
+        m_i64Epoch = 0LL;
+        m_i64Offset = 0LL;
+        m_i64IndexPos = 0LL;
+        m_u32IndexCnt = 0UL;
+        m_u32Now = 0UL;
+        m_u16LastTime = 0U;
+        m_u32LastUpdate = 0UL;
+        m_i64LastPos = 0LL;
+        m_u32RefValid = 0UL;
+        m_f32Velocity = 0.0F;
+        TMRA_ClearStatus(m_pstcTmraEnc, TMRA_FLAG_ALL);
+
+        enIRQn = (IRQn_Type)((uint32_t)TMRA_1_OVF_IRQn + (m_u32UnitIdx * TMRA_ENC_UNIT_STEP));
+        TMRA_IntCmd(m_pstcTmraEnc, (TMRA_INT_OVF | TMRA_INT_UDF), Enable);
+        NVIC_ClearPendingIRQ(enIRQn);
+        NVIC_SetPriority(enIRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(enIRQn);
+        enIRQn = (IRQn_Type)((uint32_t)TMRA_1_UDF_IRQn + (m_u32UnitIdx * TMRA_ENC_UNIT_STEP));
+        NVIC_ClearPendingIRQ(enIRQn);
+        NVIC_SetPriority(enIRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(enIRQn);
+        if (m_u32Index != 0UL)
+        {
+            enIRQn = (IRQn_Type)((uint32_t)TMRA_1_CMP_IRQn + (m_u32UnitIdx * TMRA_ENC_UNIT_STEP));
+            TMRA_IntCmd(m_pstcTmraEnc, TMRA_INT_CMP2, Enable);
+            NVIC_ClearPendingIRQ(enIRQn);
+            NVIC_SetPriority(enIRQn, pstcInit->u32IrqPriority);
+            NVIC_EnableIRQ(enIRQn);
+        }
+
+        TMRA_Start(m_pstcTmraTime);
+        TMRA_Start(m_pstcTmraEnc);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop and de-initialize both units.
+ * @param  None
+ * @retval None
+ */
+void TMRA_ENC_DeInit(void)
+{
+    if (m_pstcTmraEnc != NULL)
+    {
+        NVIC_DisableIRQ((IRQn_Type)((uint32_t)TMRA_1_OVF_IRQn + (m_u32UnitIdx * TMRA_ENC_UNIT_STEP)));
+        NVIC_DisableIRQ((IRQn_Type)((uint32_t)TMRA_1_UDF_IRQn + (m_u32UnitIdx * TMRA_ENC_UNIT_STEP)));
+        if (m_u32Index != 0UL)
+        {
+            NVIC_DisableIRQ((IRQn_Type)((uint32_t)TMRA_1_CMP_IRQn + (m_u32UnitIdx * TMRA_ENC_UNIT_STEP)));
+        }
+        TMRA_DeInit(m_pstcTmraEnc);
+        TMRA_DeInit(m_pstcTmraTime);
+        m_pfnIndexCallback = NULL;
+        m_pstcTmraEnc = NULL;
+        m_pstcTmraTime = NULL;
+    }
+}
+
+/**
+ * @brief  Get the position.
+ * @param  None
+ * @retval Position in counts, 0 if not initialized.
+ */
+int64_t TMRA_ENC_GetPosition(void)
+{
+    uint16_t u16Cnt;
+    int64_t i64Ret = 0LL;
+
+    if (m_pstcTmraEnc != NULL)
+    {
+        i64Ret = TMRA_ENC_ReadPosition(&u16Cnt);
+    }
+
+    return i64Ret;
+}
+
+/**
+ * @brief  Set the position, e.g. to zero on the index pulse.
+ * @param  [in] i64Position             New position in counts.
+ * @retval None
+ * @note   The counter keeps counting; an offset is applied instead. Call from
+ *         the same context as TMRA_ENC_Update().
+ */
+void TMRA_ENC_SetPosition(int64_t i64Position)
+{
+    uint32_t u32Primask;
+    uint16_t u16Cnt;
+    int64_t i64Delta;
+
+    if (m_pstcTmraEnc != NULL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        i64Delta = i64Position - TMRA_ENC_ReadPosition(&u16Cnt);
+        m_i64Offset += i64Delta;
+        m_i64IndexPos += i64Delta;
+        m_i64LastPos += i64Delta;
+        m_i64RefPos += i64Delta;
+        __set_PRIMASK(u32Primask);
+    }
+}
+
+/**
+ * @brief  Measure the speed and get the encoder state.
+ * @param  [out] pstcState              Pointer to a stc_tmra_enc_state_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcState == NULL or not initialized
+ * @note   Call periodically, at least once per 65536 time base counts, e.g.
+ *         from the control loop. The acceleration is the change of the speed
+ *         over the time since the previous call.
+ */
+en_result_t TMRA_ENC_Update(stc_tmra_enc_state_t *pstcState)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Primask;
+    uint32_t u32Edge = 0UL;
+    uint16_t u16Cnt;
+    uint16_t u16Time;
+    uint16_t u16EdgeCnt = 0U;
+    uint16_t u16EdgeTime = 0U;
+    int64_t i64Pos;
+    int64_t i64EdgePos;
+    uint32_t u32EdgeTime;
+    uint32_t u32Dt;
+    float32_t f32Prev;
+    float32_t f32Bound;
+
+    if ((pstcState != NULL) && (m_pstcTmraEnc != NULL))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        do
+        {
+            if (Set == TMRA_GetStatus(m_pstcTmraEnc, TMRA_FLAG_CMP1))
+            {
+                TMRA_ClearStatus(m_pstcTmraEnc, TMRA_FLAG_CMP1);
+                u16EdgeCnt = TMRA_GetCompareValue(m_pstcTmraEnc, TMRA_CH1);
+                u16EdgeTime = TMRA_GetCompareValue(m_pstcTmraTime, TMRA_CH1);
+                u32Edge = 1UL;
+            }
+            /* Read the time and position after the latch, so that they are not older */
+            u16Time = TMRA_GetCountValue(m_pstcTmraTime);
+            i64Pos = TMRA_ENC_ReadPosition(&u16Cnt);
+        } while ((m_u32EdgeLatch != 0UL) && (Set == TMRA_GetStatus(m_pstcTmraEnc, TMRA_FLAG_CMP1)));
+        __set_PRIMASK(u32Primask);
+
+        m_u32Now += (uint16_t)(u16Time - m_u16LastTime);
+        m_u16LastTime = u16Time;
+
+        if (m_u32EdgeLatch != 0UL)
+        {
+            i64EdgePos = i64Pos + (int16_t)(uint16_t)(u16EdgeCnt - u16Cnt);
+            u32EdgeTime = m_u32Now - (uint16_t)(u16Time - u16EdgeTime);
+        }
+        else
+        {
+            u32Edge = (i64Pos != m_i64LastPos) ? 1UL : 0UL;
+            i64EdgePos = i64Pos;
+            u32EdgeTime = m_u32Now;
+        }
+        m_i64LastPos = i64Pos;
+
+        f32Prev = m_f32Velocity;
+        if (u32Edge != 0UL)
+        {
+            u32Dt = u32EdgeTime - m_u32RefTime;
+            if ((m_u32RefValid == 0UL) || (u32Dt > m_u32StandstillTicks))
+            {
+                /* First edge after standstill: it only starts the interval */
+                m_f32Velocity = 0.0F;
+            }
+            else if (u32Dt != 0UL)
+            {
+                m_f32Velocity = ((float32_t)(i64EdgePos - m_i64RefPos) * (float32_t)m_u32TimeFreq) / (float32_t)u32Dt;
+            }
+            else
+            {
+                /* Same edge */
+            }
+            m_i64RefPos = i64EdgePos;
+            m_u32RefTime = u32EdgeTime;
+            m_u32RefValid = 1UL;
+        }
+        else if (m_u32RefValid != 0UL)
+        {
+            u32Dt = m_u32Now - m_u32RefTime;
+            if (u32Dt > m_u32StandstillTicks)
+            {
+                m_f32Velocity = 0.0F;
+                m_u32RefValid = 0UL;
+            }
+            else if (u32Dt != 0UL)
+            {
+                /* The next edge is one step away and has not come yet */
+                f32Bound = ((float32_t)m_u32EdgeStep * (float32_t)m_u32TimeFreq) / (float32_t)u32Dt;
+                if (m_f32Velocity > f32Bound)
+                {
+                    m_f32Velocity = f32Bound;
+                }
+                else if (m_f32Velocity < -f32Bound)
+                {
+                    m_f32Velocity = -f32Bound;
+                }
+                else
+                {
+                    /* Within the bound */
+                }
+            }
+            else
+            {
+                /* No time elapsed */
+            }
+        }
+        else
+        {
+            /* Standstill */
+        }
+
+        u32Dt = m_u32Now - m_u32LastUpdate;
+        m_u32LastUpdate = m_u32Now;
+        pstcState->f32Accel = 0.0F;
+        if (u32Dt != 0UL)
+        {
+            pstcState->f32Accel = ((m_f32Velocity - f32Prev) * (float32_t)m_u32TimeFreq) / (float32_t)u32Dt;
+        }
+        pstcState->i64Position = i64Pos;
+        pstcState->f32Velocity = m_f32Velocity;
+
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        pstcState->i64IndexPosition = m_i64IndexPos;
+        pstcState->u32IndexCnt = m_u32IndexCnt;
+        __set_PRIMASK(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Overflow interrupt handler of the encoder unit.
+ * @param  None
+ * @retval None
+ */
+void TMRA_ENC_Ovf_IrqHandler(void)
+{
+    uint32_t u32Primask;
+
+    if (m_pstcTmraEnc != NULL)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        TMRA_ENC_Fold();
+        __set_PRIMASK(u32Primask);
+    }
+}
+
+/**
+ * @brief  Underflow interrupt handler of the encoder unit.
+ * @param  None
+ * @retval None
+ */
+void TMRA_ENC_Udf_IrqHandler(void)
+{
+    TMRA_ENC_Ovf_IrqHandler();
+}
+
+/**
+ * @brief  Compare interrupt handler of the encoder unit, the index pulse.
+ * @param  None
+ * @retval None
+ */
+void TMRA_ENC_Cmp_IrqHandler(void)
+{
+    uint32_t u32Primask;
+    uint16_t u16Cnt;
+    uint16_t u16Capt;
+    int64_t i64Pos;
+    uint32_t u32IndexCnt;
+
+    if ((m_pstcTmraEnc != NULL) && (m_u32Index != 0UL) &&
+        (Set == TMRA_GetStatus(m_pstcTmraEnc, TMRA_FLAG_CMP2)))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        TMRA_ClearStatus(m_pstcTmraEnc, TMRA_FLAG_CMP2);
+        u16Capt = TMRA_GetCompareValue(m_pstcTmraEnc, TMRA_CH2);
+        i64Pos = TMRA_ENC_ReadPosition(&u16Cnt);
+        i64Pos += (int16_t)(uint16_t)(u16Capt - u16Cnt);
+        m_i64IndexPos = i64Pos;
+        m_u32IndexCnt++;
+        u32IndexCnt = m_u32IndexCnt;
+        __set_PRIMASK(u32Primask);
+
+        if (m_pfnIndexCallback != NULL)
+        {
+            m_pfnIndexCallback(i64Pos, u32IndexCnt);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TMRA_ENC_Local_Functions TMRA_ENC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the index of a TMRA unit.
+ * @param  [in] TMRAx                   CM_TMRA_1 ~ CM_TMRA_4
+ * @retval 0 ~ 3
+ */
+static uint32_t TMRA_ENC_UnitIdx(const CM_TMRA_TypeDef *TMRAx)
+{
+    uint32_t u32Idx = 0UL;
+
+    if (TMRAx == CM_TMRA_2)
+    {
+        u32Idx = 1UL;
+    }
+    else if (TMRAx == CM_TMRA_3)
+    {
+        u32Idx = 2UL;
+    }
+    else if (TMRAx == CM_TMRA_4)
+    {
+        u32Idx = 3UL;
+    }
+    else
+    {
+        /* CM_TMRA_1 */
+    }
+
+    return u32Idx;
+}
+
+/**
+ * @brief  Move pending overflows and underflows into the epoch.
+ * @param  None
+ * @retval None
+ * @note   Call with interrupts disabled. Only the net count matters, so the
+ *         order of a pending overflow and underflow does not.
+ */
+static void TMRA_ENC_Fold(void)
+{
+    if (Set == TMRA_GetStatus(m_pstcTmraEnc, TMRA_FLAG_OVF))
+    {
+        TMRA_ClearStatus(m_pstcTmraEnc, TMRA_FLAG_OVF);
+        m_i64Epoch++;
+    }
+    if (Set == TMRA_GetStatus(m_pstcTmraEnc, TMRA_FLAG_UDF))
+    {
+        TMRA_ClearStatus(m_pstcTmraEnc, TMRA_FLAG_UDF);
+        m_i64Epoch--;
+    }
+}
+
+/**
+ * @brief  Read the extended position.
+ * @param  [out] pu16Cnt                The counter value the position was built from.
+ * @retval Position in counts.
+ */
+static int64_t TMRA_ENC_ReadPosition(uint16_t *pu16Cnt)
+{
+    uint32_t u32Primask;
+    uint16_t u16Cnt;
+    int64_t i64Ret;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    do
+    {
+        TMRA_ENC_Fold();
+        u16Cnt = TMRA_GetCountValue(m_pstcTmraEnc);
+        /* Wrapped after the fold: fold again and read again */
+    } while ((Set == TMRA_GetStatus(m_pstcTmraEnc, TMRA_FLAG_OVF)) ||
+             (Set == TMRA_GetStatus(m_pstcTmraEnc, TMRA_FLAG_UDF)));
+    i64Ret = (m_i64Epoch * TMRA_ENC_CNT_MOD) + (int64_t)u16Cnt + m_i64Offset;
+    __set_PRIMASK(u32Primask);
+
+    *pu16Cnt = u16Cnt;
+
+    return i64Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMRA_ENC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
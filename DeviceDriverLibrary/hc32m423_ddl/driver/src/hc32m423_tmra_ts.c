@@ -0,0 +1,373 @@
+/**
+ *******************************************************************************
+ * @file  hc32m423_tmra_ts.c
+ * @brief This file provides firmware functions for a 64-bit monotonic
+ *        timestamp on a cascaded TMRA unit pair.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32m423_tmra_ts.h"
+#include "hc32m423_clk.h"
+#include "hc32m423_tmra.h"
+#include "hc32m423_interrupts.h"
+#include "hc32m423_utility.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup DDL_TMRA_TS TMRA_TS
+ * @brief 64-bit Timestamp Driver Library
+ * @details A symmetric TMRA unit pair forms a 32-bit counter: the low unit
+ *          counts PCLK1 / div and the high unit counts the overflows of the
+ *          low unit. The overflows of the high unit are counted in software,
+ *          giving 64 bits that do not wrap in the life of the device.
+ *          TMRA_TS_GetCount() takes no lock and may be called from thread
+ *          context and from any interrupt priority, including while the
+ *          overflow interrupt is masked: a wrap that the interrupt has not
+ *          handled yet is seen in the overflow flag and accounted for. The
+ *          application enables the function clock of both units and calls
+ *          TMRA_TS_IrqHandler() from the overflow handler of the high unit.
+ * @{
+ */
+
+#if (DDL_TMRA_TS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_TS_Local_Macros TMRA_TS Local Macros
+ * @{
+ */
+#define TMRA_TS_NS_PER_SEC              (1000000000ULL)
+
+/**
+ * @defgroup TMRA_TS_Check_Parameters_Validity TMRA_TS Check Parameters Validity
+ * @{
+ */
+#define IS_TMRA_TS_UNIT(x)                                                     \
+(   ((x) == CM_TMRA_1)                          ||                             \
+    ((x) == CM_TMRA_3))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/**
+ * @addtogroup TMRA_TS_Local_Functions
+ * @{
+ */
+static uint32_t TMRA_TS_ReadHw(void);
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_TS_Local_Variables TMRA_TS Local Variables
+ * @{
+ */
+static CM_TMRA_TypeDef *m_pstcTmraLow = NULL;
+static CM_TMRA_TypeDef *m_pstcTmraHigh = NULL;
+static IRQn_Type m_enIRQn;
+static uint32_t m_u32Freq = 0UL;
+/* Overflows of the high unit, the upper 32 bits */
+static __IO uint32_t m_u32Epoch = 0UL;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMRA_TS_Global_Functions TMRA_TS Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize structure stc_tmra_ts_init_t variable with default value.
+ * @param  [out] pstcInit               Pointer to a stc_tmra_ts_init_t structure variable
+ *                                      which will be initialized.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t TMRA_TS_StructInit(stc_tmra_ts_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->pstcTmraLow = CM_TMRA_1;
+        pstcInit->u16ClockDiv = TMRA_CLK_DIV1;
+        pstcInit->u32IrqPriority = DDL_IRQ_PRI03;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the unit pair and start counting from 0.
+ * @param  [in] pstcInit                Pointer to a stc_tmra_ts_init_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                          No errors occurred
+ *   @arg  ErrorInvalidParameter:       pstcInit == NULL
+ */
+en_result_t TMRA_TS_Init(const stc_tmra_ts_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    stc_clock_freq_t stcClkFreq;
+    stc_tmra_init_t stcTmraInit;
+
+    if (pstcInit != NULL)
+    {
+        DDL_ASSERT(IS_TMRA_TS_UNIT(pstcInit->pstcTmraLow));
+
+        m_pstcTmraLow = pstcInit->pstcTmraLow;
+        if (m_pstcTmraLow == CM_TMRA_1)
+        {
+            m_pstcTmraHigh = CM_TMRA_2;
+            m_enIRQn = TMRA_2_OVF_IRQn;
+        }
+        else
+        {
+            m_pstcTmraHigh = CM_TMRA_4;
+            m_enIRQn = TMRA_4_OVF_IRQn;
+        }
+
+        (void)CLK_GetClockFreq(&stcClkFreq);
+        m_u32Freq = stcClkFreq.u32Pclk1Freq >> ((uint32_t)pstcInit->u16ClockDiv >> TMRA_BCSTR_CKDIV_POS);
+
+        TMRA_Stop(m_pstcTmraLow);
+        TMRA_Stop(m_pstcTmraHigh);
+
+        (void)TMRA_StructInit(&stcTmraInit);
+        stcTmraInit.u16ClockDiv    = pstcInit->u16ClockDiv;
+        stcTmraInit.u16CountMode   = TMRA_MD_SAWTOOTH;
+        stcTmraInit.u16CountDir    = TMRA_DIR_UP;
+        stcTmraInit.u16PeriodValue = 0xFFFFU;
+        (void)TMRA_Init(m_pstcTmraLow, &stcTmraInit);
+        (void)TMRA_Init(m_pstcTmraHigh, &stcTmraInit);
+        TMRA_HWCountUpCondCmd(m_pstcTmraHigh, TMRA_CNT_UP_COND_SYM_OVF, Enable);
+
+        TMRA_SetCountValue(m_pstcTmraLow, 0U);
+        TMRA_SetCountValue(m_pstcTmraHigh, 0U);
+        TMRA_ClearStatus(m_pstcTmraHigh, TMRA_FLAG_OVF);
+        m_u32Epoch = 0UL;
+
+        TMRA_IntCmd(m_pstcTmraHigh, TMRA_INT_OVF, Enable);
+        NVIC_ClearPendingIRQ(m_enIRQn);
+        NVIC_SetPriority(m_enIRQn, pstcInit->u32IrqPriority);
+        NVIC_EnableIRQ(m_enIRQn);
+
+        /* The high unit starts together with the low unit */
+        TMRA_SyncStartCmd(m_pstcTmraHigh, Enable);
+        TMRA_Start(m_pstcTmraLow);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the timestamp.
+ * @param  None
+ * @retval None
+ */
+void TMRA_TS_DeInit(void)
+{
+    if (m_pstcTmraLow != NULL)
+    {
+        TMRA_Stop(m_pstcTmraLow);
+        TMRA_Stop(m_pstcTmraHigh);
+        TMRA_IntCmd(m_pstcTmraHigh, TMRA_INT_OVF, Disable);
+        NVIC_DisableIRQ(m_enIRQn);
+        TMRA_SyncStartCmd(m_pstcTmraHigh, Disable);
+        TMRA_HWCountUpCondCmd(m_pstcTmraHigh, TMRA_CNT_UP_COND_SYM_OVF, Disable);
+        m_pstcTmraLow = NULL;
+        m_pstcTmraHigh = NULL;
+        m_u32Freq = 0UL;
+    }
+}
+
+/**
+ * @brief  Get the timestamp in counts.
+ * @param  None
+ * @retval Counts since TMRA_TS_Init(), 0 if not initialized.
+ * @note   Lock free: the read is retried if the overflow interrupt ran in
+ *         the middle of it.
+ */
+uint64_t TMRA_TS_GetCount(void)
+{
+    uint32_t u32Epoch;
+    uint32_t u32Cnt;
+    uint32_t u32Wrap;
+    uint64_t u64Ret = 0ULL;
+
+    if (m_pstcTmraLow != NULL)
+    {
+        do
+        {
+            u32Epoch = m_u32Epoch;
+            u32Cnt = TMRA_TS_ReadHw();
+            u32Wrap = 0UL;
+            if (Set == TMRA_GetStatus(m_pstcTmraHigh, TMRA_FLAG_OVF))
+            {
+                /* Wrapped but not handled yet: a count read now is past the wrap */
+                u32Cnt = TMRA_TS_ReadHw();
+                u32Wrap = 1UL;
+            }
+        } while (u32Epoch != m_u32Epoch);
+
+        u64Ret = ((uint64_t)(u32Epoch + u32Wrap) << 32U) | u32Cnt;
+    }
+
+    return u64Ret;
+}
+
+/**
+ * @brief  Get the count frequency.
+ * @param  None
+ * @retval Frequency in Hz, 0 if not initialized.
+ */
+uint32_t TMRA_TS_GetFreq(void)
+{
+    return m_u32Freq;
+}
+
+/**
+ * @brief  Convert counts to nanoseconds.
+ * @param  [in] u64Count                Counts, e.g. the difference of two timestamps.
+ * @retval Nanoseconds, 0 if not initialized.
+ */
+uint64_t TMRA_TS_CountToNs(uint64_t u64Count)
+{
+    uint64_t u64Ret = 0ULL;
+
+    if (m_u32Freq != 0UL)
+    {
+        /* Split in seconds to keep the product within 64 bits */
+        u64Ret = ((u64Count / m_u32Freq) * TMRA_TS_NS_PER_SEC) +
+                 (((u64Count % m_u32Freq) * TMRA_TS_NS_PER_SEC) / m_u32Freq);
+    }
+
+    return u64Ret;
+}
+
+/**
+ * @brief  Get the timestamp in nanoseconds.
+ * @param  None
+ * @retval Nanoseconds since TMRA_TS_Init().
+ * @note   Uses 64-bit divisions, prefer TMRA_TS_GetCount() on hot paths.
+ */
+uint64_t TMRA_TS_GetNs(void)
+{
+    return TMRA_TS_CountToNs(TMRA_TS_GetCount());
+}
+
+/**
+ * @brief  Overflow interrupt handler of the high unit.
+ * @param  None
+ * @retval None
+ */
+void TMRA_TS_IrqHandler(void)
+{
+    uint32_t u32Primask;
+
+    if ((m_pstcTmraHigh != NULL) && (Set == TMRA_GetStatus(m_pstcTmraHigh, TMRA_FLAG_OVF)))
+    {
+        /* A reader preempting this must see the flag and the epoch change together */
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        TMRA_ClearStatus(m_pstcTmraHigh, TMRA_FLAG_OVF);
+        m_u32Epoch++;
+        __set_PRIMASK(u32Primask);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TMRA_TS_Local_Functions TMRA_TS Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Read the 32-bit hardware count.
+ * @param  None
+ * @retval Count
+ * @note   If the high half changed while the low half was read, the low
+ *         half wrapped; it is read again to pair with the new high half.
+ */
+static uint32_t TMRA_TS_ReadHw(void)
+{
+    uint32_t u32High;
+    uint32_t u32Low;
+
+    u32High = TMRA_GetCountValue(m_pstcTmraHigh);
+    u32Low = TMRA_GetCountValue(m_pstcTmraLow);
+    if (u32High != TMRA_GetCountValue(m_pstcTmraHigh))
+    {
+        u32High = TMRA_GetCountValue(m_pstcTmraHigh);
+        u32Low = TMRA_GetCountValue(m_pstcTmraLow);
+    }
+
+    return (u32High << 16U) | u32Low;
+}
+
+/**
+ * @}
+ */
+
+#endif /* DDL_TMRA_TS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
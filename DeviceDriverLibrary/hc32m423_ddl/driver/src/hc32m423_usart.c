@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Use time based timeout in microseconds
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -1152,7 +1153,7 @@ void USART_WriteID(CM_USART_TypeDef *USARTx, uint16_t u16ID)
  *           @arg CM_USART4:        USART unit 4 instance register base
  * @param  [out] pvBuf              The pointer to data transmitted buffer
  * @param  [in]  u32Len             Amount of frame to be sent.
- * @param  [in]  u32Timeout         Timeout duration
+ * @param  [in]  u32Timeout         Timeout duration in microseconds
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                      No errors occurred
  *   @arg  ErrorTimeout:            Communicate timeout.
@@ -1218,7 +1219,7 @@ en_result_t USART_UART_Trans(CM_USART_TypeDef *USARTx,
  *           @arg CM_USART4:        USART unit 4 instance register base
  * @param  [out] pvBuf              The pointer to data received buffer
  * @param  [in]  u32Len             Amount of frame to be received.
- * @param  [in]  u32Timeout         Timeout duration
+ * @param  [in]  u32Timeout         Timeout duration in microseconds
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                      No errors occurred
  *   @arg  ErrorTimeout:            Communicate timeout.
@@ -1285,7 +1286,7 @@ en_result_t USART_UART_Receive(const CM_USART_TypeDef *USARTx,
  *           @arg CM_USART4:        USART unit 4 instance register base
  * @param  [in] au8Buf              The pointer to data transmitted buffer
  * @param  [in] u32Len              Amount of data to be transmitted.
- * @param  [in] u32Timeout          Timeout duration
+ * @param  [in] u32Timeout          Timeout duration in microseconds
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                      No errors occurred
  *   @arg  ErrorTimeout:            Communicate timeout.
@@ -1349,7 +1350,7 @@ en_result_t USART_ClockSync_Trans(CM_USART_TypeDef *USARTx,
  *           @arg CM_USART4:        USART unit 4 instance register base
  * @param  [out] au8Buf             The pointer to data received buffer
  * @param  [in] u32Len              Amount of data to be sent and received.
- * @param  [in] u32Timeout          Timeout duration
+ * @param  [in] u32Timeout          Timeout duration in microseconds
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                      No errors occurred
  *   @arg  ErrorTimeout:            Communicate timeout.
@@ -1423,7 +1424,7 @@ en_result_t USART_ClockSync_Receive(CM_USART_TypeDef *USARTx,
  * @param  [in] au8TxBuf            The pointer to data transmitted buffer
  * @param  [out] au8RxBuf           The pointer to data received buffer
  * @param  [in] u32Len              Amount of data to be sent and received.
- * @param  [in] u32Timeout          Timeout duration
+ * @param  [in] u32Timeout          Timeout duration in microseconds
  * @retval An en_result_t enumeration value:
  *   @arg  Ok:                      No errors occurred
  *   @arg  ErrorTimeout:            Communicate timeout.
@@ -1522,7 +1523,7 @@ en_result_t USART_ClockSync_TransReceive(CM_USART_TypeDef *USARTx,
  *         This parameter can be one of the following values:
  *         @arg Set:                Wait flag set
  *         @arg Reset:              Wait flag reset
- * @param  [in] u32Timeout          Maximum count of trying to get status
+ * @param  [in] u32Timeout          Timeout in microseconds
  * @retval An en_result_t enumeration value:
  *         @arg Ok:                 Wait the expected status of the specified flags
  *         @arg ErrorTimeout:       Wait timeout
@@ -1534,22 +1535,21 @@ static en_result_t USART_WaitStatus(const CM_USART_TypeDef *USARTx,
                                     uint32_t u32Timeout)
 {
     en_result_t enRet = Ok;
-    __IO uint32_t u32TimeoutCount = 0UL;
+    stc_ddl_deadline_t stcDeadline;
 
     /* Check parameters */
     DDL_ASSERT(IS_USART_UNIT(USARTx));
     DDL_ASSERT(IS_USART_FLAG(u32Flag));
 
+    /* USART_TIMEOUT_MAX equals DDL_TIMEOUT_MAX: the deadline never expires */
+    DDL_DeadlineStart(&stcDeadline, u32Timeout);
     while (USART_GetStatus(USARTx, u32Flag) != enStatus)
     {
-        /* Block checking flag if timeout value is USART_TIMEOUT_MAX */
-        if ((u32TimeoutCount > u32Timeout) && (u32Timeout < USART_TIMEOUT_MAX))
+        if (Set == DDL_DeadlineIsExpired(&stcDeadline))
         {
             enRet = ErrorTimeout;
             break;
         }
-
-        u32TimeoutCount++;
     }
 
     return enRet;
@@ -7,6 +7,8 @@
    Date             Author          Notes
    2020-09-15       CDT             First version
    2020-12-03       CDT             Fixed SysTick_Delay function overflow handling
+   2026-10-18       CDT             Add DWT cycle counter based deadline functions
+   2026-10-18       CDT             Add SysTick_AddTick function for tickless idle
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -219,6 +221,16 @@ __WEAKDEF void SysTick_IncTick(void)
     m_u32TickCount += m_u32TickStep;
 }
 
+/**
+ * @brief Add ticks that elapsed while the SysTick interrupt was suspended.
+ * @param [in] u32Tick                  Number of SysTick periods.
+ * @retval None
+ */
+__WEAKDEF void SysTick_AddTick(uint32_t u32Tick)
+{
+    m_u32TickCount += u32Tick * m_u32TickStep;
+}
+
 /**
  * @brief Provides a tick value in millisecond.
  * @param None
@@ -251,6 +263,106 @@ __WEAKDEF void SysTick_Resume(void)
     SysTick->CTRL  |= SysTick_CTRL_TICKINT_Msk;
 }
 
+/**
+ * @brief Get the DWT cycle counter, start it if not running.
+ * @param None
+ * @retval Cycle count value, 0 if the core has no cycle counter
+ */
+uint32_t DDL_GetCycleCount(void)
+{
+    if (0UL == READ_REG32_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk))
+    {
+        SET_REG32_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+        SET_REG32_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+    }
+
+    return READ_REG32(DWT->CYCCNT);
+}
+
+/**
+ * @brief Start a deadline.
+ * @param [out] pstcDeadline            Pointer to a @ref stc_ddl_deadline_t structure.
+ * @param [in] u32TimeoutUs             Timeout in microseconds, DDL_TIMEOUT_MAX never expires.
+ * @retval None
+ * @note  The time base is the DWT cycle counter at the current HCLK, so the timeout
+ *        does not depend on flash wait cycles or compiler optimization level.
+ *        Without cycle counter, each DDL_DeadlineIsExpired() call counts as 1us.
+ *        With HCLK below 1MHz the timeout is lengthened to u32TimeoutUs HCLK cycles.
+ */
+void DDL_DeadlineStart(stc_ddl_deadline_t *pstcDeadline, uint32_t u32TimeoutUs)
+{
+    DDL_ASSERT(NULL != pstcDeadline);
+
+    pstcDeadline->u32RemainUs = u32TimeoutUs;
+    pstcDeadline->u32CycleAcc = 0UL;
+    pstcDeadline->u32LastCycle = DDL_GetCycleCount();
+
+    if (0UL == READ_REG32_BIT(DWT->CTRL, DWT_CTRL_NOCYCCNT_Msk))
+    {
+        pstcDeadline->u32CyclePerUs = HCLK_VALUE / 1000000UL;
+        if (0UL == pstcDeadline->u32CyclePerUs)
+        {
+            pstcDeadline->u32CyclePerUs = 1UL;
+        }
+    }
+    else
+    {
+        pstcDeadline->u32CyclePerUs = 0UL;
+    }
+}
+
+/**
+ * @brief Check whether a deadline has expired.
+ * @param [in] pstcDeadline             Pointer to a @ref stc_ddl_deadline_t structure.
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: Deadline expired
+ *           - Reset: Deadline not expired
+ * @note  Elapsed time is accumulated at every call, so timeouts longer than one
+ *        wrap of the 32-bit cycle counter are supported as long as the caller
+ *        polls more often than that.
+ */
+en_flag_status_t DDL_DeadlineIsExpired(stc_ddl_deadline_t *pstcDeadline)
+{
+    uint32_t u32Now;
+    uint32_t u32ElapsedUs;
+    en_flag_status_t enExpired = Reset;
+
+    DDL_ASSERT(NULL != pstcDeadline);
+
+    if (DDL_TIMEOUT_MAX != pstcDeadline->u32RemainUs)
+    {
+        if (0UL == pstcDeadline->u32CyclePerUs)
+        {
+            u32ElapsedUs = 1UL;
+        }
+        else
+        {
+            u32Now = READ_REG32(DWT->CYCCNT);
+            pstcDeadline->u32CycleAcc += (u32Now - pstcDeadline->u32LastCycle);
+            pstcDeadline->u32LastCycle = u32Now;
+
+            u32ElapsedUs = 0UL;
+            if (pstcDeadline->u32CycleAcc >= pstcDeadline->u32CyclePerUs)
+            {
+                u32ElapsedUs = pstcDeadline->u32CycleAcc / pstcDeadline->u32CyclePerUs;
+                pstcDeadline->u32CycleAcc -= u32ElapsedUs * pstcDeadline->u32CyclePerUs;
+            }
+        }
+
+        if (u32ElapsedUs >= pstcDeadline->u32RemainUs)
+        {
+            pstcDeadline->u32RemainUs = 0UL;
+            enExpired = Set;
+        }
+        else
+        {
+            pstcDeadline->u32RemainUs -= u32ElapsedUs;
+        }
+    }
+
+    return enExpired;
+}
+
 #ifdef __DEBUG
 /**
  * @brief DDL assert error handle function
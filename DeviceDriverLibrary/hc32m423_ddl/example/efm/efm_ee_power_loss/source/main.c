@@ -0,0 +1,464 @@
+/**
+ *******************************************************************************
+ * @file  efm/efm_ee_power_loss/source/main.c
+ * @brief Main program of EFM_EE power loss for the Device Driver Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by HDSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M423_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup EFM_EE_Power_Loss
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* RAM flash model: the EFM_EE default area, kept in RAM */
+#define MODEL_SECTOR_NUM        (4UL)
+#define MODEL_START_ADDR        ((EFM_END_ADDR + 1UL) - (MODEL_SECTOR_NUM * EFM_EE_SECTOR_SIZE))
+#define MODEL_SECTOR_WORDS      (EFM_EE_SECTOR_SIZE / 4UL)
+#define MODEL_WORDS             (MODEL_SECTOR_NUM * MODEL_SECTOR_WORDS)
+#define MODEL_BLANK             (0xFFFFFFFFUL)
+#define MODEL_NO_CUT            (0xFFFFFFFFUL)
+
+/* Store under test */
+#define EE_KEY_NUM              (6UL)
+#define EE_DATA_LEN_MAX         (40UL)
+#define EE_PREFILL_WRITES       (60UL)
+#define EE_UPDATE_WRITES        (100UL)
+#define EE_CHECK_WRITES         (50UL)
+
+/* The power is cut at flash operation 0 ~ EE_CUT_MAX - 1 after the prefill */
+#define EE_CUT_MAX              (800UL)
+/* A second cut during the recovery, at operation 0 ~ EE_RECOVERY_CUT_MAX - 1 */
+#define EE_RECOVERY_CUT_MAX     (25UL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint32_t Model_Rand(void);
+static en_flag_status_t Model_PowerCut(void);
+static en_result_t Model_Program(uint32_t u32Addr, uint32_t u32Data);
+static en_result_t Model_Erase(uint32_t u32Addr);
+static uint32_t Model_Read(uint32_t u32Addr);
+static void Model_PowerOn(uint32_t u32Cut);
+
+static en_result_t EE_Mount(void);
+static uint32_t EE_MakeValue(uint32_t u32Seed, uint8_t au8Buf[]);
+static en_result_t EE_WriteAck(uint32_t u32Key, uint32_t u32Seed);
+static en_result_t EE_Check(uint32_t u32PendKey, const uint8_t au8Pend[], uint32_t u32PendLen);
+static en_result_t EE_PowerCutRun(uint32_t u32Cut);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t m_au32ModelFlash[MODEL_WORDS];
+static uint32_t m_u32CutCnt = MODEL_NO_CUT;
+static en_functional_state_t m_enPower = Enable;
+static uint32_t m_u32Rand = 0x2545F491UL;
+static uint32_t m_u32RuleError = 0UL;
+
+static const stc_efm_ee_flash_t m_stcModelFlash =
+{
+    &Model_Program, &Model_Erase, &Model_Read
+};
+
+static uint16_t m_au16Index[EE_KEY_NUM];
+/* Last value of each key whose write returned Ok */
+static uint8_t m_au8Ack[EE_KEY_NUM][EE_DATA_LEN_MAX];
+static uint32_t m_au32AckLen[EE_KEY_NUM];
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Pseudo random number, xorshift32.
+ * @param  None
+ * @retval Random number
+ */
+static uint32_t Model_Rand(void)
+{
+    m_u32Rand ^= m_u32Rand << 13U;
+    m_u32Rand ^= m_u32Rand >> 17U;
+    m_u32Rand ^= m_u32Rand << 5U;
+    return m_u32Rand;
+}
+
+/**
+ * @brief  Count a flash operation and cut the power at the armed one.
+ * @param  None
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: The power is cut during this operation
+ *           - Reset: The operation completes
+ */
+static en_flag_status_t Model_PowerCut(void)
+{
+    en_flag_status_t enCut = Reset;
+
+    if (0UL == m_u32CutCnt)
+    {
+        m_enPower = Disable;
+        m_u32CutCnt = MODEL_NO_CUT;
+        enCut = Set;
+    }
+    else if (MODEL_NO_CUT != m_u32CutCnt)
+    {
+        m_u32CutCnt--;
+    }
+    else
+    {
+        /* Not armed */
+    }
+
+    return enCut;
+}
+
+/**
+ * @brief  Program a word of the model.
+ * @param  [in] u32Addr                 Word address.
+ * @param  [in] u32Data                 Word.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Programmed
+ *           - Error: Power off, cut, or word not erased
+ * @note   Like the EFM, programming only clears bits. A cut program leaves a
+ *         random part of the bits to clear still set.
+ */
+static en_result_t Model_Program(uint32_t u32Addr, uint32_t u32Data)
+{
+    en_result_t enRet = Error;
+    uint32_t u32Idx = (u32Addr - MODEL_START_ADDR) / 4UL;
+
+    if (Enable == m_enPower)
+    {
+        if (MODEL_BLANK != m_au32ModelFlash[u32Idx])
+        {
+            /* The store must program a word once after the erase */
+            m_au32ModelFlash[u32Idx] &= u32Data;
+            m_u32RuleError++;
+        }
+        else if (Set == Model_PowerCut())
+        {
+            m_au32ModelFlash[u32Idx] = u32Data | Model_Rand();
+        }
+        else
+        {
+            m_au32ModelFlash[u32Idx] = u32Data;
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Erase the sector of an address of the model.
+ * @param  [in] u32Addr                 Address in the sector.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Erased
+ *           - Error: Power off or cut
+ * @note   A cut erase leaves a random part of the words erased.
+ */
+static en_result_t Model_Erase(uint32_t u32Addr)
+{
+    en_result_t enRet = Error;
+    uint32_t u32Base = ((u32Addr - MODEL_START_ADDR) / EFM_EE_SECTOR_SIZE) * MODEL_SECTOR_WORDS;
+    uint32_t i;
+
+    if (Enable == m_enPower)
+    {
+        if (Set == Model_PowerCut())
+        {
+            for (i = 0UL; i < MODEL_SECTOR_WORDS; i++)
+            {
+                if (0UL != (Model_Rand() & 1UL))
+                {
+                    m_au32ModelFlash[u32Base + i] = MODEL_BLANK;
+                }
+            }
+        }
+        else
+        {
+            for (i = 0UL; i < MODEL_SECTOR_WORDS; i++)
+            {
+                m_au32ModelFlash[u32Base + i] = MODEL_BLANK;
+            }
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Read a word of the model.
+ * @param  [in] u32Addr                 Word address.
+ * @retval Word
+ */
+static uint32_t Model_Read(uint32_t u32Addr)
+{
+    return m_au32ModelFlash[(u32Addr - MODEL_START_ADDR) / 4UL];
+}
+
+/**
+ * @brief  Power the model on.
+ * @param  [in] u32Cut                  Flash operations before the power is cut,
+ *                                      MODEL_NO_CUT for none.
+ * @retval None
+ */
+static void Model_PowerOn(uint32_t u32Cut)
+{
+    m_enPower = Enable;
+    m_u32CutCnt = u32Cut;
+}
+
+/**
+ * @brief  Initialize the store on the model, as after a reset.
+ * @param  None
+ * @retval An en_result_t enumeration value of EFM_EE_Init().
+ */
+static en_result_t EE_Mount(void)
+{
+    stc_efm_ee_init_t stcInit;
+
+    (void)EFM_EE_StructInit(&stcInit);
+    stcInit.u32StartAddr = MODEL_START_ADDR;
+    stcInit.u32SectorNum = MODEL_SECTOR_NUM;
+    stcInit.pu16Index = m_au16Index;
+    stcInit.u32KeyNum = EE_KEY_NUM;
+    stcInit.pstcFlash = &m_stcModelFlash;
+
+    return EFM_EE_Init(&stcInit);
+}
+
+/**
+ * @brief  Make a test value.
+ * @param  [in] u32Seed                 Seed.
+ * @param  [out] au8Buf                 Value, EE_DATA_LEN_MAX bytes.
+ * @retval Length of the value, 1 ~ EE_DATA_LEN_MAX
+ */
+static uint32_t EE_MakeValue(uint32_t u32Seed, uint8_t au8Buf[])
+{
+    uint32_t u32Len = 1UL + ((u32Seed * 37UL) % EE_DATA_LEN_MAX);
+    uint32_t i;
+
+    for (i = 0UL; i < u32Len; i++)
+    {
+        au8Buf[i] = (uint8_t)(u32Seed + (i * 7UL));
+    }
+
+    return u32Len;
+}
+
+/**
+ * @brief  Write a value and remember it once acknowledged.
+ * @param  [in] u32Key                  Key.
+ * @param  [in] u32Seed                 Seed of the value.
+ * @retval An en_result_t enumeration value of EFM_EE_Write().
+ */
+static en_result_t EE_WriteAck(uint32_t u32Key, uint32_t u32Seed)
+{
+    en_result_t enRet;
+    uint8_t au8Buf[EE_DATA_LEN_MAX];
+    uint32_t u32Len;
+
+    u32Len = EE_MakeValue(u32Seed, au8Buf);
+    enRet = EFM_EE_Write((uint16_t)u32Key, au8Buf, u32Len);
+    if (Ok == enRet)
+    {
+        (void)memcpy(m_au8Ack[u32Key], au8Buf, u32Len);
+        m_au32AckLen[u32Key] = u32Len;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Check that every key holds its acknowledged value. The key of the
+ *         write cut by the power loss may hold the new value instead.
+ * @param  [in] u32PendKey              Key of the cut write, EE_KEY_NUM for none.
+ * @param  [in] au8Pend                 Value of the cut write.
+ * @param  [in] u32PendLen              Length of the cut write.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: All values as expected
+ *           - Error: A value is lost or corrupted
+ */
+static en_result_t EE_Check(uint32_t u32PendKey, const uint8_t au8Pend[], uint32_t u32PendLen)
+{
+    en_result_t enRet = Ok;
+    uint8_t au8Buf[EE_DATA_LEN_MAX];
+    uint32_t u32Len = 0UL;
+    uint32_t u32Key;
+    en_result_t enRead;
+
+    for (u32Key = 0UL; u32Key < EE_KEY_NUM; u32Key++)
+    {
+        enRead = EFM_EE_Read((uint16_t)u32Key, au8Buf, EE_DATA_LEN_MAX, &u32Len);
+        if ((Ok == enRead) && (u32Len == m_au32AckLen[u32Key]) &&
+            (0 == memcmp(au8Buf, m_au8Ack[u32Key], u32Len)))
+        {
+            /* Acknowledged value */
+        }
+        else if ((u32Key == u32PendKey) && (Ok == enRead) && (u32Len == u32PendLen) &&
+                 (0 == memcmp(au8Buf, au8Pend, u32Len)))
+        {
+            /* The cut write went through */
+            (void)memcpy(m_au8Ack[u32Key], au8Buf, u32Len);
+            m_au32AckLen[u32Key] = u32Len;
+        }
+        else
+        {
+            enRet = Error;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Cut the power during a series of writes and check the recovery.
+ * @param  [in] u32Cut                  Flash operations before the cut.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: The store recovered with no value lost
+ *           - Error: Mount failed, or a value is lost or corrupted
+ */
+static en_result_t EE_PowerCutRun(uint32_t u32Cut)
+{
+    en_result_t enRet = Ok;
+    uint8_t au8Pend[EE_DATA_LEN_MAX];
+    uint32_t u32PendLen = 0UL;
+    uint32_t u32PendKey = EE_KEY_NUM;
+    uint32_t u32Seed;
+    uint32_t i;
+
+    /* Blank area, format and fill so that the writes compact */
+    (void)memset(m_au32ModelFlash, 0xFF, sizeof(m_au32ModelFlash));
+    Model_PowerOn(MODEL_NO_CUT);
+    if (Ok != EE_Mount())
+    {
+        enRet = Error;
+    }
+    for (i = 0UL; (i < EE_PREFILL_WRITES) && (Ok == enRet); i++)
+    {
+        enRet = EE_WriteAck(i % EE_KEY_NUM, i);
+    }
+
+    /* Writes of one key until the power is cut, the other keys stay in the
+       oldest sectors and are copied by the compactions */
+    Model_PowerOn(u32Cut);
+    for (i = 0UL; (i < EE_UPDATE_WRITES) && (Ok == enRet) && (Enable == m_enPower); i++)
+    {
+        u32Seed = u32Cut + (i * 13UL);
+        u32PendKey = u32Cut % EE_KEY_NUM;
+        u32PendLen = EE_MakeValue(u32Seed, au8Pend);
+        if ((Ok != EE_WriteAck(u32PendKey, u32Seed)) && (Enable == m_enPower))
+        {
+            enRet = Error;
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        /* Reset, a second cut during the recovery, reset again */
+        Model_PowerOn(Model_Rand() % EE_RECOVERY_CUT_MAX);
+        (void)EE_Mount();
+        Model_PowerOn(MODEL_NO_CUT);
+        if ((Ok != EE_Mount()) || (Ok != EE_Check(u32PendKey, au8Pend, u32PendLen)))
+        {
+            enRet = Error;
+        }
+    }
+
+    /* The store is still usable */
+    for (i = 0UL; (i < EE_CHECK_WRITES) && (Ok == enRet); i++)
+    {
+        enRet = EE_WriteAck(i % EE_KEY_NUM, u32Cut + i);
+    }
+    if (Ok == enRet)
+    {
+        enRet = EE_Check(EE_KEY_NUM, au8Pend, 0UL);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Main function of EFM_EE power loss project
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    en_result_t enRet = Ok;
+    uint32_t u32Cut;
+
+    /* Unlock GPIO register: PSPCR, PCCR, PINAER, PCRxy, PFSRxy */
+    GPIO_Unlock();
+    /* Led Init */
+    BSP_LED_Init();
+    /* Lock GPIO register: PSPCR, PCCR, PINAER, PCRxy, PFSRxy */
+    GPIO_Lock();
+    BSP_LED_On(LED_BLUE);
+
+    for (u32Cut = 0UL; (u32Cut < EE_CUT_MAX) && (Ok == enRet); u32Cut++)
+    {
+        enRet = EE_PowerCutRun(u32Cut);
+    }
+
+    BSP_LED_Off(LED_BLUE);
+    if ((Ok == enRet) && (0UL == m_u32RuleError))
+    {
+        BSP_LED_On(LED_GREEN);
+    }
+    else
+    {
+        BSP_LED_On(LED_RED);
+    }
+
+    for (;;)
+    {
+        ;
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
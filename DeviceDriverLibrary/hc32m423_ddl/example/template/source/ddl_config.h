@@ -6,6 +6,26 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Add I2C_REGMAP module
+   2026-10-18       CDT             Add ADC_STREAM module
+   2026-10-18       CDT             Add ADC_SCHED module
+   2026-10-18       CDT             Add ADC_DSP module
+   2026-10-18       CDT             Add ADC_OVS module
+   2026-10-18       CDT             Add ADC_AWD module
+   2026-10-18       CDT             Add ADC_PRIO module
+   2026-10-18       CDT             Add TMR0_WHEEL module
+   2026-10-18       CDT             Add PWC_IDLE module
+   2026-10-18       CDT             Add TMRA_TS module
+   2026-10-18       CDT             Add TMR4_MOD module
+   2026-10-18       CDT             Add TMR4_ADC module
+   2026-10-18       CDT             Add TMRA_ENC module
+   2026-10-18       CDT             Add CAPT module
+   2026-10-18       CDT             Add PWM_FRAME module
+   2026-10-18       CDT             Add TMR_SYNC module
+   2026-10-18       CDT             Add EFM_EE module
+   2026-10-18       CDT             Add EFM_ASYNC module
+   2026-10-18       CDT             Add RAMFUNC module
+   2026-10-18       CDT             Add FW_UPD module
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -55,6 +75,12 @@ extern "C"
 #define DDL_PRINT_ENABLE                            (DDL_OFF)
 
 #define DDL_ADC_ENABLE                              (DDL_OFF)
+#define DDL_ADC_STREAM_ENABLE                       (DDL_OFF)
+#define DDL_ADC_SCHED_ENABLE                        (DDL_OFF)
+#define DDL_ADC_DSP_ENABLE                          (DDL_OFF)
+#define DDL_ADC_OVS_ENABLE                          (DDL_OFF)
+#define DDL_ADC_AWD_ENABLE                          (DDL_OFF)
+#define DDL_ADC_PRIO_ENABLE                         (DDL_OFF)
 #define DDL_CLK_ENABLE                              (DDL_OFF)
 #define DDL_CMP_ENABLE                              (DDL_OFF)
 #define DDL_CRC_ENABLE                              (DDL_OFF)
@@ -67,15 +93,29 @@ extern "C"
 #define DDL_FCM_ENABLE                              (DDL_OFF)
 #define DDL_GPIO_ENABLE                             (DDL_OFF)
 #define DDL_I2C_ENABLE                              (DDL_OFF)
+#define DDL_I2C_REGMAP_ENABLE                       (DDL_OFF)
 #define DDL_INTERRUPTS_ENABLE                       (DDL_OFF)
 #define DDL_PWC_ENABLE                              (DDL_OFF)
+#define DDL_PWC_IDLE_ENABLE                         (DDL_OFF)
 #define DDL_RMU_ENABLE                              (DDL_OFF)
 #define DDL_SPI_ENABLE                              (DDL_OFF)
 #define DDL_SWDT_ENABLE                             (DDL_OFF)
 #define DDL_TMR0_ENABLE                             (DDL_OFF)
+#define DDL_TMR0_WHEEL_ENABLE                       (DDL_OFF)
 #define DDL_TMR4_ENABLE                             (DDL_OFF)
+#define DDL_TMR4_MOD_ENABLE                         (DDL_OFF)
+#define DDL_TMR4_ADC_ENABLE                         (DDL_OFF)
 #define DDL_TMRA_ENABLE                             (DDL_OFF)
+#define DDL_TMRA_TS_ENABLE                          (DDL_OFF)
+#define DDL_TMRA_ENC_ENABLE                         (DDL_OFF)
 #define DDL_TMRB_ENABLE                             (DDL_OFF)
+#define DDL_CAPT_ENABLE                             (DDL_OFF)
+#define DDL_PWM_FRAME_ENABLE                        (DDL_OFF)
+#define DDL_TMR_SYNC_ENABLE                         (DDL_OFF)
+#define DDL_EFM_EE_ENABLE                           (DDL_OFF)
+#define DDL_EFM_ASYNC_ENABLE                        (DDL_OFF)
+#define DDL_RAMFUNC_ENABLE                          (DDL_OFF)
+#define DDL_FW_UPD_ENABLE                           (DDL_OFF)
 #define DDL_USART_ENABLE                            (DDL_OFF)
 #define DDL_WDT_ENABLE                              (DDL_OFF)
 
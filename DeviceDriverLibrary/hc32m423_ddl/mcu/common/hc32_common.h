@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Place __RAM_FUNC code in .ramfunc for ARM Compiler 5
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -212,11 +213,13 @@ typedef enum
   #ifndef __NO_INIT
     #define __NO_INIT
   #endif /* __NO_INIT */
-    /* RAM functions are defined using the toolchain options.
-    Functions that are executed in RAM should reside in a separate source module.
-    Using the 'Options for File' dialog you can simply change the 'Code / Const'
-    area of a module to a memory space in physical RAM. */
-    #define __RAM_FUNC
+  #ifndef __RAM_FUNC
+    /* The .ramfunc sections are placed in RAM by mcu/MDK/config/hc32m423_flash.sct.
+    Without that scatter file, use the 'Options for File' dialog to change the
+    'Code / Const' area of a module to a memory space in physical RAM. */
+    #define __RAM_FUNC                  __attribute__((section(".ramfunc")))
+    /* Usage: void __RAM_FUNC foo(void) */
+  #endif /* __RAM_FUNC */
 #else
     #error  "unsupported compiler!!"
 #endif
@@ -7,6 +7,26 @@
    Change Logs:
    Date             Author          Notes
    2020-09-15       CDT             First version
+   2026-10-18       CDT             Add I2C_REGMAP module
+   2026-10-18       CDT             Add ADC_STREAM module
+   2026-10-18       CDT             Add ADC_SCHED module
+   2026-10-18       CDT             Add ADC_DSP module
+   2026-10-18       CDT             Add ADC_OVS module
+   2026-10-18       CDT             Add ADC_AWD module
+   2026-10-18       CDT             Add ADC_PRIO module
+   2026-10-18       CDT             Add TMR0_WHEEL module
+   2026-10-18       CDT             Add PWC_IDLE module
+   2026-10-18       CDT             Add TMRA_TS module
+   2026-10-18       CDT             Add TMR4_MOD module
+   2026-10-18       CDT             Add TMR4_ADC module
+   2026-10-18       CDT             Add TMRA_ENC module
+   2026-10-18       CDT             Add CAPT module
+   2026-10-18       CDT             Add PWM_FRAME module
+   2026-10-18       CDT             Add TMR_SYNC module
+   2026-10-18       CDT             Add EFM_EE module
+   2026-10-18       CDT             Add EFM_ASYNC module
+   2026-10-18       CDT             Add RAMFUNC module
+   2026-10-18       CDT             Add FW_UPD module
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2020, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -72,6 +92,30 @@ extern "C"
     #include "hc32m423_adc.h"
 #endif /* DDL_ADC_ENABLE */
 
+#if (DDL_ADC_STREAM_ENABLE == DDL_ON)
+    #include "hc32m423_adc_stream.h"
+#endif /* DDL_ADC_STREAM_ENABLE */
+
+#if (DDL_ADC_SCHED_ENABLE == DDL_ON)
+    #include "hc32m423_adc_sched.h"
+#endif /* DDL_ADC_SCHED_ENABLE */
+
+#if (DDL_ADC_DSP_ENABLE == DDL_ON)
+    #include "hc32m423_adc_dsp.h"
+#endif /* DDL_ADC_DSP_ENABLE */
+
+#if (DDL_ADC_OVS_ENABLE == DDL_ON)
+    #include "hc32m423_adc_ovs.h"
+#endif /* DDL_ADC_OVS_ENABLE */
+
+#if (DDL_ADC_AWD_ENABLE == DDL_ON)
+    #include "hc32m423_adc_awd.h"
+#endif /* DDL_ADC_AWD_ENABLE */
+
+#if (DDL_ADC_PRIO_ENABLE == DDL_ON)
+    #include "hc32m423_adc_prio.h"
+#endif /* DDL_ADC_PRIO_ENABLE */
+
 #if (DDL_CLK_ENABLE == DDL_ON)
     #include "hc32m423_clk.h"
 #endif /* DDL_CLK_ENABLE */
@@ -116,6 +160,10 @@ extern "C"
     #include "hc32m423_i2c.h"
 #endif /* DDL_I2C_ENABLE */
 
+#if (DDL_I2C_REGMAP_ENABLE == DDL_ON)
+    #include "hc32m423_i2c_regmap.h"
+#endif /* DDL_I2C_REGMAP_ENABLE */
+
 #if (DDL_ICG_ENABLE == DDL_ON)
     #include "hc32m423_icg.h"
 #endif /* DDL_ICG_ENABLE */
@@ -128,6 +176,10 @@ extern "C"
     #include "hc32m423_pwc.h"
 #endif /* DDL_PWC_ENABLE */
 
+#if (DDL_PWC_IDLE_ENABLE == DDL_ON)
+    #include "hc32m423_pwc_idle.h"
+#endif /* DDL_PWC_IDLE_ENABLE */
+
 #if (DDL_RMU_ENABLE == DDL_ON)
     #include "hc32m423_rmu.h"
 #endif /* DDL_RMU_ENABLE */
@@ -144,18 +196,66 @@ extern "C"
     #include "hc32m423_tmr0.h"
 #endif /* DDL_TMR0_ENABLE */
 
+#if (DDL_TMR0_WHEEL_ENABLE == DDL_ON)
+    #include "hc32m423_tmr0_wheel.h"
+#endif /* DDL_TMR0_WHEEL_ENABLE */
+
 #if (DDL_TMR4_ENABLE == DDL_ON)
     #include "hc32m423_tmr4.h"
 #endif /* DDL_TMR4_ENABLE */
 
+#if (DDL_TMR4_MOD_ENABLE == DDL_ON)
+    #include "hc32m423_tmr4_mod.h"
+#endif /* DDL_TMR4_MOD_ENABLE */
+
+#if (DDL_TMR4_ADC_ENABLE == DDL_ON)
+    #include "hc32m423_tmr4_adc.h"
+#endif /* DDL_TMR4_ADC_ENABLE */
+
 #if (DDL_TMRA_ENABLE == DDL_ON)
     #include "hc32m423_tmra.h"
 #endif /* DDL_TMRA_ENABLE */
 
+#if (DDL_TMRA_TS_ENABLE == DDL_ON)
+    #include "hc32m423_tmra_ts.h"
+#endif /* DDL_TMRA_TS_ENABLE */
+
+#if (DDL_TMRA_ENC_ENABLE == DDL_ON)
+    #include "hc32m423_tmra_enc.h"
+#endif /* DDL_TMRA_ENC_ENABLE */
+
 #if (DDL_TMRB_ENABLE == DDL_ON)
     #include "hc32m423_tmrb.h"
 #endif /* DDL_TMRB_ENABLE */
 
+#if (DDL_CAPT_ENABLE == DDL_ON)
+    #include "hc32m423_capt.h"
+#endif /* DDL_CAPT_ENABLE */
+
+#if (DDL_PWM_FRAME_ENABLE == DDL_ON)
+    #include "hc32m423_pwm_frame.h"
+#endif /* DDL_PWM_FRAME_ENABLE */
+
+#if (DDL_TMR_SYNC_ENABLE == DDL_ON)
+    #include "hc32m423_tmr_sync.h"
+#endif /* DDL_TMR_SYNC_ENABLE */
+
+#if (DDL_EFM_EE_ENABLE == DDL_ON)
+    #include "hc32m423_efm_ee.h"
+#endif /* DDL_EFM_EE_ENABLE */
+
+#if (DDL_EFM_ASYNC_ENABLE == DDL_ON)
+    #include "hc32m423_efm_async.h"
+#endif /* DDL_EFM_ASYNC_ENABLE */
+
+#if (DDL_RAMFUNC_ENABLE == DDL_ON)
+    #include "hc32m423_ramfunc.h"
+#endif /* DDL_RAMFUNC_ENABLE */
+
+#if (DDL_FW_UPD_ENABLE == DDL_ON)
+    #include "hc32m423_fw_upd.h"
+#endif /* DDL_FW_UPD_ENABLE */
+
 #if (DDL_USART_ENABLE == DDL_ON)
     #include "hc32m423_usart.h"
 #endif /* DDL_USART_ENABLE */